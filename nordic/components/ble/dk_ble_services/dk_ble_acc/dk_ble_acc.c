@@ -13,6 +13,8 @@
 
 #include "app_error.h"
 #include "ble_config.h"
+#include "dk_profile.h"
+#include "dk_trace.h"
 #include "nrf_log.h"
 
 static uint32_t dk_ble_acc_raw_characteristic_add(dk_ble_acc_service_t *p_dk_acc_service)
@@ -195,8 +197,12 @@ void dk_ble_acc_service_init(dk_ble_acc_service_t *p_dk_acc_service)
     VERIFY_SUCCESS_VOID(err_code);
 }
 
+DK_PROFILE_REGION_DEF(m_on_ble_write_profile, "dk_ble_acc on_ble_write");
+
 static void on_ble_write(dk_ble_acc_service_t *p_dk_ble_acc_service, ble_evt_t const *p_ble_evt)
 {
+    DK_PROFILE_ENTER(m_on_ble_write_profile);
+
     if (p_ble_evt->evt.gatts_evt.params.write.handle == p_dk_ble_acc_service->acc_raw_char_handles.cccd_handle)
     {
         ret_code_t        err_code;
@@ -266,6 +272,8 @@ static void on_ble_write(dk_ble_acc_service_t *p_dk_ble_acc_service, ble_evt_t c
         dk_ble_acc_evt.event_type = DK_BLE_ACC_EVT_CONFIGURATION_CHANGED;
         p_dk_ble_acc_service->dk_ble_acc_evt_handler(&dk_ble_acc_evt);
     }
+
+    DK_PROFILE_EXIT(m_on_ble_write_profile);
 }
 
 void dk_ble_acc_on_ble_evt(ble_evt_t const *p_ble_evt, void *p_context)
@@ -308,7 +316,10 @@ uint32_t dk_ble_acc_raw_char_notify(dk_ble_acc_service_t *p_dk_ble_acc_service,
     hvx_params.p_len  = &data_length;
     hvx_params.p_data = p_data;
 
-    return sd_ble_gatts_hvx(p_dk_ble_acc_service->conn_handle, &hvx_params);
+    uint32_t err_code = sd_ble_gatts_hvx(p_dk_ble_acc_service->conn_handle, &hvx_params);
+    DK_TRACE(DK_TRACE_EVT_BLE_NOTIFY, hvx_params.handle, err_code);
+
+    return err_code;
 }
 
 uint32_t dk_ble_acc_alert_char_notify(dk_ble_acc_service_t *p_dk_ble_acc_service)
@@ -327,7 +338,10 @@ uint32_t dk_ble_acc_alert_char_notify(dk_ble_acc_service_t *p_dk_ble_acc_service
     hvx_params.type   = BLE_GATT_HVX_NOTIFICATION;
     hvx_params.p_len  = &data_length;
 
-    return sd_ble_gatts_hvx(p_dk_ble_acc_service->conn_handle, &hvx_params);
+    uint32_t err_code = sd_ble_gatts_hvx(p_dk_ble_acc_service->conn_handle, &hvx_params);
+    DK_TRACE(DK_TRACE_EVT_BLE_NOTIFY, hvx_params.handle, err_code);
+
+    return err_code;
 }
 
 uint32_t dk_ble_acc_config_write(dk_ble_acc_service_t *p_dk_ble_acc_service, uint8_t *p_data)
@@ -13,6 +13,8 @@
 
 #include "app_error.h"
 #include "ble_config.h"
+#include "dk_profile.h"
+#include "dk_trace.h"
 #include "nrf_log.h"
 
 static uint32_t dk_ble_mag_raw_characteristic_add(dk_ble_mag_service_t *p_mag_service)
@@ -193,8 +195,12 @@ void dk_ble_mag_service_init(dk_ble_mag_service_t *p_mag_service)
     VERIFY_SUCCESS_VOID(err_code);
 }
 
+DK_PROFILE_REGION_DEF(m_on_ble_write_profile, "dk_ble_mag on_ble_write");
+
 static void on_ble_write(dk_ble_mag_service_t *p_mag_service, ble_evt_t const *p_ble_evt)
 {
+    DK_PROFILE_ENTER(m_on_ble_write_profile);
+
     if (p_ble_evt->evt.gatts_evt.params.write.handle == p_mag_service->mag_raw_char_handles.cccd_handle)
     {
         ret_code_t        err_code;
@@ -253,6 +259,8 @@ static void on_ble_write(dk_ble_mag_service_t *p_mag_service, ble_evt_t const *p
         dk_ble_mag_evt.event_type = DK_BLE_MAG_EVT_CONFIGURATION_CHANGED;
         p_mag_service->dk_ble_mag_evt_handler(&dk_ble_mag_evt);
     }
+
+    DK_PROFILE_EXIT(m_on_ble_write_profile);
 }
 
 void dk_ble_mag_on_ble_evt(ble_evt_t const *p_ble_evt, void *p_context)
@@ -295,7 +303,10 @@ uint32_t dk_ble_mag_raw_char_notify(dk_ble_mag_service_t *p_mag_service, uint8_t
     hvx_params.p_len  = &data_length;
     hvx_params.p_data = data;
 
-    return sd_ble_gatts_hvx(p_mag_service->conn_handle, &hvx_params);
+    uint32_t err_code = sd_ble_gatts_hvx(p_mag_service->conn_handle, &hvx_params);
+    DK_TRACE(DK_TRACE_EVT_BLE_NOTIFY, hvx_params.handle, err_code);
+
+    return err_code;
 }
 
 uint32_t dk_ble_mag_alert_char_notify(dk_ble_mag_service_t *p_dk_ble_mag_service)
@@ -314,5 +325,8 @@ uint32_t dk_ble_mag_alert_char_notify(dk_ble_mag_service_t *p_dk_ble_mag_service
     hvx_params.type   = BLE_GATT_HVX_NOTIFICATION;
     hvx_params.p_len  = &data_length;
 
-    return sd_ble_gatts_hvx(p_dk_ble_mag_service->conn_handle, &hvx_params);
+    uint32_t err_code = sd_ble_gatts_hvx(p_dk_ble_mag_service->conn_handle, &hvx_params);
+    DK_TRACE(DK_TRACE_EVT_BLE_NOTIFY, hvx_params.handle, err_code);
+
+    return err_code;
 }
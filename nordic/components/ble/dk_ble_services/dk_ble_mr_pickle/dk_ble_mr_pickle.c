@@ -13,6 +13,7 @@
 
 #include "app_error.h"
 #include "ble_config.h"
+#include "dk_profile.h"
 #include "nrf_log.h"
 
 static uint32_t dk_mr_pickle_mode_characteristic_add(dk_mr_pickle_service_t *p_dk_mr_pickle_service)
@@ -85,8 +86,12 @@ void dk_mr_pickle_service_init(dk_mr_pickle_service_t *p_dk_mr_pickle_service)
     VERIFY_SUCCESS_VOID(err_code);
 }
 
+DK_PROFILE_REGION_DEF(m_on_ble_write_profile, "dk_ble_mr_pickle on_ble_write");
+
 static void on_ble_write(dk_mr_pickle_service_t *p_dk_mr_pickle_service, ble_evt_t const *p_ble_evt)
 {
+    DK_PROFILE_ENTER(m_on_ble_write_profile);
+
     if (p_ble_evt->evt.gatts_evt.params.write.handle == p_dk_mr_pickle_service->device_mode_char_handles.value_handle)
     {
         ret_code_t         err_code;
@@ -102,6 +107,8 @@ static void on_ble_write(dk_mr_pickle_service_t *p_dk_mr_pickle_service, ble_evt
         dk_mr_pickle_evt.event_type = DK_BLE_MR_PICKLE_EVT_CONFIGURATION_CHANGED;
         p_dk_mr_pickle_service->dk_mr_pickle_evt_handler(&dk_mr_pickle_evt);
     }
+
+    DK_PROFILE_EXIT(m_on_ble_write_profile);
 }
 
 void dk_mr_pickle_on_ble_evt(ble_evt_t const *p_ble_evt, void *p_context)
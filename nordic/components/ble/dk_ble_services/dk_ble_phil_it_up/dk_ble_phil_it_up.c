@@ -13,11 +13,15 @@
 #include "dk_ble_phil_it_up.h"
 
 #include "app_error.h"
+#include "dk_profile.h"
+#include "dk_trace.h"
 
 #define NRF_LOG_MODULE_NAME BLE_PHIL_IT_UP
 #include "nrf_log.h"
 NRF_LOG_MODULE_REGISTER();
 
+DK_PROFILE_REGION_DEF(m_on_write_profile, "dk_ble_phil_it_up on_write");
+
 /**
  * @brief       Function for handling the @ref BLE_GATTS_EVT_WRITE event from the SoftDevice.
  *
@@ -26,6 +30,8 @@ NRF_LOG_MODULE_REGISTER();
  */
 static void on_write(dk_ble_phil_it_up_t *p_dk_ble_phil_it_up, ble_evt_t const *p_ble_evt)
 {
+    DK_PROFILE_ENTER(m_on_write_profile);
+
     ble_gatts_evt_write_t const *p_evt_write = &p_ble_evt->evt.gatts_evt.params.write;
     dk_ble_phil_it_up_evt_t      dk_ble_phil_it_up_evt;
 
@@ -68,10 +74,13 @@ static void on_write(dk_ble_phil_it_up_t *p_dk_ble_phil_it_up, ble_evt_t const *
     } else
     {
         NRF_LOG_WARNING("Unhandled BLE event");
+        DK_PROFILE_EXIT(m_on_write_profile);
         return;
     }
 
     p_dk_ble_phil_it_up->evt_handler(&dk_ble_phil_it_up_evt);
+
+    DK_PROFILE_EXIT(m_on_write_profile);
 }
 
 /**
@@ -295,7 +304,10 @@ ret_code_t dk_ble_phil_it_up_amb_tmp_notify(uint16_t             conn_handle,
     hvx_params.p_len  = &length;
     hvx_params.p_data = (uint8_t *)&temperature;
 
-    return sd_ble_gatts_hvx(conn_handle, &hvx_params);
+    ret_code_t err_code = sd_ble_gatts_hvx(conn_handle, &hvx_params);
+    DK_TRACE(DK_TRACE_EVT_BLE_NOTIFY, hvx_params.handle, err_code);
+
+    return err_code;
 }
 
 ret_code_t dk_ble_phil_it_up_mug_tmp_notify(uint16_t             conn_handle,
@@ -312,7 +324,10 @@ ret_code_t dk_ble_phil_it_up_mug_tmp_notify(uint16_t             conn_handle,
     hvx_params.p_len  = &length;
     hvx_params.p_data = (uint8_t *)&temperature;
 
-    return sd_ble_gatts_hvx(conn_handle, &hvx_params);
+    ret_code_t err_code = sd_ble_gatts_hvx(conn_handle, &hvx_params);
+    DK_TRACE(DK_TRACE_EVT_BLE_NOTIFY, hvx_params.handle, err_code);
+
+    return err_code;
 }
 
 ret_code_t dk_ble_phil_it_up_mug_up_notify(uint16_t conn_handle, dk_ble_phil_it_up_t *p_dk_ble_phil_it_up, bool mug_up)
@@ -328,7 +343,10 @@ ret_code_t dk_ble_phil_it_up_mug_up_notify(uint16_t conn_handle, dk_ble_phil_it_
     hvx_params.p_len  = &length;
     hvx_params.p_data = &mug_up_val;
 
-    return sd_ble_gatts_hvx(conn_handle, &hvx_params);
+    ret_code_t err_code = sd_ble_gatts_hvx(conn_handle, &hvx_params);
+    DK_TRACE(DK_TRACE_EVT_BLE_NOTIFY, hvx_params.handle, err_code);
+
+    return err_code;
 }
 
 ret_code_t dk_ble_phil_it_up_mug_up_value_set(uint16_t             conn_handle,
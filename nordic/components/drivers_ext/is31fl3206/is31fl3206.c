@@ -11,6 +11,7 @@
 
 #include "is31fl3206.h"
 
+#include "dk_profile.h"
 #include "is31fl3206-gamma.h"
 #include "is31fl3206-internal.h"
 
@@ -34,10 +35,15 @@ static uint8_t m_gamma[] = IS31FL3206_GAMMA64;
 #else
 #error DK_IS31FL3206_GAMMA_STEPS defined incorrectly or not defined
 #endif
+
+DK_PROFILE_REGION_DEF(m_gamma_profile, "is31fl3206 gamma");
 #endif
 
 static void twi_mngr_callback(ret_code_t result, uint8_t evt, dk_twi_mngr_transfer_t *p_transfer, void *p_user_data)
 {
+    UNUSED_PARAMETER(evt);
+    UNUSED_PARAMETER(p_transfer);
+
     if (result != NRF_SUCCESS)
     {
         is31fl3206_t *p_is31fl3206 = (is31fl3206_t *)p_user_data;
@@ -50,14 +56,40 @@ static void twi_mngr_callback(ret_code_t result, uint8_t evt, dk_twi_mngr_transf
     }
 }
 
-static ret_code_t twi_write(is31fl3206_t const *p_is31fl3206, is31fl3206_twi_write_t *p_twi_write, uint8_t buffer_size)
+static ret_code_t twi_write_flags(is31fl3206_t const     *p_is31fl3206,
+                                  is31fl3206_twi_write_t *p_twi_write,
+                                  uint8_t                 buffer_size,
+                                  uint8_t                 flags)
 {
     dk_twi_mngr_transaction_t twi_transaction = {
       .callback    = twi_mngr_callback,
       .p_user_data = (void *)p_is31fl3206,
-      .transfer    = DK_TWI_MNGR_TX(p_is31fl3206->i2c_address, p_twi_write, buffer_size, 0)};
+      .transfer    = DK_TWI_MNGR_TX(p_is31fl3206->i2c_address, p_twi_write, buffer_size, 0),
+      .priority    = DK_TWI_MNGR_PRIORITY_LOW, // LED updates must not delay sensor traffic
+      .flags       = flags};
 
-    return dk_twi_mngr_schedule(p_is31fl3206->p_dk_twi_mngr_instance, &twi_transaction);
+    ret_code_t err_code = dk_twi_mngr_schedule(p_is31fl3206->p_dk_twi_mngr_instance, &twi_transaction);
+    if (err_code != NRF_SUCCESS)
+    {
+        // Transaction was not queued, buffer has to be released here.
+        dk_twi_mngr_data_buffer_free(p_is31fl3206->p_dk_twi_mngr_instance, p_twi_write);
+    }
+
+    return err_code;
+}
+
+static ret_code_t twi_write(is31fl3206_t const *p_is31fl3206, is31fl3206_twi_write_t *p_twi_write, uint8_t buffer_size)
+{
+    // Control registers (shutdown, update, reset) are written on their own, their writes act on the device.
+    return twi_write_flags(p_is31fl3206, p_twi_write, buffer_size, 0);
+}
+
+static ret_code_t twi_write_coalesce(is31fl3206_t const     *p_is31fl3206,
+                                     is31fl3206_twi_write_t *p_twi_write,
+                                     uint8_t                 buffer_size)
+{
+    // IS31FL3206 auto-increments the register address, writes to consecutive LED control registers can be merged.
+    return twi_write_flags(p_is31fl3206, p_twi_write, buffer_size, DK_TWI_MNGR_FLAG_COALESCE);
 }
 
 ret_code_t is31fl3206_init(is31fl3206_t                 *p_is31fl3206,
@@ -83,7 +115,10 @@ ret_code_t is31fl3206_init(is31fl3206_t                 *p_is31fl3206,
 
 ret_code_t is31fl3206_shutdown(is31fl3206_t *p_is31fl3206, bool shutdown)
 {
-    DK_TWI_MNGR_BUFF_ALLOC(is31fl3206_twi_write_t, p_shutdown_data, sizeof(is31fl3206_shutdown_t));
+    DK_TWI_MNGR_BUFF_ALLOC(p_is31fl3206->p_dk_twi_mngr_instance,
+                           is31fl3206_twi_write_t,
+                           p_shutdown_data,
+                           sizeof(is31fl3206_shutdown_t));
 
     p_shutdown_data->reg_address          = IS31FL3206_SHUTDOWN;
     is31fl3206_shutdown_t *p_shutdown_reg = (is31fl3206_shutdown_t *)p_shutdown_data->data;
@@ -100,22 +135,30 @@ ret_code_t is31fl3206_set_out_pwm(is31fl3206_t *p_is31fl3206, is31fl3206_out_t o
 ret_code_t is31fl3206_set_out_pwm(is31fl3206_t *p_is31fl3206, is31fl3206_out_t out, uint8_t pwm)
 #endif
 {
-    DK_TWI_MNGR_BUFF_ALLOC(is31fl3206_twi_write_t, p_pwm_data, sizeof(uint8_t));
+    DK_TWI_MNGR_BUFF_ALLOC(p_is31fl3206->p_dk_twi_mngr_instance, is31fl3206_twi_write_t, p_pwm_data, sizeof(uint8_t));
 
     p_pwm_data->reg_address = IS31FL3206_PWM0 + out;
 
 #if (DK_CHECK(DK_IS31FL3206_GAMMA_ENABLED))
+    DK_PROFILE_ENTER(m_gamma_profile);
+
     if (pwm >= sizeof(m_gamma))
     {
         pwm = sizeof(m_gamma) - 1;
     }
 
     p_pwm_data->data[0] = m_gamma[pwm];
+
+    DK_PROFILE_EXIT(m_gamma_profile);
 #else
     p_pwm_data->data[0] = pwm;
 #endif
 
-    return twi_write(p_is31fl3206, p_pwm_data, p_pwm_data_size);
+    // Only the latest PWM value matters, a newer write replaces the pending one.
+    return twi_write_flags(p_is31fl3206,
+                           p_pwm_data,
+                           p_pwm_data_size,
+                           DK_TWI_MNGR_FLAG_SUPERSEDE | DK_TWI_MNGR_FLAG_COALESCE);
 }
 
 #if (DK_CHECK(DK_IS31FL3206_GAMMA_ENABLED))
@@ -126,12 +169,17 @@ ret_code_t is31fl3206_set_all_out_pwm(is31fl3206_t             *p_is31fl3206,
 ret_code_t is31fl3206_set_all_out_pwm(is31fl3206_t *p_is31fl3206, is31fl3206_all_out_pwm_t *p_all_out_pwm)
 #endif
 {
-    DK_TWI_MNGR_BUFF_ALLOC(is31fl3206_twi_write_t, p_out_pwm_data, sizeof(is31fl3206_all_out_pwm_t));
+    DK_TWI_MNGR_BUFF_ALLOC(p_is31fl3206->p_dk_twi_mngr_instance,
+                           is31fl3206_twi_write_t,
+                           p_out_pwm_data,
+                           sizeof(is31fl3206_all_out_pwm_t));
 
     p_out_pwm_data->reg_address = IS31FL3206_PWM0;
     memcpy(p_out_pwm_data->data, p_all_out_pwm->pwm, sizeof(is31fl3206_all_out_pwm_t));
 
 #if (DK_CHECK(DK_IS31FL3206_GAMMA_ENABLED))
+    DK_PROFILE_ENTER(m_gamma_profile);
+
     for (uint8_t i = 0; i < sizeof(is31fl3206_all_out_pwm_t); i++)
     {
         if (p_out_pwm_data->data[i] >= sizeof(m_gamma))
@@ -141,14 +189,22 @@ ret_code_t is31fl3206_set_all_out_pwm(is31fl3206_t *p_is31fl3206, is31fl3206_all
 
         p_out_pwm_data->data[i] = m_gamma[p_out_pwm_data->data[i]];
     }
+
+    DK_PROFILE_EXIT(m_gamma_profile);
 #endif
 
-    return twi_write(p_is31fl3206, p_out_pwm_data, p_out_pwm_data_size);
+    return twi_write_flags(p_is31fl3206,
+                           p_out_pwm_data,
+                           p_out_pwm_data_size,
+                           DK_TWI_MNGR_FLAG_SUPERSEDE | DK_TWI_MNGR_FLAG_COALESCE);
 }
 
 ret_code_t is31fl3206_update(is31fl3206_t *p_is31fl3206)
 {
-    DK_TWI_MNGR_BUFF_ALLOC(is31fl3206_twi_write_t, p_update_data, sizeof(uint8_t));
+    DK_TWI_MNGR_BUFF_ALLOC(p_is31fl3206->p_dk_twi_mngr_instance,
+                           is31fl3206_twi_write_t,
+                           p_update_data,
+                           sizeof(uint8_t));
 
     p_update_data->reg_address = IS31FL3206_UPDATE;
     p_update_data->data[0]     = IS31FL3206_UPDATE_VAL;
@@ -160,29 +216,38 @@ ret_code_t is31fl3206_set_out_current(is31fl3206_t            *p_is31fl3206,
                                       is31fl3206_out_t         out,
                                       is31fl3206_out_current_t out_current)
 {
-    DK_TWI_MNGR_BUFF_ALLOC(is31fl3206_twi_write_t, p_out_current_data, sizeof(is31fl3206_led_ctrl_t));
+    DK_TWI_MNGR_BUFF_ALLOC(p_is31fl3206->p_dk_twi_mngr_instance,
+                           is31fl3206_twi_write_t,
+                           p_out_current_data,
+                           sizeof(is31fl3206_led_ctrl_t));
 
     p_out_current_data->reg_address          = IS31FL3206_LED_CTRL0 + out;
     is31fl3206_led_ctrl_t *p_out_current_reg = (is31fl3206_led_ctrl_t *)p_out_current_data->data;
 
     p_out_current_reg->out_current = out_current;
 
-    return twi_write(p_is31fl3206, p_out_current_data, p_out_current_data_size);
+    return twi_write_coalesce(p_is31fl3206, p_out_current_data, p_out_current_data_size);
 }
 
 ret_code_t is31fl3206_set_all_out_current(is31fl3206_t *p_is31fl3206, is31fl3206_all_out_current_t *p_all_out_current)
 {
-    DK_TWI_MNGR_BUFF_ALLOC(is31fl3206_twi_write_t, p_all_out_current_data, sizeof(is31fl3206_all_out_current_t));
+    DK_TWI_MNGR_BUFF_ALLOC(p_is31fl3206->p_dk_twi_mngr_instance,
+                           is31fl3206_twi_write_t,
+                           p_all_out_current_data,
+                           sizeof(is31fl3206_all_out_current_t));
 
     p_all_out_current_data->reg_address = IS31FL3206_LED_CTRL0;
     memcpy(p_all_out_current_data->data, p_all_out_current, sizeof(is31fl3206_all_out_current_t));
 
-    return twi_write(p_is31fl3206, p_all_out_current_data, p_all_out_current_data_size);
+    return twi_write_coalesce(p_is31fl3206, p_all_out_current_data, p_all_out_current_data_size);
 }
 
 ret_code_t is31fl3206_shutdown_outputs(is31fl3206_t *p_is31fl3206, bool shutdown_outputs)
 {
-    DK_TWI_MNGR_BUFF_ALLOC(is31fl3206_twi_write_t, p_global_ctrl_data, sizeof(is31fl3206_global_ctrl_t));
+    DK_TWI_MNGR_BUFF_ALLOC(p_is31fl3206->p_dk_twi_mngr_instance,
+                           is31fl3206_twi_write_t,
+                           p_global_ctrl_data,
+                           sizeof(is31fl3206_global_ctrl_t));
 
     p_global_ctrl_data->reg_address         = IS31FL3206_GLOBAL_CTRL;
     is31fl3206_global_ctrl_t *p_global_ctrl = (is31fl3206_global_ctrl_t *)p_global_ctrl_data->data;
@@ -196,7 +261,10 @@ ret_code_t is31fl3206_shutdown_outputs(is31fl3206_t *p_is31fl3206, bool shutdown
 
 ret_code_t is31fl3206_set_out_frequency(is31fl3206_t *p_is31fl3206, is31fl3206_ofs_t output_frequency)
 {
-    DK_TWI_MNGR_BUFF_ALLOC(is31fl3206_twi_write_t, p_out_freq_data, sizeof(is31fl3206_out_frequency_t));
+    DK_TWI_MNGR_BUFF_ALLOC(p_is31fl3206->p_dk_twi_mngr_instance,
+                           is31fl3206_twi_write_t,
+                           p_out_freq_data,
+                           sizeof(is31fl3206_out_frequency_t));
 
     p_out_freq_data->reg_address                       = IS31FL3206_OUT_FREQUENCY;
     is31fl3206_out_frequency_t *p_output_frequency_reg = (is31fl3206_out_frequency_t *)p_out_freq_data->data;
@@ -209,7 +277,7 @@ ret_code_t is31fl3206_set_out_frequency(is31fl3206_t *p_is31fl3206, is31fl3206_o
 
 ret_code_t is31fl3206_reset(is31fl3206_t *p_is31fl3206)
 {
-    DK_TWI_MNGR_BUFF_ALLOC(is31fl3206_twi_write_t, p_reset_data, sizeof(uint8_t));
+    DK_TWI_MNGR_BUFF_ALLOC(p_is31fl3206->p_dk_twi_mngr_instance, is31fl3206_twi_write_t, p_reset_data, sizeof(uint8_t));
 
     p_reset_data->reg_address = IS31FL3206_RESET;
     p_reset_data->data[0]     = IS31FL3206_RESET_VAL;
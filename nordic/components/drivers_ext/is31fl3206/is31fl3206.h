@@ -40,7 +40,7 @@ typedef enum
 
 typedef struct
 {
-    is31fl3206_out_current_t out_current : 8;
+    uint8_t out_current : 8; /**< Output current, see is31fl3206_out_current_t. */
 } is31fl3206_led_ctrl_t;
 
 typedef struct
@@ -57,8 +57,8 @@ typedef enum
 
 typedef struct
 {
-    uint8_t          _padding0 : 7;
-    is31fl3206_ofs_t ofs       : 1;
+    uint8_t _padding0 : 7;
+    uint8_t ofs       : 1; /**< Output frequency, see is31fl3206_ofs_t. */
 } is31fl3206_out_frequency_t;
 
 typedef void (*is31fl3206_error_handler_t)(ret_code_t err_code, is31fl3206_t *p_is31fl3206);
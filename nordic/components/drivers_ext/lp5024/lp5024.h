@@ -70,13 +70,13 @@ typedef struct
 /** @brief Device configuration 1 register. */
 typedef struct
 {
-    bool                 led_global_off   : 1; /**< Shut down all LEDs. */
-    lp5024_max_current_t max_current      : 1; /**< Max current setting. */
-    bool                 pwm_dithering_en : 1; /**< Enable PWM dithering. */
-    bool                 auto_incr_en     : 1; /**< Enable automatic address increment mode. */
-    bool                 power_save_en    : 1; /**< Enable automatic power-saving mode. */
-    bool                 log_scale_en     : 1; /**< Enable logarithmic scale dimming curve. */
-    uint8_t              _padding0        : 2;
+    bool    led_global_off   : 1; /**< Shut down all LEDs. */
+    uint8_t max_current      : 1; /**< Max current setting, see lp5024_max_current_t. */
+    bool    pwm_dithering_en : 1; /**< Enable PWM dithering. */
+    bool    auto_incr_en     : 1; /**< Enable automatic address increment mode. */
+    bool    power_save_en    : 1; /**< Enable automatic power-saving mode. */
+    bool    log_scale_en     : 1; /**< Enable logarithmic scale dimming curve. */
+    uint8_t _padding0        : 2;
 } lp5024_device_config1_t;
 
 /** @brief LP5024 configuration struct. Contains all configuration registers. */
@@ -11,34 +11,43 @@
 
 #include "lsm9ds1.h"
 
+#include "dk_trace.h"
 #include "lsm9ds1-internal.h"
 #include "nrf_delay.h"
 #include "nrf_log.h"
 #include "nrf_log_ctrl.h"
 
-static bool twi_read(nrfx_twi_t *i2c_instance, uint8_t i2c_address, uint8_t reg, uint8_t *data, uint8_t data_length)
+static bool twi_read(lsm9ds1_t *p_lsm9ds1, uint8_t i2c_address, uint8_t reg, uint8_t *data, uint8_t data_length)
 {
+    bool success = false;
+
+    DK_TRACE(DK_TRACE_EVT_LSM9DS1_READ_BEGIN, i2c_address, reg);
+
     if (data_length > 1)
     {
         reg |= 0x80; // Set the MSB of SUB to enable auto address increment
     }
 
-    if (nrfx_twi_tx(i2c_instance, i2c_address, &reg, sizeof(reg), true) != NRF_SUCCESS)
+    dk_twi_mngr_transfer_t twi_transfer =
+      DK_TWI_MNGR_TX_RX(i2c_address, &reg, sizeof(reg), data, data_length, DK_TWI_MNGR_XFER_FLAG_TX_NO_STOP);
+
+    if (dk_twi_mngr_mux_perform_timeout(p_lsm9ds1->p_dk_twi_mngr_instance,
+                                        p_lsm9ds1->mux_channels,
+                                        &twi_transfer,
+                                        DK_TWI_MNGR_PERFORM_TIMEOUT_MS) != NRF_SUCCESS)
     {
-        NRF_LOG_WARNING("Failed to write twi");
-        return false;
+        NRF_LOG_WARNING("Failed to read twi");
     } else
     {
-        if (nrfx_twi_rx(i2c_instance, i2c_address, data, data_length) != NRF_SUCCESS)
-        {
-            NRF_LOG_WARNING("Failed to read twi");
-            return false;
-        }
+        success = true;
     }
-    return true;
+
+    DK_TRACE(DK_TRACE_EVT_LSM9DS1_READ_END, i2c_address, success);
+
+    return success;
 }
 
-static bool twi_write(nrfx_twi_t *i2c_instance, uint8_t i2c_address, uint8_t reg, uint8_t *data, uint8_t data_length)
+static bool twi_write(lsm9ds1_t *p_lsm9ds1, uint8_t i2c_address, uint8_t reg, uint8_t *data, uint8_t data_length)
 {
     uint8_t tx_data[6];
 
@@ -53,7 +62,12 @@ static bool twi_write(nrfx_twi_t *i2c_instance, uint8_t i2c_address, uint8_t reg
 
     data_length++;
 
-    if (nrfx_twi_tx(i2c_instance, i2c_address, tx_data, data_length, false) != NRF_SUCCESS)
+    dk_twi_mngr_transfer_t twi_transfer = DK_TWI_MNGR_TX(i2c_address, tx_data, data_length, 0);
+
+    if (dk_twi_mngr_mux_perform_timeout(p_lsm9ds1->p_dk_twi_mngr_instance,
+                                        p_lsm9ds1->mux_channels,
+                                        &twi_transfer,
+                                        DK_TWI_MNGR_PERFORM_TIMEOUT_MS) != NRF_SUCCESS)
     {
         NRF_LOG_WARNING("Failed to write twi");
         return false;
@@ -63,7 +77,7 @@ static bool twi_write(nrfx_twi_t *i2c_instance, uint8_t i2c_address, uint8_t reg
 
 static bool write_acc_gyr_reg(lsm9ds1_t *p_lsm9ds1, uint8_t reg, uint8_t data)
 {
-    if (!twi_write(p_lsm9ds1->i2c_instance, p_lsm9ds1->acc_gyr_i2c_address, reg, &data, sizeof(data)))
+    if (!twi_write(p_lsm9ds1, p_lsm9ds1->acc_gyr_i2c_address, reg, &data, sizeof(data)))
     {
         NRF_LOG_WARNING("Could not configure LSM9DS1 at i2c address: 0x%x", p_lsm9ds1->acc_gyr_i2c_address);
         return false;
@@ -73,7 +87,7 @@ static bool write_acc_gyr_reg(lsm9ds1_t *p_lsm9ds1, uint8_t reg, uint8_t data)
 
 static bool write_mag_reg(lsm9ds1_t *p_lsm9ds1, uint8_t reg, uint8_t data)
 {
-    if (!twi_write(p_lsm9ds1->i2c_instance, p_lsm9ds1->mag_i2c_address, reg, &data, sizeof(data)))
+    if (!twi_write(p_lsm9ds1, p_lsm9ds1->mag_i2c_address, reg, &data, sizeof(data)))
     {
         NRF_LOG_WARNING("Could not configure LSM9DS1 at i2c address: 0x%x", p_lsm9ds1->mag_i2c_address);
         return false;
@@ -85,11 +99,7 @@ bool lsm9ds1_init(lsm9ds1_t *p_lsm9ds1)
 {
     uint8_t data;
 
-    if (twi_read(p_lsm9ds1->i2c_instance,
-                 p_lsm9ds1->acc_gyr_i2c_address,
-                 LSM9DS1_ACC_GYR_WHO_AM_I_REG,
-                 &data,
-                 sizeof(data)))
+    if (twi_read(p_lsm9ds1, p_lsm9ds1->acc_gyr_i2c_address, LSM9DS1_ACC_GYR_WHO_AM_I_REG, &data, sizeof(data)))
     {
         if (data == LSM9DS1_ACC_GYR_WHO_AM_I)
         {
@@ -106,7 +116,7 @@ bool lsm9ds1_init(lsm9ds1_t *p_lsm9ds1)
         return false;
     }
 
-    if (twi_read(p_lsm9ds1->i2c_instance, p_lsm9ds1->mag_i2c_address, LSM9DS1_MAG_WHO_AM_I_REG, &data, sizeof(data)))
+    if (twi_read(p_lsm9ds1, p_lsm9ds1->mag_i2c_address, LSM9DS1_MAG_WHO_AM_I_REG, &data, sizeof(data)))
     {
         if (data == LSM9DS1_MAG_WHO_AM_I)
         {
@@ -175,7 +185,7 @@ bool lsm9ds1_reset(lsm9ds1_t *p_lsm9ds1)
 
 bool lsm9ds1_read_acc(lsm9ds1_t *p_lsm9ds1, lsm9ds1_acc_data_t *p_lsm9ds1_acc_data)
 {
-    return twi_read(p_lsm9ds1->i2c_instance,
+    return twi_read(p_lsm9ds1,
                     p_lsm9ds1->acc_gyr_i2c_address,
                     LSM9DS1_OUT_X_L_XL,
                     (uint8_t *)p_lsm9ds1_acc_data,
@@ -184,7 +194,7 @@ bool lsm9ds1_read_acc(lsm9ds1_t *p_lsm9ds1, lsm9ds1_acc_data_t *p_lsm9ds1_acc_da
 
 bool lsm9ds1_read_gyr(lsm9ds1_t *p_lsm9ds1, lsm9ds1_gyr_data_t *p_lsm9ds1_gyr_data)
 {
-    return twi_read(p_lsm9ds1->i2c_instance,
+    return twi_read(p_lsm9ds1,
                     p_lsm9ds1->acc_gyr_i2c_address,
                     LSM9DS1_OUT_X_L_G,
                     (uint8_t *)p_lsm9ds1_gyr_data,
@@ -193,7 +203,7 @@ bool lsm9ds1_read_gyr(lsm9ds1_t *p_lsm9ds1, lsm9ds1_gyr_data_t *p_lsm9ds1_gyr_da
 
 bool lsm9ds1_read_mag(lsm9ds1_t *p_lsm9ds1, lsm9ds1_mag_data_t *p_lsm9ds1_mag_data)
 {
-    return twi_read(p_lsm9ds1->i2c_instance,
+    return twi_read(p_lsm9ds1,
                     p_lsm9ds1->mag_i2c_address,
                     LSM9DS1_OUT_X_L_M,
                     (uint8_t *)p_lsm9ds1_mag_data,
@@ -202,29 +212,17 @@ bool lsm9ds1_read_mag(lsm9ds1_t *p_lsm9ds1, lsm9ds1_mag_data_t *p_lsm9ds1_mag_da
 
 bool lsm9ds1_read_acc_gyr_status(lsm9ds1_t *p_lsm9ds1, uint8_t *status)
 {
-    return twi_read(p_lsm9ds1->i2c_instance,
-                    p_lsm9ds1->acc_gyr_i2c_address,
-                    LSM9DS1_STATUS_REG,
-                    status,
-                    sizeof(uint8_t));
+    return twi_read(p_lsm9ds1, p_lsm9ds1->acc_gyr_i2c_address, LSM9DS1_STATUS_REG, status, sizeof(uint8_t));
 }
 
 bool lsm9ds1_read_acc_int_src(lsm9ds1_t *p_lsm9ds1, uint8_t *int_src)
 {
-    return twi_read(p_lsm9ds1->i2c_instance,
-                    p_lsm9ds1->acc_gyr_i2c_address,
-                    LSM9DS1_INT_GEN_SRC_XL,
-                    int_src,
-                    sizeof(uint8_t));
+    return twi_read(p_lsm9ds1, p_lsm9ds1->acc_gyr_i2c_address, LSM9DS1_INT_GEN_SRC_XL, int_src, sizeof(uint8_t));
 }
 
 bool lsm9ds1_read_gyro_int_src(lsm9ds1_t *p_lsm9ds1, uint8_t *int_src)
 {
-    return twi_read(p_lsm9ds1->i2c_instance,
-                    p_lsm9ds1->acc_gyr_i2c_address,
-                    LSM9DS1_INT_GEN_SRC_G,
-                    int_src,
-                    sizeof(uint8_t));
+    return twi_read(p_lsm9ds1, p_lsm9ds1->acc_gyr_i2c_address, LSM9DS1_INT_GEN_SRC_G, int_src, sizeof(uint8_t));
 }
 
 bool lsm9ds1_enable_acc(lsm9ds1_t *p_lsm9ds1, lsm9ds1_acc_config_t *p_lsm9ds1_acc_config)
@@ -412,7 +410,7 @@ bool lsm9ds1_set_mag_alert_threshold(lsm9ds1_t *p_lsm9ds1, uint16_t threshold)
 
 bool lsm9ds1_read_mag_int_src(lsm9ds1_t *p_lsm9ds1, uint8_t *int_src)
 {
-    return twi_read(p_lsm9ds1->i2c_instance, p_lsm9ds1->mag_i2c_address, LSM9DS1_INT_SRC_M, int_src, sizeof(uint8_t));
+    return twi_read(p_lsm9ds1, p_lsm9ds1->mag_i2c_address, LSM9DS1_INT_SRC_M, int_src, sizeof(uint8_t));
 }
 
 bool lsm9ds1_mag_power_down(lsm9ds1_t *p_lsm9ds1)
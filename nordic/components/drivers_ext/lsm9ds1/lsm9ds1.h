@@ -14,7 +14,7 @@
 
 #include <stdint.h>
 
-#include "nrfx_twi.h"
+#include "dk_twi_mngr.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -167,9 +167,10 @@ typedef struct
  */
 typedef struct
 {
-    nrfx_twi_t          *i2c_instance;        /**<  Pointer to I2C instance device is connected to */
-    uint8_t              acc_gyr_i2c_address; /**<  Accelerometer & Gyro I2C address */
-    uint8_t              mag_i2c_address;     /**<  Magnetometer I2C address */
+    const dk_twi_mngr_t *p_dk_twi_mngr_instance; /**<  Pointer to TWI manager instance device is connected to */
+    uint8_t              mux_channels;           /**<  Bus mux channels device is behind, 0 if not behind the mux */
+    uint8_t              acc_gyr_i2c_address;    /**<  Accelerometer & Gyro I2C address */
+    uint8_t              mag_i2c_address;        /**<  Magnetometer I2C address */
     lsm9ds1_status_t     sensor_status;
     bool                 int_1;
     bool                 int_2;
@@ -180,10 +181,20 @@ typedef struct
     lsm9ds1_mag_config_t mag_config;
 } lsm9ds1_t;
 
-#define LSM9DS1_DEF(_name, _p_i2c_instance, _acc_gyr_i2c_address, _mag_i2c_address)                                    \
-    static lsm9ds1_t _name = {.i2c_instance        = _p_i2c_instance,                                                  \
-                              .acc_gyr_i2c_address = _acc_gyr_i2c_address,                                             \
-                              .mag_i2c_address     = _mag_i2c_address}
+/**@brief   Macro for defining a LSM9DS1 instance.
+ *
+ * @param   _name                   Name of the instance.
+ * @param   _p_dk_twi_mngr_instance Pointer to TWI manager instance.
+ * @param   _mux_channels           Bus mux channels the device is behind (e.g. TCA9548A_CHANNEL6), 0 if none.
+ * @param   _acc_gyr_i2c_address    Accelerometer & Gyro I2C address.
+ * @param   _mag_i2c_address        Magnetometer I2C address.
+ * @hideinitializer
+ */
+#define LSM9DS1_DEF(_name, _p_dk_twi_mngr_instance, _mux_channels, _acc_gyr_i2c_address, _mag_i2c_address)            \
+    static lsm9ds1_t _name = {.p_dk_twi_mngr_instance = _p_dk_twi_mngr_instance,                                       \
+                              .mux_channels           = _mux_channels,                                                 \
+                              .acc_gyr_i2c_address    = _acc_gyr_i2c_address,                                          \
+                              .mag_i2c_address        = _mag_i2c_address}
 
 bool lsm9ds1_init(lsm9ds1_t *p_lsm9ds1);
 
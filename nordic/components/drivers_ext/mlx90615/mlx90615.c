@@ -11,8 +11,9 @@
 
 #include "mlx90615.h"
 
+#include "dk_profile.h"
+#include "dk_trace.h"
 #include "mlx90615-internal.h"
-#include "nrf_delay.h"
 
 #define NRF_LOG_MODULE_NAME mlx90615
 #include "nrf_log.h"
@@ -50,6 +51,8 @@ typedef struct
  */
 #define RAW_TO_CELSIUS_INT8(p_raw_data) (int8_t) RAW_TO_CELSIUS_FLOAT(p_raw_data)
 
+DK_PROFILE_REGION_DEF(m_raw_to_celsius_profile, "RAW_TO_CELSIUS_FLOAT");
+
 /**
  * @brief       Function to be called by twi manager upon twi transaction result.
  *
@@ -71,6 +74,8 @@ static void twi_mngr_callback(ret_code_t result, uint8_t evt, dk_twi_mngr_transf
 
     mlx90615_evt_t mlx90615_evt = {.p_mlx90615 = p_mlx90615, .type = evt};
 
+    DK_TRACE(DK_TRACE_EVT_MLX90615_CALLBACK, evt, result);
+
     if (result != NRF_SUCCESS)
     {
         NRF_LOG_ERROR("Error: 0x%x", result);
@@ -97,8 +102,12 @@ static void twi_mngr_callback(ret_code_t result, uint8_t evt, dk_twi_mngr_transf
                 break;
             case MLX90615_EVT_TYPE_AMB_TEMP_FLOAT_READY:
             case MLX90615_EVT_TYPE_OBJ_TEMP_FLOAT_READY:
+            {
+                DK_PROFILE_ENTER(m_raw_to_celsius_profile);
                 mlx90615_evt.params.float_temp = RAW_TO_CELSIUS_FLOAT(p_transfer->transfer_description.p_secondary_buf);
+                DK_PROFILE_EXIT(m_raw_to_celsius_profile);
                 break;
+            }
             default:
                 break;
         }
@@ -127,16 +136,18 @@ static ret_code_t twi_write(mlx90615_t const     *p_mlx90615,
       .callback    = twi_mngr_callback,
       .p_user_data = (void *)p_mlx90615,
       .event_type  = evt_type,
-      .transfer    = DK_TWI_MNGR_TX(MLX90615_SLAVE_ADDRESS, (uint8_t *)p_twi_write, write_size, 0)};
+      .transfer    = DK_TWI_MNGR_TX(MLX90615_SLAVE_ADDRESS, (uint8_t *)p_twi_write, write_size, 0),
+      .flags       = DK_TWI_MNGR_FLAG_DEFERRED_CB};
 
-    return dk_twi_mngr_schedule(p_mlx90615->p_dk_twi_mngr_instance, &twi_transaction);
-}
+    ret_code_t err_code = dk_twi_mngr_schedule(p_mlx90615->p_dk_twi_mngr_instance, &twi_transaction);
+    if (err_code != NRF_SUCCESS)
+    {
+        // Transaction was not queued, buffer has to be released here.
+        dk_twi_mngr_data_buffer_free(p_mlx90615->p_dk_twi_mngr_instance, p_twi_write);
+    }
 
-/**
- * @brief   Function to be called by dk_twi_mngr when waiting for a transfer to finish.
- *          Just waits for one millisecond.
- */
-static void wait_for_transfer_complete() { nrf_delay_ms(1); }
+    return err_code;
+}
 
 /**
  * @brief       Perform a blocking twi read.
@@ -149,14 +160,15 @@ static void wait_for_transfer_complete() { nrf_delay_ms(1); }
  * @param[in]   buffer_size Read buffer size.
  *
  * @return      NRF_SUCCESS Upon successful twi transaction.
- * @return      Other       Error codes returned by @dk_twi_mngr_perform function.
+ * @return      Other       Error codes returned by @dk_twi_mngr_perform_timeout function.
  */
 static ret_code_t twi_read_blocking(mlx90615_t const *p_mlx90615, uint8_t reg, uint8_t *p_buffer, uint8_t buffer_size)
 {
-    dk_twi_mngr_transfer_t twi_transfer =
-      DK_TWI_MNGR_TX_RX(MLX90615_SLAVE_ADDRESS, &reg, sizeof(reg), p_buffer, buffer_size, NRFX_TWI_FLAG_TX_NO_STOP);
+    dk_twi_mngr_transfer_t twi_transfer = DK_TWI_MNGR_TX_RX(
+      MLX90615_SLAVE_ADDRESS, &reg, sizeof(reg), p_buffer, buffer_size, DK_TWI_MNGR_XFER_FLAG_TX_NO_STOP);
 
-    return dk_twi_mngr_perform(p_mlx90615->p_dk_twi_mngr_instance, &twi_transfer, wait_for_transfer_complete);
+    return dk_twi_mngr_perform_timeout(
+      p_mlx90615->p_dk_twi_mngr_instance, &twi_transfer, DK_TWI_MNGR_PERFORM_TIMEOUT_MS);
 }
 
 /**
@@ -188,17 +200,27 @@ static ret_code_t twi_read(mlx90615_t const    *p_mlx90615,
                            uint8_t              read_size,
                            mlx90615_evt_type_t  evt_type)
 {
-    dk_twi_mngr_transaction_t twi_transaction = {.callback    = twi_mngr_callback,
-                                                 .p_user_data = (void *)p_mlx90615,
-                                                 .event_type  = evt_type,
-                                                 .transfer    = DK_TWI_MNGR_TX_RX(MLX90615_SLAVE_ADDRESS,
-                                                                               &p_twi_read->reg_address,
-                                                                               sizeof(p_twi_read->reg_address),
-                                                                               p_twi_read->data,
-                                                                               read_size - 1,
-                                                                               0)};
-
-    return dk_twi_mngr_schedule(p_mlx90615->p_dk_twi_mngr_instance, &twi_transaction);
+    // Several consumers may poll the same register, identical queued reads are served by a single bus read.
+    dk_twi_mngr_transaction_t twi_transaction = {
+      .callback    = twi_mngr_callback,
+      .p_user_data = (void *)p_mlx90615,
+      .event_type  = evt_type,
+      .transfer    = DK_TWI_MNGR_TX_RX(MLX90615_SLAVE_ADDRESS,
+                                    &p_twi_read->reg_address,
+                                    sizeof(p_twi_read->reg_address),
+                                    p_twi_read->data,
+                                    read_size - 1,
+                                    0),
+      .flags       = DK_TWI_MNGR_FLAG_DEFERRED_CB | DK_TWI_MNGR_FLAG_SHARED_READ};
+
+    ret_code_t err_code = dk_twi_mngr_schedule(p_mlx90615->p_dk_twi_mngr_instance, &twi_transaction);
+    if (err_code != NRF_SUCCESS)
+    {
+        // Transaction was not queued, buffer has to be released here.
+        dk_twi_mngr_data_buffer_free(p_mlx90615->p_dk_twi_mngr_instance, p_twi_read);
+    }
+
+    return err_code;
 }
 
 ret_code_t mlx90615_init(mlx90615_t *p_mlx90615, mlx90615_evt_handler_t evt_handler)
@@ -221,7 +243,7 @@ ret_code_t mlx90615_init(mlx90615_t *p_mlx90615, mlx90615_evt_handler_t evt_hand
 
 ret_code_t mlx90615_read_amb_temp_int8(mlx90615_t *p_mlx90615)
 {
-    DK_TWI_MNGR_BUFF_ALLOC(mlx90615_twi_read_t, p_amb_read, sizeof(uint16_t));
+    DK_TWI_MNGR_BUFF_ALLOC(p_mlx90615->p_dk_twi_mngr_instance, mlx90615_twi_read_t, p_amb_read, sizeof(uint16_t));
 
     p_amb_read->reg_address = MLX90615_CMD_RAM_T_AMB;
 
@@ -230,7 +252,7 @@ ret_code_t mlx90615_read_amb_temp_int8(mlx90615_t *p_mlx90615)
 
 ret_code_t mlx90615_read_obj_temp_int8(mlx90615_t *p_mlx90615)
 {
-    DK_TWI_MNGR_BUFF_ALLOC(mlx90615_twi_read_t, p_obj_read, sizeof(uint16_t));
+    DK_TWI_MNGR_BUFF_ALLOC(p_mlx90615->p_dk_twi_mngr_instance, mlx90615_twi_read_t, p_obj_read, sizeof(uint16_t));
 
     p_obj_read->reg_address = MLX90615_CMD_RAM_T_OBJ;
 
@@ -239,7 +261,7 @@ ret_code_t mlx90615_read_obj_temp_int8(mlx90615_t *p_mlx90615)
 
 ret_code_t mlx90615_read_amb_temp_float(mlx90615_t *p_mlx90615)
 {
-    DK_TWI_MNGR_BUFF_ALLOC(mlx90615_twi_read_t, p_amb_read, sizeof(uint16_t));
+    DK_TWI_MNGR_BUFF_ALLOC(p_mlx90615->p_dk_twi_mngr_instance, mlx90615_twi_read_t, p_amb_read, sizeof(uint16_t));
 
     p_amb_read->reg_address = MLX90615_CMD_RAM_T_AMB;
 
@@ -248,7 +270,7 @@ ret_code_t mlx90615_read_amb_temp_float(mlx90615_t *p_mlx90615)
 
 ret_code_t mlx90615_read_obj_temp_float(mlx90615_t *p_mlx90615)
 {
-    DK_TWI_MNGR_BUFF_ALLOC(mlx90615_twi_read_t, p_obj_read, sizeof(uint16_t));
+    DK_TWI_MNGR_BUFF_ALLOC(p_mlx90615->p_dk_twi_mngr_instance, mlx90615_twi_read_t, p_obj_read, sizeof(uint16_t));
 
     p_obj_read->reg_address = MLX90615_CMD_RAM_T_OBJ;
 
@@ -257,7 +279,10 @@ ret_code_t mlx90615_read_obj_temp_float(mlx90615_t *p_mlx90615)
 
 ret_code_t mlx90615_sleep_mode_enter(mlx90615_t *p_mlx90615)
 {
-    DK_TWI_MNGR_BUFF_ALLOC(mlx90615_twi_write_t, p_sleep_cmd, sizeof(uint8_t));
+    // Queued reads would fail once the sensor sleeps, drop them instead of wasting bus time.
+    (void)dk_twi_mngr_cancel(p_mlx90615->p_dk_twi_mngr_instance, p_mlx90615, false);
+
+    DK_TWI_MNGR_BUFF_ALLOC(p_mlx90615->p_dk_twi_mngr_instance, mlx90615_twi_write_t, p_sleep_cmd, sizeof(uint8_t));
 
     p_sleep_cmd->reg_address = MLX90615_CMD_ENTER_SLEEP;
     p_sleep_cmd->data[0]     = MLX90615_CMD_ENTER_SLEEP_PEC;
@@ -118,6 +118,8 @@ ret_code_t mlx90615_read_obj_temp_float(mlx90615_t *p_mlx90615);
 /**
  * @brief       Enter sleep mode.
  *
+ * @details     Queued reads of the instance are cancelled without calling the event handler.
+ *
  * @param[in]   p_mlx90615  Pointer to MLX90615 instance.
  *
  * @retval      NRF_SUCCESS On success.
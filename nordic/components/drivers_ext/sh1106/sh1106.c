@@ -11,6 +11,7 @@
 
 #include "sh1106.h"
 
+#include "dk_profile.h"
 #include "nrf_delay.h"
 #include "sdk_macros.h"
 #include "sh1106-internal.h"
@@ -20,17 +21,37 @@
 #include "nrf_log.h"
 NRF_LOG_MODULE_REGISTER();
 
+STATIC_ASSERT(SH1106_PAGE_COUNT == SH1106_PAGE_AMOUNT);
+
+static dk_spi_mngr_transaction_t transaction_get(sh1106_t *p_sh1106, const uint8_t *p_data, uint16_t size, bool data)
+{
+    dk_spi_mngr_transaction_t transaction = {.xfer_desc = DK_SPI_MNGR_XFER_TX(p_data, size),
+                                             .cs_pin    = (uint8_t)p_sh1106->cs_pin,
+                                             .dc_pin    = (uint8_t)p_sh1106->dc_pin,
+                                             .dc_state  = data};
+
+    return transaction;
+}
+
 static ret_code_t write(sh1106_t *p_sh1106, const uint8_t *p_data, uint8_t data_size, bool data)
 {
-    ret_code_t           err_code;
-    nrfx_spi_xfer_desc_t xfer = NRFX_SPI_XFER_TX(p_data, data_size);
+    // Chip select and data/command pins are driven by the SPI manager.
+    dk_spi_mngr_transaction_t transaction = transaction_get(p_sh1106, p_data, data_size, data);
 
-    nrf_gpio_pin_write(p_sh1106->dc_pin, (uint32_t)data);
-    nrf_gpio_pin_clear(p_sh1106->cs_pin);
-    err_code = nrfx_spi_xfer(p_sh1106->p_spi_instance, &xfer, 0);
-    nrf_gpio_pin_set(p_sh1106->cs_pin);
+    return dk_spi_mngr_perform(p_sh1106->p_dk_spi_mngr_instance, &transaction);
+}
 
-    return err_code;
+static void address_cmd_init(sh1106_t *p_sh1106)
+{
+    uint8_t column_address = MIN(p_sh1106->column_offset, SH1106_COLUMN_ID_MAX);
+
+    for (uint8_t page = 0; page < SH1106_PAGE_COUNT; page++)
+    {
+        p_sh1106->address_cmd[page][0] = SH1106_CMD_PAGE_ADDRESS | page;
+        p_sh1106->address_cmd[page][1] = SH1106_CMD_COLUMN_ADDRESS_LOW | (column_address & SH1106_COLUMN_ADDRESS_MASK);
+        p_sh1106->address_cmd[page][2] =
+          SH1106_CMD_COLUMN_ADDRESS_HIGH | (column_address >> SH1106_COLUMN_ADDRESS_BITS);
+    }
 }
 
 ret_code_t sh1106_init(sh1106_t *p_sh1106)
@@ -43,6 +64,8 @@ ret_code_t sh1106_init(sh1106_t *p_sh1106)
     nrf_gpio_pin_set(p_sh1106->cs_pin);
     nrf_gpio_pin_set(p_sh1106->reset_pin);
 
+    address_cmd_init(p_sh1106);
+
     sh1106_set_display_on(p_sh1106, false);
 
     sh1106_clk_freq_t clk_freq = {.osc_freq = SH1106_OSC_FREQ_15, .clk_div = 0};
@@ -58,16 +81,15 @@ ret_code_t sh1106_init(sh1106_t *p_sh1106)
 
     sh1106_set_dc_dc_on(p_sh1106, false);
 
-    uint8_t zero = 0;
+    // One transfer clears a whole page. The buffer is not const, so it is placed in RAM where EasyDMA can read it.
+    static uint8_t zero[SH1106_MAX_WIDTH] = {0};
     for (uint8_t page = 0; page < SH1106_PAGE_AMOUNT; page++)
     {
         sh1106_set_page_address(p_sh1106, page);
         sh1106_set_column_address(p_sh1106, 0);
 
-        for (uint8_t column = 0; column < p_sh1106->width; column++)
-        {
-            write(p_sh1106, &zero, sizeof(zero), true);
-        }
+        ret_code_t err_code = write(p_sh1106, zero, (uint8_t)MIN(p_sh1106->width, sizeof(zero)), true);
+        VERIFY_SUCCESS(err_code);
     }
 
     sh1106_set_display_on(p_sh1106, true);
@@ -225,18 +247,56 @@ ret_code_t sh1106_exit_read_modify_write_mode(sh1106_t *p_sh1106)
     return write(p_sh1106, &read_modify_write_exit_cmd, sizeof(read_modify_write_exit_cmd), false);
 }
 
-ret_code_t sh1106_write_data(sh1106_t *p_sh1106, const uint8_t *p_data, uint16_t size)
+DK_PROFILE_REGION_DEF(m_write_data_profile, "sh1106_write_data");
+
+/**
+ * @brief       Schedule the address command and the data of every page of a frame.
+ *
+ * @param[in]   p_sh1106    Pointer to sh1106 instance.
+ * @param[in]   p_data      Pointer to frame data.
+ * @param[in]   callback    Function called after the last page.
+ * @param[in]   p_user_data Pointer passed to @p callback.
+ *
+ * @return      Error code returned by @ref dk_spi_mngr_schedule.
+ */
+static ret_code_t frame_schedule(sh1106_t              *p_sh1106,
+                                 const uint8_t         *p_data,
+                                 dk_spi_mngr_callback_t callback,
+                                 void                  *p_user_data)
 {
-    uint16_t index = 0;
-    for (uint8_t page = 0; page < SH1106_PAGE_AMOUNT; page++)
-    {
-        sh1106_set_page_address(p_sh1106, page);
-        sh1106_set_column_address(p_sh1106, 0);
+    dk_spi_mngr_transaction_t transactions[SH1106_PAGE_COUNT * 2];
+    uint16_t                  index = 0;
 
-        write(p_sh1106, &p_data[index], p_sh1106->width, true);
+    for (uint8_t page = 0; page < SH1106_PAGE_COUNT; page++)
+    {
+        transactions[page * 2] = transaction_get(p_sh1106, p_sh1106->address_cmd[page], SH1106_ADDRESS_CMD_SIZE, false);
+        transactions[(page * 2) + 1] = transaction_get(p_sh1106, &p_data[index], p_sh1106->width, true);
 
         index += p_sh1106->width;
     }
 
-    return NRF_SUCCESS;
+    // The queue keeps the order, so the last page finishes the frame.
+    transactions[ARRAY_SIZE(transactions) - 1].callback    = callback;
+    transactions[ARRAY_SIZE(transactions) - 1].p_user_data = p_user_data;
+
+    // A full queue rejects the whole frame instead of leaving a part of it on the display.
+    return dk_spi_mngr_schedule_multiple(p_sh1106->p_dk_spi_mngr_instance, transactions, ARRAY_SIZE(transactions));
+}
+
+ret_code_t sh1106_write_data(sh1106_t              *p_sh1106,
+                             const uint8_t         *p_data,
+                             uint16_t               size,
+                             dk_spi_mngr_callback_t callback,
+                             void                  *p_user_data)
+{
+    if (size < (p_sh1106->width * SH1106_PAGE_COUNT))
+    {
+        return NRF_ERROR_INVALID_LENGTH;
+    }
+
+    DK_PROFILE_ENTER(m_write_data_profile);
+    ret_code_t err_code = frame_schedule(p_sh1106, p_data, callback, p_user_data);
+    DK_PROFILE_EXIT(m_write_data_profile);
+
+    return err_code;
 }
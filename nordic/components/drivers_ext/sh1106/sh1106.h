@@ -12,11 +12,13 @@
 #ifndef SH1106_H
 #define SH1106_H
 
+#include "dk_spi_mngr.h"
 #include "nrf_gpio.h"
-#include "nrfx_spi.h"
 #include "sdk_errors.h"
 
-#define SH1106_MAX_WIDTH 132
+#define SH1106_MAX_WIDTH        132
+#define SH1106_PAGE_COUNT       8 ///< Display RAM pages of 8 lines each.
+#define SH1106_ADDRESS_CMD_SIZE 3 ///< Page address and two column address command bytes.
 
 typedef enum
 {
@@ -79,23 +81,24 @@ typedef struct
 
 typedef struct
 {
-    nrfx_spi_t *p_spi_instance;
-    uint32_t    reset_pin;
-    uint32_t    cs_pin;
-    uint32_t    dc_pin;
-    uint16_t    width;
-    uint8_t     height;
-    uint8_t     column_offset;
+    dk_spi_mngr_t const *p_dk_spi_mngr_instance;
+    uint32_t             reset_pin;
+    uint32_t             cs_pin;
+    uint32_t             dc_pin;
+    uint16_t             width;
+    uint8_t              height;
+    uint8_t              column_offset;
+    uint8_t              address_cmd[SH1106_PAGE_COUNT][SH1106_ADDRESS_CMD_SIZE]; ///< Start of every page, in RAM.
 } sh1106_t;
 
-#define SH1106_DEF(_name, _p_spi_instance, _rst_pin, _cs_pin, _dc_pin, _width, _height)                                \
-    static sh1106_t _name = {.p_spi_instance = _p_spi_instance,                                                        \
-                             .reset_pin      = _rst_pin,                                                               \
-                             .cs_pin         = _cs_pin,                                                                \
-                             .dc_pin         = _dc_pin,                                                                \
-                             .width          = _width,                                                                 \
-                             .height         = _height,                                                                \
-                             .column_offset  = (SH1106_MAX_WIDTH - _width) / 2}
+#define SH1106_DEF(_name, _p_dk_spi_mngr_instance, _rst_pin, _cs_pin, _dc_pin, _width, _height)                        \
+    static sh1106_t _name = {.p_dk_spi_mngr_instance = _p_dk_spi_mngr_instance,                                        \
+                             .reset_pin              = _rst_pin,                                                       \
+                             .cs_pin                 = _cs_pin,                                                        \
+                             .dc_pin                 = _dc_pin,                                                        \
+                             .width                  = _width,                                                         \
+                             .height                 = _height,                                                        \
+                             .column_offset          = (SH1106_MAX_WIDTH - _width) / 2}
 
 ret_code_t sh1106_init(sh1106_t *p_sh1106);
 
@@ -137,6 +140,29 @@ ret_code_t sh1106_enter_read_modify_write_mode(sh1106_t *p_sh1106);
 
 ret_code_t sh1106_exit_read_modify_write_mode(sh1106_t *p_sh1106);
 
-ret_code_t sh1106_write_data(sh1106_t *p_sh1106, const uint8_t *p_data, uint16_t size);
+/**
+ * @brief       Write a frame to the display RAM without blocking.
+ *
+ * @details     Every page is sent as a page/column address command followed by its data. The transfers are queued in
+ *              the SPI manager, so other devices on the bus are served in between.
+ *
+ * @note        The frame must stay valid (and in RAM when SPIM is used) until the callback is called.
+ *
+ * @param[in]   p_sh1106    Pointer to driver instance.
+ * @param[in]   p_data      Frame, SH1106_PAGE_COUNT pages of width bytes.
+ * @param[in]   size        Size of the frame in bytes.
+ * @param[in]   callback    Function called when the whole frame was written (can be NULL).
+ * @param[in]   p_user_data Pointer to user data to be passed to the callback.
+ *
+ * @retval      NRF_SUCCESS                 If the frame was queued.
+ * @retval      NRF_ERROR_INVALID_LENGTH    If the frame is smaller than the display.
+ * @retval      NRF_ERROR_NO_MEM            If the SPI manager queue has no room for the whole frame, nothing was
+ *                                          queued. The queue needs 2 * SH1106_PAGE_COUNT free slots.
+ */
+ret_code_t sh1106_write_data(sh1106_t              *p_sh1106,
+                             const uint8_t         *p_data,
+                             uint16_t               size,
+                             dk_spi_mngr_callback_t callback,
+                             void                  *p_user_data);
 
 #endif // SH1106_H
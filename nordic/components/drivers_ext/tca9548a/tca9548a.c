@@ -11,8 +11,46 @@
 
 #include "tca9548a.h"
 
+#define NRF_LOG_MODULE_NAME TCA9548A
+#include "nrf_log.h"
+NRF_LOG_MODULE_REGISTER();
+
+static void twi_mngr_callback(ret_code_t result, uint8_t evt, dk_twi_mngr_transfer_t *p_transfer, void *p_user_data)
+{
+    UNUSED_PARAMETER(evt);
+    UNUSED_PARAMETER(p_transfer);
+    UNUSED_PARAMETER(p_user_data);
+
+    if (result != NRF_SUCCESS)
+    {
+        NRF_LOG_ERROR("Error: 0x%x", result);
+    }
+}
+
+ret_code_t tca9548a_init(tca9548a_t *p_tca9548a)
+{
+    dk_twi_mngr_mux_set(p_tca9548a->p_dk_twi_mngr_instance, p_tca9548a->i2c_address);
+
+    return NRF_SUCCESS;
+}
+
 ret_code_t tca9548a_enable_channel(tca9548a_t *p_tca9548a, tca9548a_channel_enable_t channel)
 {
-    uint8_t data = channel;
-    return nrfx_twi_tx(p_tca9548a->p_i2c_instance, p_tca9548a->i2c_address, &data, sizeof(data), false);
+    DK_TWI_MNGR_BUFF_ALLOC(p_tca9548a->p_dk_twi_mngr_instance, uint8_t, p_data, 0);
+
+    *p_data = channel;
+
+    dk_twi_mngr_transaction_t twi_transaction = {
+      .callback    = twi_mngr_callback,
+      .p_user_data = (void *)p_tca9548a,
+      .transfer    = DK_TWI_MNGR_TX(p_tca9548a->i2c_address, p_data, p_data_size, 0)};
+
+    ret_code_t err_code = dk_twi_mngr_schedule(p_tca9548a->p_dk_twi_mngr_instance, &twi_transaction);
+    if (err_code != NRF_SUCCESS)
+    {
+        // Transaction was not queued, buffer has to be released here.
+        dk_twi_mngr_data_buffer_free(p_tca9548a->p_dk_twi_mngr_instance, p_data);
+    }
+
+    return err_code;
 }
@@ -14,25 +14,25 @@
 
 #include <stdint.h>
 
-#include "nrfx_twi.h"
+#include "dk_twi_mngr.h"
 #include "sdk_errors.h"
 
 /** @brief TCA9548A driver struct. */
 typedef struct
 {
-    nrfx_twi_t *p_i2c_instance; /**< Pointer to I2C instance. */
-    uint8_t     i2c_address;    /**< Device I2C address. */
+    const dk_twi_mngr_t *p_dk_twi_mngr_instance; /**< Pointer to TWI manager instance. */
+    uint8_t              i2c_address;            /**< Device I2C address. */
 } tca9548a_t;
 
 /**@brief   Macro for defining a TCA9548A instance.
  *
- * @param   _name               Name of the instance.
- * @param   _p_i2c_instance     Pointer to i2c instance.
- * @param   _i2c_address        I2C address.
+ * @param   _name                       Name of the instance.
+ * @param   _p_dk_twi_mngr_instance     Pointer to TWI manager instance.
+ * @param   _i2c_address                I2C address.
  * @hideinitializer
  */
-#define TCA9548A_DEF(_name, _p_i2c_instance, _i2c_address)                                                             \
-    static tca9548a_t _name = {.p_i2c_instance = _p_i2c_instance, .i2c_address = _i2c_address}
+#define TCA9548A_DEF(_name, _p_dk_twi_mngr_instance, _i2c_address)                                                     \
+    static tca9548a_t _name = {.p_dk_twi_mngr_instance = _p_dk_twi_mngr_instance, .i2c_address = _i2c_address}
 
 /** @brief TCA9548A channel control. */
 typedef enum
@@ -48,14 +48,30 @@ typedef enum
     TCA9548A_CHANNEL7 = (1 << 7)  /**< Channel 7 enabled. */
 } tca9548a_channel_enable_t;
 
+/**
+ * @brief       Initialize TCA9548A.
+ *
+ * @details     The switch is set as the mux of its TWI manager, which then selects the channels of every transaction
+ *              with dk_twi_mngr_transaction_t::mux_channels set (e.g. to TCA9548A_CHANNEL6) on its own. The TWI
+ *              manager has to be initialized first.
+ *
+ * @param[in]   p_tca9548a  Pointer to TCA9548A instance.
+ *
+ * @retval      NRF_SUCCESS On success.
+ */
+ret_code_t tca9548a_init(tca9548a_t *p_tca9548a);
+
 /**
  * @brief       Enable TCA9548A channel.
  *
- * @param[in]   p_tca9548a  Pointer to TCA9546A instance.
+ * @details     The write is scheduled on the TWI manager, the function does not wait for it. Not needed for
+ *              transactions that set their mux channels.
+ *
+ * @param[in]   p_tca9548a  Pointer to TCA9548A instance.
  * @param[in]   channel     Channel to enable.
  *
  * @retval      NRF_SUCCESS On success.
- * @retval      Other       Error codes returned by nrfx_twi_tx function.
+ * @retval      Other       Error codes returned by dk_twi_mngr_schedule function.
  */
 ret_code_t tca9548a_enable_channel(tca9548a_t *p_tca9548a, tca9548a_channel_enable_t channel);
 
@@ -12,7 +12,6 @@
 #include "tlv320aic3106.h"
 
 #include "app_util.h"
-#include "nrf_delay.h"
 #include "sdk_errors.h"
 #include "sdk_macros.h"
 #include "tlv320aic3106-internal.h"
@@ -131,14 +130,26 @@ static ret_code_t twi_write(tlv320aic3106_t           *p_tlv320aic3106,
     ret_code_t err_code;
 
     err_code = set_reg_page(p_tlv320aic3106, &p_twi_write->reg_address);
-    VERIFY_SUCCESS(err_code);
 
-    dk_twi_mngr_transaction_t twi_transaction = {
-      .callback    = twi_mngr_callback,
-      .p_user_data = (void *)p_tlv320aic3106,
-      .transfer    = DK_TWI_MNGR_TX(p_tlv320aic3106->i2c_address, (uint8_t *)p_twi_write, write_size, 0)};
+    if (err_code == NRF_SUCCESS)
+    {
+        // Register address auto-increments on burst writes, consecutive register writes can be merged.
+        dk_twi_mngr_transaction_t twi_transaction = {
+          .callback    = twi_mngr_callback,
+          .p_user_data = (void *)p_tlv320aic3106,
+          .transfer    = DK_TWI_MNGR_TX(p_tlv320aic3106->i2c_address, (uint8_t *)p_twi_write, write_size, 0),
+          .flags       = DK_TWI_MNGR_FLAG_COALESCE};
+
+        err_code = dk_twi_mngr_schedule(p_tlv320aic3106->p_dk_twi_mngr_instance, &twi_transaction);
+    }
 
-    return dk_twi_mngr_schedule(p_tlv320aic3106->p_dk_twi_mngr_instance, &twi_transaction);
+    if (err_code != NRF_SUCCESS)
+    {
+        // Transaction was not queued, buffer has to be released here.
+        dk_twi_mngr_data_buffer_free(p_tlv320aic3106->p_dk_twi_mngr_instance, p_twi_write);
+    }
+
+    return err_code;
 }
 
 /**
@@ -167,16 +178,14 @@ static ret_code_t twi_read(tlv320aic3106_t const    *p_tlv320aic3106,
                                                                                read_size - 1,
                                                                                0)};
 
-    return dk_twi_mngr_schedule(p_tlv320aic3106->p_dk_twi_mngr_instance, &twi_transaction);
-}
+    ret_code_t err_code = dk_twi_mngr_schedule(p_tlv320aic3106->p_dk_twi_mngr_instance, &twi_transaction);
+    if (err_code != NRF_SUCCESS)
+    {
+        // Transaction was not queued, buffer has to be released here.
+        dk_twi_mngr_data_buffer_free(p_tlv320aic3106->p_dk_twi_mngr_instance, p_twi_read);
+    }
 
-/**
- * @brief   Function to be called by dk_twi_mngr when waiting for a transfer to finish.
- *          Just waits for one millisecond.
- */
-static void wait_for_transfer_complete() // TODO: Look for ways to utilize this wait time for something else
-{
-    nrf_delay_ms(1);
+    return err_code;
 }
 
 /**
@@ -190,7 +199,7 @@ static void wait_for_transfer_complete() // TODO: Look for ways to utilize this
  * @param[in]   buffer_size     Read buffer size.
  *
  * @return      NRF_SUCCESS     Upon successful twi transaction.
- * @return      Other           Error codes returned by @dk_twi_mngr_perform function.
+ * @return      Other           Error codes returned by @dk_twi_mngr_perform_timeout function.
  */
 static ret_code_t twi_read_blocking(tlv320aic3106_t const *p_tlv320aic3106,
                                     uint8_t                reg,
@@ -202,9 +211,10 @@ static ret_code_t twi_read_blocking(tlv320aic3106_t const *p_tlv320aic3106,
                                                             sizeof(reg),
                                                             p_buffer,
                                                             buffer_size,
-                                                            NRFX_TWI_FLAG_TX_NO_STOP);
+                                                            DK_TWI_MNGR_XFER_FLAG_TX_NO_STOP);
 
-    return dk_twi_mngr_perform(p_tlv320aic3106->p_dk_twi_mngr_instance, &twi_transfer, wait_for_transfer_complete);
+    return dk_twi_mngr_perform_timeout(
+      p_tlv320aic3106->p_dk_twi_mngr_instance, &twi_transfer, DK_TWI_MNGR_PERFORM_TIMEOUT_MS);
 }
 
 static ret_code_t twi_write_blocking(tlv320aic3106_t const     *p_tlv320aic3106,
@@ -213,15 +223,8 @@ static ret_code_t twi_write_blocking(tlv320aic3106_t const     *p_tlv320aic3106,
 {
     dk_twi_mngr_transfer_t twi_transfer = DK_TWI_MNGR_TX(p_tlv320aic3106->i2c_address, p_twi_write, write_size, 0);
 
-    return dk_twi_mngr_perform(p_tlv320aic3106->p_dk_twi_mngr_instance, &twi_transfer, wait_for_transfer_complete);
-}
-
-static ret_code_t tlv320aic3106_page_select_get(tlv320aic3106_t *p_tlv320aic3106, tlv320aic3106_active_page_t *p_page)
-{
-    return twi_read_blocking(p_tlv320aic3106,
-                             TLV320AIC3106_PAGE_SELECT,
-                             (uint8_t *)p_page,
-                             sizeof(tlv320aic3106_active_page_t));
+    return dk_twi_mngr_perform_timeout(
+      p_tlv320aic3106->p_dk_twi_mngr_instance, &twi_transfer, DK_TWI_MNGR_PERFORM_TIMEOUT_MS);
 }
 
 static ret_code_t tlv320aic3106_page_select_set(tlv320aic3106_t *p_tlv320aic3106, tlv320aic3106_active_page_t page)
@@ -234,14 +237,23 @@ static ret_code_t tlv320aic3106_page_select_set(tlv320aic3106_t *p_tlv320aic3106
         return NRF_SUCCESS;
     }
 
-    DK_TWI_MNGR_BUFF_ALLOC(tlv320aic3106_twi_write_t, p_page_data, sizeof(page));
-    p_page_data->reg_address = TLV320AIC3106_PAGE_SELECT;
-    p_page_data->data[0]     = page;
-
-    err_code = twi_write(p_tlv320aic3106, p_page_data, p_page_data_size);
-    VERIFY_SUCCESS(err_code);
-
-    err_code = tlv320aic3106_page_select_get(p_tlv320aic3106, &page_check);
+    uint8_t page_reg     = TLV320AIC3106_PAGE_SELECT;
+    uint8_t page_write[] = {TLV320AIC3106_PAGE_SELECT, page};
+
+    // Page write and read-back are performed as one transaction so no other traffic can change the page in between.
+    dk_twi_mngr_transfer_t const transfers[] = {
+      DK_TWI_MNGR_TX(p_tlv320aic3106->i2c_address, page_write, sizeof(page_write), 0),
+      DK_TWI_MNGR_TX_RX(p_tlv320aic3106->i2c_address,
+                        &page_reg,
+                        sizeof(page_reg),
+                        (uint8_t *)&page_check,
+                        sizeof(tlv320aic3106_active_page_t),
+                        DK_TWI_MNGR_XFER_FLAG_TX_NO_STOP)};
+
+    err_code = dk_twi_mngr_perform_sequence_timeout(p_tlv320aic3106->p_dk_twi_mngr_instance,
+                                                    transfers,
+                                                    ARRAY_SIZE(transfers),
+                                                    DK_TWI_MNGR_PERFORM_TIMEOUT_MS);
     VERIFY_SUCCESS(err_code);
 
     if (page_check == page)
@@ -329,7 +341,8 @@ ret_code_t tlv320aic3106_set_passive_ana_sig_bypass_sel_pd(tlv320aic3106_t *p_tl
 {
     ret_code_t err_code;
 
-    DK_TWI_MNGR_BUFF_ALLOC(tlv320aic3106_twi_write_t,
+    DK_TWI_MNGR_BUFF_ALLOC(p_tlv320aic3106->p_dk_twi_mngr_instance,
+                           tlv320aic3106_twi_write_t,
                            p_bypass_cmd,
                            sizeof(tlv320aic3106_passive_ana_sig_bypass_sel_pd_t));
     p_bypass_cmd->reg_address = TLV320AIC3106_PASSIVE_ANA_SIG_BYPASS_SEL_PD;
@@ -360,7 +373,10 @@ ret_code_t tlv320aic3106_pll_init(tlv320aic3106_t *p_tlv320aic3106, tlv320aic310
 {
     ret_code_t err_code;
 
-    DK_TWI_MNGR_BUFF_ALLOC(tlv320aic3106_twi_write_t, p_cmd, sizeof(tlv320aic3106_pll_prog_t));
+    DK_TWI_MNGR_BUFF_ALLOC(p_tlv320aic3106->p_dk_twi_mngr_instance,
+                           tlv320aic3106_twi_write_t,
+                           p_cmd,
+                           sizeof(tlv320aic3106_pll_prog_t));
     p_cmd->reg_address                   = TLV320AIC3106_PLL_PROG_REG_A;
     tlv320aic3106_pll_prog_t *p_pll_prog = (tlv320aic3106_pll_prog_t *)p_cmd->data;
     memset(p_pll_prog, 0, sizeof(tlv320aic3106_pll_prog_t));
@@ -393,7 +409,10 @@ ret_code_t tlv320aic3106_set_pll_prog_reg_a(tlv320aic3106_t                *p_tl
                                             tlv320aic3106_pll_prog_reg_a_t *p_pll_prog_reg_a)
 {
     ret_code_t err_code;
-    DK_TWI_MNGR_BUFF_ALLOC(tlv320aic3106_twi_write_t, p_cmd, sizeof(tlv320aic3106_pll_prog_reg_a_t));
+    DK_TWI_MNGR_BUFF_ALLOC(p_tlv320aic3106->p_dk_twi_mngr_instance,
+                           tlv320aic3106_twi_write_t,
+                           p_cmd,
+                           sizeof(tlv320aic3106_pll_prog_reg_a_t));
     p_cmd->reg_address = TLV320AIC3106_PLL_PROG_REG_A;
     memcpy(p_cmd->data, p_pll_prog_reg_a, sizeof(tlv320aic3106_pll_prog_reg_a_t));
 
@@ -408,7 +427,10 @@ ret_code_t tlv320aic3106_set_pll_prog_reg_a(tlv320aic3106_t                *p_tl
 ret_code_t tlv320aic3106_set_pll_prog_reg_b(tlv320aic3106_t                *p_tlv320aic3106,
                                             tlv320aic3106_pll_prog_reg_b_t *p_pll_prog_reg_b)
 {
-    DK_TWI_MNGR_BUFF_ALLOC(tlv320aic3106_twi_write_t, p_cmd, sizeof(tlv320aic3106_pll_prog_reg_b_t));
+    DK_TWI_MNGR_BUFF_ALLOC(p_tlv320aic3106->p_dk_twi_mngr_instance,
+                           tlv320aic3106_twi_write_t,
+                           p_cmd,
+                           sizeof(tlv320aic3106_pll_prog_reg_b_t));
     p_cmd->reg_address = TLV320AIC3106_PLL_PROG_REG_B;
     memcpy(p_cmd->data, p_pll_prog_reg_b, sizeof(tlv320aic3106_pll_prog_reg_b_t));
 
@@ -424,7 +446,7 @@ ret_code_t tlv320aic3106_set_pll_d(tlv320aic3106_t *p_tlv320aic3106, uint16_t d_
 
     uint16_t encoded_d = pll_d_encode(d_value);
 
-    DK_TWI_MNGR_BUFF_ALLOC(tlv320aic3106_twi_write_t, p_cmd, sizeof(d_value));
+    DK_TWI_MNGR_BUFF_ALLOC(p_tlv320aic3106->p_dk_twi_mngr_instance, tlv320aic3106_twi_write_t, p_cmd, sizeof(d_value));
     p_cmd->reg_address = TLV320AIC3106_PLL_PROG_REG_C;
     memcpy(p_cmd->data, &encoded_d, sizeof(encoded_d));
 
@@ -434,7 +456,10 @@ ret_code_t tlv320aic3106_set_pll_d(tlv320aic3106_t *p_tlv320aic3106, uint16_t d_
 ret_code_t tlv320aic3106_set_datapath(tlv320aic3106_t                *p_tlv320aic3106,
                                       tlv320aic3106_datapath_setup_t *p_datapath_setup)
 {
-    DK_TWI_MNGR_BUFF_ALLOC(tlv320aic3106_twi_write_t, p_datapath, sizeof(tlv320aic3106_datapath_setup_t));
+    DK_TWI_MNGR_BUFF_ALLOC(p_tlv320aic3106->p_dk_twi_mngr_instance,
+                           tlv320aic3106_twi_write_t,
+                           p_datapath,
+                           sizeof(tlv320aic3106_datapath_setup_t));
     p_datapath->reg_address = TLV320AIC3106_DATAPATH_SETUP;
     memcpy(p_datapath->data, p_datapath_setup, sizeof(tlv320aic3106_datapath_setup_t));
 
@@ -445,7 +470,10 @@ ret_code_t tlv320aic3106_set_audio_ser_data_interface_ctrl_a(
   tlv320aic3106_t                                 *p_tlv320aic3106,
   tlv320aic3106_audio_ser_data_interface_ctrl_a_t *p_audio_ser_data_interface_ctrl_a)
 {
-    DK_TWI_MNGR_BUFF_ALLOC(tlv320aic3106_twi_write_t, p_cmd, sizeof(tlv320aic3106_audio_ser_data_interface_ctrl_a_t));
+    DK_TWI_MNGR_BUFF_ALLOC(p_tlv320aic3106->p_dk_twi_mngr_instance,
+                           tlv320aic3106_twi_write_t,
+                           p_cmd,
+                           sizeof(tlv320aic3106_audio_ser_data_interface_ctrl_a_t));
     p_cmd->reg_address = TLV320AIC3106_AUDIO_SER_DATA_INTERFACE_CTRL_A;
     memcpy(p_cmd->data, p_audio_ser_data_interface_ctrl_a, sizeof(tlv320aic3106_audio_ser_data_interface_ctrl_a_t));
 
@@ -456,7 +484,10 @@ ret_code_t tlv320aic3106_set_audio_ser_data_interface_ctrl_b(
   tlv320aic3106_t                                 *p_tlv320aic3106,
   tlv320aic3106_audio_ser_data_interface_ctrl_b_t *p_audio_ser_data_interface_ctrl_b)
 {
-    DK_TWI_MNGR_BUFF_ALLOC(tlv320aic3106_twi_write_t, p_cmd, sizeof(tlv320aic3106_audio_ser_data_interface_ctrl_b_t));
+    DK_TWI_MNGR_BUFF_ALLOC(p_tlv320aic3106->p_dk_twi_mngr_instance,
+                           tlv320aic3106_twi_write_t,
+                           p_cmd,
+                           sizeof(tlv320aic3106_audio_ser_data_interface_ctrl_b_t));
     p_cmd->reg_address = TLV320AIC3106_AUDIO_SER_DATA_INTERFACE_CTRL_B;
     memcpy(p_cmd->data, p_audio_ser_data_interface_ctrl_b, sizeof(tlv320aic3106_audio_ser_data_interface_ctrl_b_t));
 
@@ -465,7 +496,7 @@ ret_code_t tlv320aic3106_set_audio_ser_data_interface_ctrl_b(
 
 ret_code_t tlv320aic3106_set_audio_ser_data_interface_ctrl_c(tlv320aic3106_t *p_tlv320aic3106, uint8_t offset)
 {
-    DK_TWI_MNGR_BUFF_ALLOC(tlv320aic3106_twi_write_t, p_cmd, sizeof(offset));
+    DK_TWI_MNGR_BUFF_ALLOC(p_tlv320aic3106->p_dk_twi_mngr_instance, tlv320aic3106_twi_write_t, p_cmd, sizeof(offset));
     p_cmd->reg_address = TLV320AIC3106_AUDIO_SER_DATA_INTERFACE_CTRL_C;
     memcpy(p_cmd->data, &offset, sizeof(offset));
 
@@ -476,7 +507,10 @@ ret_code_t tlv320aic3106_set_pll_r(tlv320aic3106_t *p_tlv320aic3106, tlv320aic31
 {
     tlv320aic3106_audio_codec_overflow_flag_t overflow_reg = {.pll_r = pll_r};
 
-    DK_TWI_MNGR_BUFF_ALLOC(tlv320aic3106_twi_write_t, p_cmd, sizeof(overflow_reg));
+    DK_TWI_MNGR_BUFF_ALLOC(p_tlv320aic3106->p_dk_twi_mngr_instance,
+                           tlv320aic3106_twi_write_t,
+                           p_cmd,
+                           sizeof(overflow_reg));
     p_cmd->reg_address = TLV320AIC3106_AUDIO_CODEC_OVERFLOW_FLAG;
     memcpy(p_cmd->data, &overflow_reg, sizeof(overflow_reg));
 
@@ -486,7 +520,10 @@ ret_code_t tlv320aic3106_set_pll_r(tlv320aic3106_t *p_tlv320aic3106, tlv320aic31
 ret_code_t tlv320aic3106_set_digital_filter_ctrl(tlv320aic3106_t                                 *p_tlv320aic3106,
                                                  tlv320aic3106_audio_codec_digital_filter_ctrl_t *p_dig_filter_ctrl)
 {
-    DK_TWI_MNGR_BUFF_ALLOC(tlv320aic3106_twi_write_t, p_cmd, sizeof(tlv320aic3106_audio_codec_digital_filter_ctrl_t));
+    DK_TWI_MNGR_BUFF_ALLOC(p_tlv320aic3106->p_dk_twi_mngr_instance,
+                           tlv320aic3106_twi_write_t,
+                           p_cmd,
+                           sizeof(tlv320aic3106_audio_codec_digital_filter_ctrl_t));
     p_cmd->reg_address = TLV320AIC3106_AUDIO_CODEC_DIGITAL_FILTER_CTRL;
     memcpy(p_cmd->data, p_dig_filter_ctrl, sizeof(tlv320aic3106_audio_codec_digital_filter_ctrl_t));
 
@@ -497,7 +534,10 @@ ret_code_t tlv320aic3106_set_headset_btn_press_detect_b(
   tlv320aic3106_t                            *p_tlv320aic3106,
   tlv320aic3106_headset_btn_press_detect_b_t *p_headset_btn_press_detect_b)
 {
-    DK_TWI_MNGR_BUFF_ALLOC(tlv320aic3106_twi_write_t, p_cmd, sizeof(tlv320aic3106_headset_btn_press_detect_b_t));
+    DK_TWI_MNGR_BUFF_ALLOC(p_tlv320aic3106->p_dk_twi_mngr_instance,
+                           tlv320aic3106_twi_write_t,
+                           p_cmd,
+                           sizeof(tlv320aic3106_headset_btn_press_detect_b_t));
     p_cmd->reg_address = TLV320AIC3106_HEADSET_BTN_PRESS_DETECT_B;
     memcpy(p_cmd->data, p_headset_btn_press_detect_b, sizeof(tlv320aic3106_headset_btn_press_detect_b_t));
 
@@ -509,7 +549,10 @@ ret_code_t tlv320aic3106_set_ac_pwr_and_out_drv_ctrl(tlv320aic3106_t
 {
     ret_code_t err_code;
 
-    DK_TWI_MNGR_BUFF_ALLOC(tlv320aic3106_twi_write_t, p_cmd, sizeof(tlv320aic3106_ac_pwr_and_out_drv_ctrl_t));
+    DK_TWI_MNGR_BUFF_ALLOC(p_tlv320aic3106->p_dk_twi_mngr_instance,
+                           tlv320aic3106_twi_write_t,
+                           p_cmd,
+                           sizeof(tlv320aic3106_ac_pwr_and_out_drv_ctrl_t));
     p_cmd->reg_address = TLV320AIC3106_AC_PWR_AND_OUT_DRV_CTRL;
     memcpy(p_cmd->data, p_ac_pwr_and_out_drv_ctrl, sizeof(tlv320aic3106_ac_pwr_and_out_drv_ctrl_t));
 
@@ -534,7 +577,10 @@ ret_code_t tlv320aic3106_set_dac_pwr(tlv320aic3106_t *p_tlv320aic3106, bool righ
 ret_code_t tlv320aic3106_set_hi_pwr_out_stage_ctrl(tlv320aic3106_t                       *p_tlv320aic3106,
                                                    tlv320aic3106_hi_pwr_out_stage_ctrl_t *p_hi_pwr_out_stage_ctrl)
 {
-    DK_TWI_MNGR_BUFF_ALLOC(tlv320aic3106_twi_write_t, p_cmd, sizeof(tlv320aic3106_hi_pwr_out_stage_ctrl_t));
+    DK_TWI_MNGR_BUFF_ALLOC(p_tlv320aic3106->p_dk_twi_mngr_instance,
+                           tlv320aic3106_twi_write_t,
+                           p_cmd,
+                           sizeof(tlv320aic3106_hi_pwr_out_stage_ctrl_t));
     p_cmd->reg_address = TLV320AIC3106_HI_PWR_OUT_STAGE_CTRL;
     memcpy(p_cmd->data, p_hi_pwr_out_stage_ctrl, sizeof(tlv320aic3106_hi_pwr_out_stage_ctrl_t));
 
@@ -544,7 +590,10 @@ ret_code_t tlv320aic3106_set_hi_pwr_out_stage_ctrl(tlv320aic3106_t
 ret_code_t tlv320aic3106_set_dac_out_switch_ctrl(tlv320aic3106_t                     *p_tlv320aic3106,
                                                  tlv320aic3106_dac_out_switch_ctrl_t *p_dac_out_switch_ctrl)
 {
-    DK_TWI_MNGR_BUFF_ALLOC(tlv320aic3106_twi_write_t, p_cmd, sizeof(tlv320aic3106_dac_out_switch_ctrl_t));
+    DK_TWI_MNGR_BUFF_ALLOC(p_tlv320aic3106->p_dk_twi_mngr_instance,
+                           tlv320aic3106_twi_write_t,
+                           p_cmd,
+                           sizeof(tlv320aic3106_dac_out_switch_ctrl_t));
     p_cmd->reg_address = TLV320AIC3106_DAC_OUT_SWITCH_CTRL;
     memcpy(p_cmd->data, p_dac_out_switch_ctrl, sizeof(tlv320aic3106_dac_out_switch_ctrl_t));
 
@@ -554,7 +603,10 @@ ret_code_t tlv320aic3106_set_dac_out_switch_ctrl(tlv320aic3106_t
 ret_code_t tlv320aic3106_set_out_drv_pop_reduction(tlv320aic3106_t                       *p_tlv320aic3106,
                                                    tlv320aic3106_out_drv_pop_reduction_t *p_out_drv_pop_reduction)
 {
-    DK_TWI_MNGR_BUFF_ALLOC(tlv320aic3106_twi_write_t, p_cmd, sizeof(tlv320aic3106_out_drv_pop_reduction_t));
+    DK_TWI_MNGR_BUFF_ALLOC(p_tlv320aic3106->p_dk_twi_mngr_instance,
+                           tlv320aic3106_twi_write_t,
+                           p_cmd,
+                           sizeof(tlv320aic3106_out_drv_pop_reduction_t));
     p_cmd->reg_address = TLV320AIC3106_OUT_DRV_POP_REDUCTION;
     memcpy(p_cmd->data, p_out_drv_pop_reduction, sizeof(tlv320aic3106_out_drv_pop_reduction_t));
 
@@ -566,7 +618,10 @@ ret_code_t tlv320aic3106_set_dac_dig_volume_ctrl(tlv320aic3106_t
 {
     ret_code_t err_code;
 
-    DK_TWI_MNGR_BUFF_ALLOC(tlv320aic3106_twi_write_t, p_cmd, sizeof(tlv320aic3106_dac_dig_volume_ctrl_t) * 2);
+    DK_TWI_MNGR_BUFF_ALLOC(p_tlv320aic3106->p_dk_twi_mngr_instance,
+                           tlv320aic3106_twi_write_t,
+                           p_cmd,
+                           sizeof(tlv320aic3106_dac_dig_volume_ctrl_t) * 2);
     p_cmd->reg_address = TLV320AIC3106_LEFT_DAC_DIG_VOLUME_CTRL;
     memcpy(&p_cmd->data[0], p_dac_dig_volume_ctrl, sizeof(tlv320aic3106_dac_dig_volume_ctrl_t));
     memcpy(&p_cmd->data[1], p_dac_dig_volume_ctrl, sizeof(tlv320aic3106_dac_dig_volume_ctrl_t));
@@ -593,7 +648,10 @@ ret_code_t tlv320aic3106_set_left_lop_m_out_lvl_ctrl(tlv320aic3106_t
 {
     ret_code_t err_code;
 
-    DK_TWI_MNGR_BUFF_ALLOC(tlv320aic3106_twi_write_t, p_cmd, sizeof(tlv320aic3106_x_out_lvl_ctrl_t));
+    DK_TWI_MNGR_BUFF_ALLOC(p_tlv320aic3106->p_dk_twi_mngr_instance,
+                           tlv320aic3106_twi_write_t,
+                           p_cmd,
+                           sizeof(tlv320aic3106_x_out_lvl_ctrl_t));
     p_cmd->reg_address = TLV320AIC3106_LEFT_LOP_M_OUT_LVL_CTRL;
     memcpy(p_cmd->data, p_out_lvl_ctrl, sizeof(tlv320aic3106_x_out_lvl_ctrl_t));
 
@@ -642,7 +700,10 @@ ret_code_t tlv320aic3106_set_dac_r1_to_right_lop(tlv320aic3106_t
 {
     ret_code_t err_code;
 
-    DK_TWI_MNGR_BUFF_ALLOC(tlv320aic3106_twi_write_t, p_cmd, sizeof(tlv320aic3106_x_to_y_volume_ctrl_t));
+    DK_TWI_MNGR_BUFF_ALLOC(p_tlv320aic3106->p_dk_twi_mngr_instance,
+                           tlv320aic3106_twi_write_t,
+                           p_cmd,
+                           sizeof(tlv320aic3106_x_to_y_volume_ctrl_t));
     p_cmd->reg_address = TLV320AIC3106_DAC_R1_TO_RIGHT_LOP_M_VOLUME_CTRL;
     memcpy(p_cmd->data, p_dac_r1_to_right_lop, sizeof(tlv320aic3106_x_to_y_volume_ctrl_t));
 
@@ -659,7 +720,10 @@ ret_code_t tlv320aic3106_set_dac_l1_to_left_lop(tlv320aic3106_t
 {
     ret_code_t err_code;
 
-    DK_TWI_MNGR_BUFF_ALLOC(tlv320aic3106_twi_write_t, p_cmd, sizeof(tlv320aic3106_x_to_y_volume_ctrl_t));
+    DK_TWI_MNGR_BUFF_ALLOC(p_tlv320aic3106->p_dk_twi_mngr_instance,
+                           tlv320aic3106_twi_write_t,
+                           p_cmd,
+                           sizeof(tlv320aic3106_x_to_y_volume_ctrl_t));
     p_cmd->reg_address = TLV320AIC3106_DAC_L1_TO_LEFT_LOP_M_VOLUME_CTRL;
     memcpy(p_cmd->data, p_dac_l1_to_left_lop, sizeof(tlv320aic3106_x_to_y_volume_ctrl_t));
 
@@ -708,7 +772,10 @@ ret_code_t tlv320aic3106_set_right_lop_m_out_lvl_ctrl(tlv320aic3106_t
 {
     ret_code_t err_code;
 
-    DK_TWI_MNGR_BUFF_ALLOC(tlv320aic3106_twi_write_t, p_cmd, sizeof(tlv320aic3106_x_out_lvl_ctrl_t));
+    DK_TWI_MNGR_BUFF_ALLOC(p_tlv320aic3106->p_dk_twi_mngr_instance,
+                           tlv320aic3106_twi_write_t,
+                           p_cmd,
+                           sizeof(tlv320aic3106_x_out_lvl_ctrl_t));
     p_cmd->reg_address = TLV320AIC3106_RIGHT_LOP_M_OUT_LVL_CTRL;
     memcpy(p_cmd->data, p_out_lvl_ctrl, sizeof(tlv320aic3106_x_out_lvl_ctrl_t));
 
@@ -742,7 +809,10 @@ ret_code_t tlv320aic3106_set_gpio_ctrl_b(tlv320aic3106_t *p_tlv320aic3106, tlv32
 {
     ret_code_t err_code;
 
-    DK_TWI_MNGR_BUFF_ALLOC(tlv320aic3106_twi_write_t, p_cmd, sizeof(tlv320aic3106_gpio_ctrl_b_t));
+    DK_TWI_MNGR_BUFF_ALLOC(p_tlv320aic3106->p_dk_twi_mngr_instance,
+                           tlv320aic3106_twi_write_t,
+                           p_cmd,
+                           sizeof(tlv320aic3106_gpio_ctrl_b_t));
     p_cmd->reg_address = TLV320AIC3106_GPIO_CTRL_B;
     memcpy(p_cmd->data, p_gpio_ctrl_b, sizeof(tlv320aic3106_gpio_ctrl_b_t));
 
@@ -766,7 +836,10 @@ ret_code_t tlv320aic3106_set_clkin_src(tlv320aic3106_t *p_tlv320aic3106, tlv320a
 ret_code_t tlv320aic3106_set_clk_gen_ctrl(tlv320aic3106_t              *p_tlv320aic3106,
                                           tlv320aic3106_clk_gen_ctrl_t *p_clk_gen_ctrl)
 {
-    DK_TWI_MNGR_BUFF_ALLOC(tlv320aic3106_twi_write_t, p_cmd, sizeof(tlv320aic3106_clk_gen_ctrl_t));
+    DK_TWI_MNGR_BUFF_ALLOC(p_tlv320aic3106->p_dk_twi_mngr_instance,
+                           tlv320aic3106_twi_write_t,
+                           p_cmd,
+                           sizeof(tlv320aic3106_clk_gen_ctrl_t));
     p_cmd->reg_address = TLV320AIC3106_CLK_GEN_CTRL;
     memcpy(p_cmd->data, p_clk_gen_ctrl, sizeof(tlv320aic3106_clk_gen_ctrl_t));
 
@@ -776,7 +849,10 @@ ret_code_t tlv320aic3106_set_clk_gen_ctrl(tlv320aic3106_t              *p_tlv320
 ret_code_t tlv320aic3106_set_dac_quiescent_current(tlv320aic3106_t                           *p_tlv320aic3106,
                                                    tlv320aic3106_dac_quiescent_current_adj_t *p_dac_quiescent)
 {
-    DK_TWI_MNGR_BUFF_ALLOC(tlv320aic3106_twi_write_t, p_cmd, sizeof(tlv320aic3106_dac_quiescent_current_adj_t));
+    DK_TWI_MNGR_BUFF_ALLOC(p_tlv320aic3106->p_dk_twi_mngr_instance,
+                           tlv320aic3106_twi_write_t,
+                           p_cmd,
+                           sizeof(tlv320aic3106_dac_quiescent_current_adj_t));
     p_cmd->reg_address = TLV320AIC3106_DAC_QUIESCENT_CURRENT_ADJ;
     memcpy(p_cmd->data, p_dac_quiescent, sizeof(tlv320aic3106_dac_quiescent_current_adj_t));
 
@@ -802,7 +878,10 @@ ret_code_t tlv320aic3106_debug(tlv320aic3106_t *p_tlv320aic3106)
 
 ret_code_t tlv320aic3106_get_module_power_status(tlv320aic3106_t *p_tlv320aic3106)
 {
-    DK_TWI_MNGR_BUFF_ALLOC(tlv320aic3106_twi_read_t, p_obj_read, sizeof(tlv320aic3106_module_pwr_status_t));
+    DK_TWI_MNGR_BUFF_ALLOC(p_tlv320aic3106->p_dk_twi_mngr_instance,
+                           tlv320aic3106_twi_read_t,
+                           p_obj_read,
+                           sizeof(tlv320aic3106_module_pwr_status_t));
 
     p_obj_read->reg_address = TLV320AIC3106_MODULE_PWR_STATUS;
 
@@ -69,6 +69,8 @@ void dk_flash_storage_write(nrf_fstorage_t *p_m_fstorage,
                             uint32_t        len,
                             void (*wait_function)(void))
 {
+    UNUSED_PARAMETER(wait_function);
+
     ret_code_t err_code;
 
     NRF_LOG_INFO("Writing to 0x%x in flash.", dest);
@@ -10,8 +10,13 @@
 
 #include "dk_twi.h"
 
+#include "nrf_delay.h"
+#include "nrf_gpio.h"
 #include "sdk_macros.h"
 
+#define DK_TWI_BUS_CLEAR_CLOCKS      9 ///< Clocks needed for a slave to shift out the rest of a byte and its ACK.
+#define DK_TWI_BUS_CLEAR_HALF_CLK_US 4 ///< Half of SCL period during bus clear (~100 kHz).
+
 ret_code_t dk_twi_enable(nrfx_twi_t            *p_twi_instance,
                          uint32_t               scl_pin,
                          uint32_t               sda_pin,
@@ -32,21 +37,72 @@ ret_code_t dk_twi_enable(nrfx_twi_t            *p_twi_instance,
     return NRF_SUCCESS;
 }
 
-void dk_twi_disable(nrfx_twi_t *p_twi_instance)
+static void errata_89_apply(void *p_reg)
+{
+    // Apply workaround mentioned in ERRATA 89, this toggles the POWER register of the peripheral at offset 0xFFC.
+    volatile uint32_t *p_power = (volatile uint32_t *)((uintptr_t)p_reg + 0xFFC);
+
+    *p_power = 0;
+    *p_power;
+    *p_power = 1;
+}
+
+void dk_twi_disable(nrfx_twi_t const *p_twi_instance)
 {
     nrfx_twi_uninit(p_twi_instance); // Deinitialize TWI, this is done instead of disable because when the TWI has to be
                                      // enabled again it has to be reinitialized as mentioned in ERRATA 89
 
-    if (p_twi_instance->drv_inst_idx == 0)
-    {
-        *(volatile uint32_t *)0x40003FFC =
-          0; // Apply workaround mentioned in ERRATA 89, this toggles the POWER register of the peripheral
-        *(volatile uint32_t *)0x40003FFC;
-        *(volatile uint32_t *)0x40003FFC = 1;
-    } else if (p_twi_instance->drv_inst_idx == 1)
+    errata_89_apply(p_twi_instance->p_twi);
+}
+
+#ifdef TWIM_PRESENT
+void dk_twim_disable(nrfx_twim_t const *p_twim_instance)
+{
+    nrfx_twim_uninit(p_twim_instance); // Same as for TWI, the instance has to be reinitialized after ERRATA 89
+
+    errata_89_apply(p_twim_instance->p_twim);
+}
+#endif
+
+ret_code_t dk_twi_bus_clear(uint32_t scl_pin, uint32_t sda_pin)
+{
+    // Both lines are driven as open-drain outputs, released (high) by default.
+    nrf_gpio_pin_set(scl_pin);
+    nrf_gpio_pin_set(sda_pin);
+
+    nrf_gpio_cfg(scl_pin,
+                 NRF_GPIO_PIN_DIR_OUTPUT,
+                 NRF_GPIO_PIN_INPUT_CONNECT,
+                 NRF_GPIO_PIN_PULLUP,
+                 NRF_GPIO_PIN_S0D1,
+                 NRF_GPIO_PIN_NOSENSE);
+    nrf_gpio_cfg(sda_pin,
+                 NRF_GPIO_PIN_DIR_OUTPUT,
+                 NRF_GPIO_PIN_INPUT_CONNECT,
+                 NRF_GPIO_PIN_PULLUP,
+                 NRF_GPIO_PIN_S0D1,
+                 NRF_GPIO_PIN_NOSENSE);
+
+    nrf_delay_us(DK_TWI_BUS_CLEAR_HALF_CLK_US);
+
+    for (uint8_t i = 0; i < DK_TWI_BUS_CLEAR_CLOCKS; i++)
     {
-        *(volatile uint32_t *)0x40004FFC = 0;
-        *(volatile uint32_t *)0x40004FFC;
-        *(volatile uint32_t *)0x40004FFC = 1;
+        if (nrf_gpio_pin_read(sda_pin))
+        {
+            break;
+        }
+
+        nrf_gpio_pin_clear(scl_pin);
+        nrf_delay_us(DK_TWI_BUS_CLEAR_HALF_CLK_US);
+        nrf_gpio_pin_set(scl_pin);
+        nrf_delay_us(DK_TWI_BUS_CLEAR_HALF_CLK_US);
     }
+
+    // Generate a STOP condition, SDA goes high while SCL is high.
+    nrf_gpio_pin_clear(sda_pin);
+    nrf_delay_us(DK_TWI_BUS_CLEAR_HALF_CLK_US);
+    nrf_gpio_pin_set(sda_pin);
+    nrf_delay_us(DK_TWI_BUS_CLEAR_HALF_CLK_US);
+
+    return nrf_gpio_pin_read(sda_pin) ? NRF_SUCCESS : NRF_ERROR_INTERNAL;
 }
@@ -16,6 +16,10 @@
 #include "nrfx_twi.h"
 #include "sdk_errors.h"
 
+#ifdef TWIM_PRESENT
+#include "nrfx_twim.h"
+#endif
+
 /**
  * @brief       Function for initializing and enabling twi instance
  *
@@ -44,6 +48,29 @@ ret_code_t dk_twi_enable(nrfx_twi_t            *p_twi_instance,
  *
  * @param[in]   p_twi_instance Pointer to the driver instance structure.
  */
-void dk_twi_disable(nrfx_twi_t *p_twi_instance);
+void dk_twi_disable(nrfx_twi_t const *p_twi_instance);
+
+#ifdef TWIM_PRESENT
+/**
+ * @brief       Function for disabling TWIM instance.
+ * @details     Implements ERRATA 89 workaround for nRF52832, TWIM shares the peripheral with TWI.
+ *
+ * @param[in]   p_twim_instance Pointer to the driver instance structure.
+ */
+void dk_twim_disable(nrfx_twim_t const *p_twim_instance);
+#endif
+
+/**
+ * @brief       Function for releasing a bus that is held by a slave.
+ * @details     Clocks SCL up to 9 times until the slave releases SDA and generates a STOP condition. Must be called
+ *              while the TWI instance using the pins is disabled.
+ *
+ * @param[in]   scl_pin             SCL pin number
+ * @param[in]   sda_pin             SDA pin number
+ *
+ * @retval      NRF_SUCCESS         If SDA is released.
+ * @retval      NRF_ERROR_INTERNAL  If SDA is still held low.
+ */
+ret_code_t dk_twi_bus_clear(uint32_t scl_pin, uint32_t sda_pin);
 
 #endif // DK_TWI_H
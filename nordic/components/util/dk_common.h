@@ -35,7 +35,13 @@
  * And given parameter would be connected with @c _ENABLED postfix directly
  * without evaluating its value.
  */
+#ifdef _lint
 #define DK_MODULE_ENABLED(module) ((defined(module##_ENABLED) && (module##_ENABLED)) ? 1 : 0)
+#else
+// "defined" produced by a macro expansion is undefined behaviour in C (GCC -Wexpansion-to-defined), compilers
+// evaluate an undefined identifier as 0 anyway.
+#define DK_MODULE_ENABLED(module) ((module##_ENABLED) ? 1 : 0)
+#endif
 
 /**
  * @brief Macro for checking if the specified identifier is defined and it has
@@ -49,4 +55,11 @@
  */
 #define DK_CHECK(module_enabled) (module_enabled)
 
+/**
+ * @brief Base value for error codes of DK Lib modules.
+ *
+ * Lies above the ranges used by the SoftDevice and the SDK modules. Every module takes its own 0x100 block from it.
+ */
+#define DK_ERROR_BASE_NUM (0xD000)
+
 #endif // DK_COMMON_H
@@ -0,0 +1,90 @@
+/**
+ * @file        dk_wait_for_event.h
+ * @author      Danius Kalvaitis (danius.kalvaitis@gmail.com)
+ * @brief       Sleep used by DK Lib modules while blocking on a peripheral.
+ * @version     0.1
+ * @date        2026-10-17
+ *
+ * @copyright   Copyright (c) Danius Kalvaitis 2026 All rights reserved
+ *
+ */
+
+#ifndef DK_WAIT_FOR_EVENT_H
+#define DK_WAIT_FOR_EVENT_H
+
+#include "dk_lib_common.h"
+
+#include "nrf.h"
+
+#ifdef SOFTDEVICE_PRESENT
+#include "nrf_sdh.h"
+#endif
+
+#if DK_MODULE_ENABLED(DK_CPU_LOAD)
+#include "dk_cpu_load.h"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Replacement of the sleep in @ref dk_sleep_until_event.
+ *
+ * Define it in dk_config.h as a function-like macro without parameters to replace the sleep, for example with a
+ * function that advances stubbed peripherals when the modules are compiled for the host instead of the target.
+ */
+#ifdef __DOXYGEN__
+#define DK_WAIT_FOR_EVENT_HOOK()
+#endif
+
+/**
+ * @brief       Sleep until an event or an interrupt arrives.
+ *
+ * @details     Uses sd_app_evt_wait when the SoftDevice is enabled and WFE otherwise. An interrupt that finished the
+ *              awaited work after the caller's last check sets the event register, so WFE returns right away instead
+ *              of missing it.
+ */
+__STATIC_INLINE void dk_sleep_until_event(void);
+
+/**
+ * @brief       Sleep while blocking on a peripheral.
+ *
+ * @details     Same as @ref dk_sleep_until_event, the time is accounted as idle when the DK_CPU_LOAD module is
+ *              enabled.
+ */
+__STATIC_INLINE void dk_wait_for_event(void);
+
+#ifndef SUPPRESS_INLINE_IMPLEMENTATION
+__STATIC_INLINE void dk_sleep_until_event(void)
+{
+#if defined(DK_WAIT_FOR_EVENT_HOOK)
+    DK_WAIT_FOR_EVENT_HOOK();
+#else
+#ifdef SOFTDEVICE_PRESENT
+    if (nrf_sdh_is_enabled())
+    {
+        (void)sd_app_evt_wait();
+        return;
+    }
+#endif
+
+    __WFE();
+#endif
+}
+
+__STATIC_INLINE void dk_wait_for_event(void)
+{
+#if DK_MODULE_ENABLED(DK_CPU_LOAD)
+    dk_cpu_load_sleep();
+#else
+    dk_sleep_until_event();
+#endif
+}
+#endif // SUPPRESS_INLINE_IMPLEMENTATION
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // DK_WAIT_FOR_EVENT_H
@@ -0,0 +1,116 @@
+/**
+ * @file        bench_dk_lib.c
+ * @author      Danius Kalvaitis (danius.kalvaitis@gmail.com)
+ * @brief       Host benchmarks of the queue and bus manager hot paths.
+ * @version     0.1
+ * @date        2026-10-17
+ *
+ * @copyright   Copyright (c) Danius Kalvaitis 2026 All rights reserved
+ *
+ */
+
+#include "app_timer.h"
+#include "dk_bench.h"
+#include "dk_host_sim.h"
+#include "dk_host_test.h"
+#include "dk_host_twi.h"
+#include "dk_mpsc_queue.h"
+#include "dk_twi_mngr.h"
+
+#define BENCH_SLAVE_ADDRESS 0x6A
+
+DK_MPSC_QUEUE_DEF(uint32_t, m_queue, 16);
+DK_TWI_MNGR_DEF(m_twi_mngr, 8, 8, 8, 0, 8, 2);
+
+static dk_host_twi_regfile_t m_regfile;
+
+static dk_twi_mngr_config_t const m_twi_config = {
+  .scl                = 26,
+  .sda                = 27,
+  .frequency          = NRF_TWI_FREQ_400K,
+  .interrupt_priority = 6,
+  .hold_bus_uninit    = false,
+};
+
+static void twi_mngr_setup(void)
+{
+    dk_host_test_reset();
+    dk_host_twi_regfile_init(&m_regfile, BENCH_SLAVE_ADDRESS);
+    dk_host_twi_slave_attach(0, &m_regfile.slave);
+
+    (void)app_timer_init();
+    (void)dk_twi_mngr_init(&m_twi_mngr, &m_twi_config);
+}
+
+static void twi_mngr_drain(void)
+{
+    while (!dk_twi_mngr_is_idle(&m_twi_mngr))
+    {
+        dk_host_wait_for_event();
+    }
+}
+
+DK_BENCH(bm_dk_mpsc_queue_push_pop)
+{
+    uint32_t element = 0;
+
+    dk_mpsc_queue_init(&m_queue);
+
+    while (dk_bench_keep_running(p_state))
+    {
+        (void)dk_mpsc_queue_push(&m_queue, &element);
+        (void)dk_mpsc_queue_pop(&m_queue, &element);
+        element++;
+    }
+}
+
+DK_BENCH(bm_dk_twi_mngr_schedule_write)
+{
+    twi_mngr_setup();
+
+    uint64_t bus_start = dk_host_time_get();
+
+    while (dk_bench_keep_running(p_state))
+    {
+        uint8_t *p_buffer = dk_twi_mngr_data_buffer_alloc(&m_twi_mngr, 2);
+        p_buffer[0]       = 0x10;
+        p_buffer[1]       = 0x5A;
+
+        dk_twi_mngr_transaction_t transaction = {
+          .transfer = {.transfer_description = DK_TWI_MNGR_XFER_DESC_TX(BENCH_SLAVE_ADDRESS, p_buffer, 2)},
+        };
+        (void)dk_twi_mngr_schedule(&m_twi_mngr, &transaction);
+        twi_mngr_drain();
+    }
+
+    dk_bench_counter_set(p_state, "bus_us", (double)(dk_host_time_get() - bus_start) / 1000.0);
+    dk_twi_mngr_deinit(&m_twi_mngr);
+}
+
+DK_BENCH(bm_dk_twi_mngr_perform_read)
+{
+    twi_mngr_setup();
+
+    uint8_t reg          = 0x00;
+    uint8_t rx_buffer[6] = {0};
+
+    dk_twi_mngr_transfer_t read = {
+      .transfer_description =
+        DK_TWI_MNGR_XFER_DESC_TXRX(BENCH_SLAVE_ADDRESS, &reg, sizeof(reg), rx_buffer, sizeof(rx_buffer)),
+    };
+
+    uint64_t bus_start = dk_host_time_get();
+
+    while (dk_bench_keep_running(p_state))
+    {
+        (void)dk_twi_mngr_perform(&m_twi_mngr, &read, dk_host_wait_for_event);
+    }
+
+    dk_bench_counter_set(p_state, "bus_us", (double)(dk_host_time_get() - bus_start) / 1000.0);
+    dk_twi_mngr_deinit(&m_twi_mngr);
+}
+
+int main(int argc, char **argv)
+{
+    return dk_bench_main(argc, argv);
+}
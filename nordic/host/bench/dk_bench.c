@@ -0,0 +1,142 @@
+/**
+ * @file        dk_bench.c
+ * @author      Danius Kalvaitis (danius.kalvaitis@gmail.com)
+ * @brief       Minimal benchmark runner of the host build, modelled on Google Benchmark.
+ * @version     0.1
+ * @date        2026-10-17
+ *
+ * @copyright   Copyright (c) Danius Kalvaitis 2026 All rights reserved
+ *
+ */
+
+#include "dk_bench.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define DK_BENCH_MAX_ITERATIONS 1000000000ULL ///< Upper limit of iterations of a single run.
+
+static dk_bench_t *m_p_benches;
+
+static uint64_t clock_ns_get(clockid_t clock_id)
+{
+    struct timespec ts;
+
+    clock_gettime(clock_id, &ts);
+
+    return ((uint64_t)ts.tv_sec * 1000000000ULL) + (uint64_t)ts.tv_nsec;
+}
+
+void dk_bench_register(dk_bench_t *p_bench)
+{
+    // Keep registration order for the report.
+    dk_bench_t **pp_tail = &m_p_benches;
+    while (*pp_tail != NULL)
+    {
+        pp_tail = &(*pp_tail)->p_next;
+    }
+
+    p_bench->p_next = NULL;
+    *pp_tail        = p_bench;
+}
+
+bool dk_bench_keep_running(dk_bench_state_t *p_state)
+{
+    if (p_state->remaining == p_state->iterations)
+    {
+        p_state->wall_start_ns = clock_ns_get(CLOCK_MONOTONIC);
+        p_state->cpu_start_ns  = clock_ns_get(CLOCK_PROCESS_CPUTIME_ID);
+    }
+
+    if (p_state->remaining == 0)
+    {
+        p_state->wall_ns = clock_ns_get(CLOCK_MONOTONIC) - p_state->wall_start_ns;
+        p_state->cpu_ns  = clock_ns_get(CLOCK_PROCESS_CPUTIME_ID) - p_state->cpu_start_ns;
+        return false;
+    }
+
+    p_state->remaining--;
+
+    return true;
+}
+
+void dk_bench_counter_set(dk_bench_state_t *p_state, char const *name, double value)
+{
+    p_state->counter_name  = name;
+    p_state->counter_value = value;
+}
+
+static void bench_run(dk_bench_t const *p_bench, double min_time_s)
+{
+    dk_bench_state_t state;
+    uint64_t         iterations = 1;
+
+    // Grow the iteration count until a run takes at least the minimum time, as Google Benchmark does.
+    for (;;)
+    {
+        memset(&state, 0, sizeof(state));
+        state.iterations = iterations;
+        state.remaining  = iterations;
+
+        p_bench->function(&state);
+
+        double wall_s = (double)state.wall_ns / 1e9;
+        if ((wall_s >= min_time_s) || (iterations >= DK_BENCH_MAX_ITERATIONS))
+        {
+            break;
+        }
+
+        double factor = (wall_s > 0) ? (min_time_s * 1.4 / wall_s) : 10.0;
+        factor        = (factor > 10.0) ? 10.0 : ((factor < 2.0) ? 2.0 : factor);
+        iterations    = (uint64_t)((double)iterations * factor);
+    }
+
+    printf("%-40s %10.1f ns %10.1f ns %12llu",
+           p_bench->name,
+           (double)state.wall_ns / (double)state.iterations,
+           (double)state.cpu_ns / (double)state.iterations,
+           (unsigned long long)state.iterations);
+
+    if (state.counter_name != NULL)
+    {
+        printf(" %s=%.3g", state.counter_name, state.counter_value / (double)state.iterations);
+    }
+
+    printf("\n");
+}
+
+int dk_bench_main(int argc, char **argv)
+{
+    char const *filter     = NULL;
+    double      min_time_s = 0.5;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (strncmp(argv[i], "--benchmark_filter=", 19) == 0)
+        {
+            filter = argv[i] + 19;
+        } else if (strncmp(argv[i], "--benchmark_min_time=", 21) == 0)
+        {
+            min_time_s = strtod(argv[i] + 21, NULL);
+        } else
+        {
+            fprintf(stderr, "Unknown argument %s\n", argv[i]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    printf("%-40s %13s %13s %12s\n", "Benchmark", "Time", "CPU", "Iterations");
+    printf("%.*s\n", 81, "-----------------------------------------------------------------------------------------");
+
+    for (dk_bench_t const *p_bench = m_p_benches; p_bench != NULL; p_bench = p_bench->p_next)
+    {
+        if ((filter == NULL) || (strstr(p_bench->name, filter) != NULL))
+        {
+            bench_run(p_bench, min_time_s);
+        }
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,105 @@
+/**
+ * @file        dk_bench.h
+ * @author      Danius Kalvaitis (danius.kalvaitis@gmail.com)
+ * @brief       Minimal benchmark runner of the host build, modelled on Google Benchmark.
+ * @version     0.1
+ * @date        2026-10-17
+ *
+ * @copyright   Copyright (c) Danius Kalvaitis 2026 All rights reserved
+ *
+ */
+
+#ifndef DK_BENCH_H
+#define DK_BENCH_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief State of a running benchmark.
+ */
+typedef struct
+{
+    uint64_t    iterations;    ///< Iterations of the current run.
+    uint64_t    remaining;     ///< Iterations still to be done.
+    uint64_t    wall_start_ns; ///< Wall clock at the start of the run.
+    uint64_t    cpu_start_ns;  ///< Process CPU time at the start of the run.
+    uint64_t    wall_ns;       ///< Wall time of the run.
+    uint64_t    cpu_ns;        ///< CPU time of the run.
+    char const *counter_name;  ///< Name of the user counter, NULL if not set.
+    double      counter_value; ///< Value of the user counter, reported per iteration.
+} dk_bench_state_t;
+
+typedef void (*dk_bench_function_t)(dk_bench_state_t *p_state); ///< Benchmark function.
+
+/**
+ * @brief Registered benchmark.
+ */
+typedef struct dk_bench_s
+{
+    char const         *name;     ///< Benchmark name.
+    dk_bench_function_t function; ///< Benchmark function.
+    struct dk_bench_s  *p_next;   ///< Next registered benchmark.
+} dk_bench_t;
+
+/**
+ * @brief Macro for defining and registering a benchmark, the body loops on @ref dk_bench_keep_running.
+ *
+ * @param _name Name of the benchmark function.
+ */
+#define DK_BENCH(_name)                                                                                                \
+    static void       _name(dk_bench_state_t *p_state);                                                                \
+    static dk_bench_t _name##_bench = {.name = #_name, .function = _name};                                             \
+    __attribute__((constructor)) static void _name##_register(void)                                                    \
+    {                                                                                                                  \
+        dk_bench_register(&_name##_bench);                                                                             \
+    }                                                                                                                  \
+    static void _name(dk_bench_state_t *p_state)
+
+/**
+ * @brief       Register a benchmark (see @ref DK_BENCH).
+ *
+ * @param[in]   p_bench Pointer to benchmark.
+ */
+void dk_bench_register(dk_bench_t *p_bench);
+
+/**
+ * @brief       Check if the benchmark loop has to do another iteration, starts and stops the timers.
+ *
+ * @param[in]   p_state Pointer to benchmark state.
+ *
+ * @retval      true    If another iteration has to be done.
+ * @retval      false   If the run is finished.
+ */
+bool dk_bench_keep_running(dk_bench_state_t *p_state);
+
+/**
+ * @brief       Report a user counter, the value is divided by the amount of iterations.
+ *
+ * @param[in]   p_state Pointer to benchmark state.
+ * @param[in]   name    Counter name.
+ * @param[in]   value   Total counter value of the run.
+ */
+void dk_bench_counter_set(dk_bench_state_t *p_state, char const *name, double value);
+
+/**
+ * @brief       Run registered benchmarks and print the results.
+ *
+ * @details     Accepts --benchmark_filter=<substring> and --benchmark_min_time=<seconds>.
+ *
+ * @param[in]   argc    Argument count.
+ * @param[in]   argv    Arguments.
+ *
+ * @return      Process exit code.
+ */
+int dk_bench_main(int argc, char **argv);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // DK_BENCH_H
@@ -0,0 +1,28 @@
+/**
+ * @file        ble_config.h
+ * @author      Danius Kalvaitis (danius.kalvaitis@gmail.com)
+ * @brief       BLE configuration of the host build.
+ * @version     0.1
+ * @date        2026-10-17
+ *
+ * @copyright   Copyright (c) Danius Kalvaitis 2026 All rights reserved
+ *
+ */
+
+#ifndef BLE_CONFIG_H
+#define BLE_CONFIG_H
+
+#include <string.h>
+
+#include "ble_srv_common.h"
+#include "dk_ble_uuids.h"
+#include "nrf_sdh_ble.h"
+#include "sdk_macros.h"
+
+#define DK_BLE_ACC_OBSERVER_PRIO        2 ///< Priority of the accelerometer service BLE observer.
+#define DK_BLE_GYRO_OBSERVER_PRIO       2 ///< Priority of the gyroscope service BLE observer.
+#define DK_BLE_MAG_OBSERVER_PRIO        2 ///< Priority of the magnetometer service BLE observer.
+#define DK_BLE_MR_PICKLE_OBSERVER_PRIO  2 ///< Priority of the Mr. Pickle service BLE observer.
+#define DK_BLE_PHIL_IT_UP_OBSERVER_PRIO 2 ///< Priority of the Phil It Up service BLE observer.
+
+#endif // BLE_CONFIG_H
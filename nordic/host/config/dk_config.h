@@ -0,0 +1,43 @@
+/**
+ * @file        dk_config.h
+ * @author      Danius Kalvaitis (danius.kalvaitis@gmail.com)
+ * @brief       DK Lib configuration of the host build.
+ * @version     0.1
+ * @date        2026-10-17
+ *
+ * @copyright   Copyright (c) Danius Kalvaitis 2026 All rights reserved
+ *
+ */
+
+#ifndef DK_CONFIG_H
+#define DK_CONFIG_H
+
+#include "dk_host_sim.h"
+
+#define DK_MPSC_QUEUE_ENABLED    1
+#define DK_TWI_MNGR_ENABLED      1
+#define DK_TWI_BUS_GROUP_ENABLED 1
+#define DK_SPI_MNGR_ENABLED      1
+#define DK_TRACE_ENABLED         1
+#define DK_PROFILE_ENABLED       1
+#define DK_CPU_LOAD_ENABLED      1
+
+#ifndef DK_TWI_MNGR_STATS_ENABLED
+#define DK_TWI_MNGR_STATS_ENABLED 1
+#endif
+
+#ifndef DK_TWI_MNGR_EDF_ENABLED
+#define DK_TWI_MNGR_EDF_ENABLED 1
+#endif
+
+/**
+ * @brief Sleep on the virtual clock, the next simulated interrupt wakes the CPU.
+ */
+#define DK_WAIT_FOR_EVENT_HOOK() dk_host_wait_for_event()
+
+/**
+ * @brief Cycle counter derived from the virtual clock instead of the DWT.
+ */
+#define DK_PROFILE_CYCLES_GET() dk_host_cycles_get()
+
+#endif // DK_CONFIG_H
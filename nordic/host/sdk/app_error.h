@@ -0,0 +1,34 @@
+/**
+ * @file        app_error.h
+ * @author      Danius Kalvaitis (danius.kalvaitis@gmail.com)
+ * @brief       Host stub of the nRF5 SDK error handler, an error aborts the program.
+ * @version     0.1
+ * @date        2026-10-17
+ *
+ * @copyright   Copyright (c) Danius Kalvaitis 2026 All rights reserved
+ *
+ */
+
+#ifndef APP_ERROR_H__
+#define APP_ERROR_H__
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "sdk_errors.h"
+
+/**
+ * @brief Abort the program if the error code is not NRF_SUCCESS.
+ */
+#define APP_ERROR_CHECK(err_code)                                                                                      \
+    do                                                                                                                 \
+    {                                                                                                                  \
+        ret_code_t const local_err_code = (err_code);                                                                  \
+        if (local_err_code != NRF_SUCCESS)                                                                             \
+        {                                                                                                              \
+            fprintf(stderr, "%s:%d: error 0x%x\n", __FILE__, __LINE__, (unsigned int)local_err_code);                  \
+            abort();                                                                                                   \
+        }                                                                                                              \
+    } while (0)
+
+#endif // APP_ERROR_H__
@@ -0,0 +1,62 @@
+/**
+ * @file        app_scheduler.h
+ * @author      Danius Kalvaitis (danius.kalvaitis@gmail.com)
+ * @brief       Host stub of the nRF5 SDK scheduler.
+ * @version     0.1
+ * @date        2026-10-17
+ *
+ * @copyright   Copyright (c) Danius Kalvaitis 2026 All rights reserved
+ *
+ */
+
+#ifndef APP_SCHEDULER_H__
+#define APP_SCHEDULER_H__
+
+#include <stdint.h>
+
+#include "sdk_errors.h"
+
+#ifndef APP_SCHED_EVENT_DATA_MAX_SIZE
+#define APP_SCHED_EVENT_DATA_MAX_SIZE 32 ///< Maximum size of the data of a scheduler event.
+#endif
+
+#ifndef APP_SCHED_QUEUE_SIZE
+#define APP_SCHED_QUEUE_SIZE 16 ///< Maximum amount of queued scheduler events.
+#endif
+
+/**
+ * @brief Scheduler event handler type.
+ */
+typedef void (*app_sched_event_handler_t)(void *p_event_data, uint16_t event_size);
+
+/**
+ * @brief       Drop all queued events.
+ */
+void app_sched_init(void);
+
+/**
+ * @brief       Schedule an event.
+ *
+ * @param[in]   p_event_data    Pointer to event data to be scheduled.
+ * @param[in]   event_size      Size of event data to be scheduled.
+ * @param[in]   handler         Event handler to receive the event.
+ *
+ * @retval      NRF_SUCCESS                 If the event was queued.
+ * @retval      NRF_ERROR_INVALID_LENGTH    If the event data is too large.
+ * @retval      NRF_ERROR_NO_MEM            If the queue is full.
+ */
+ret_code_t app_sched_event_put(void const *p_event_data, uint16_t event_size, app_sched_event_handler_t handler);
+
+/**
+ * @brief       Execute all queued events, in thread mode.
+ */
+void app_sched_execute(void);
+
+/**
+ * @brief       Get the amount of queued events.
+ *
+ * @return      Amount of queued events.
+ */
+uint16_t app_sched_queue_space_used_get(void);
+
+#endif // APP_SCHEDULER_H__
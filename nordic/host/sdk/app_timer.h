@@ -0,0 +1,134 @@
+/**
+ * @file        app_timer.h
+ * @author      Danius Kalvaitis (danius.kalvaitis@gmail.com)
+ * @brief       Host stub of the nRF5 SDK application timer, timers run on the virtual clock.
+ * @version     0.1
+ * @date        2026-10-17
+ *
+ * @copyright   Copyright (c) Danius Kalvaitis 2026 All rights reserved
+ *
+ */
+
+#ifndef APP_TIMER_H__
+#define APP_TIMER_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "app_error.h"
+#include "app_util.h"
+#include "dk_host_sim.h"
+#include "sdk_errors.h"
+
+#define APP_TIMER_CLOCK_FREQ           32768    ///< Clock frequency of the RTC timer.
+#define APP_TIMER_CONFIG_RTC_FREQUENCY 0        ///< Prescaler of the RTC timer.
+#define APP_TIMER_MIN_TIMEOUT_TICKS    5        ///< Minimum value of the timeout_ticks parameter.
+#define APP_TIMER_MAX_CNT_VAL          0xFFFFFF ///< Maximum counter value that can be returned by app_timer_cnt_get.
+
+/**
+ * @brief Convert milliseconds to timer ticks.
+ */
+#define APP_TIMER_TICKS(MS)                                                                                            \
+    ((uint32_t)ROUNDED_DIV((MS) * (uint64_t)APP_TIMER_CLOCK_FREQ, 1000 * (APP_TIMER_CONFIG_RTC_FREQUENCY + 1)))
+
+/**
+ * @brief Timer modes.
+ */
+typedef enum
+{
+    APP_TIMER_MODE_SINGLE_SHOT, ///< The timer will expire only once.
+    APP_TIMER_MODE_REPEATED     ///< The timer will restart each time it expires.
+} app_timer_mode_t;
+
+/**
+ * @brief Application timeout handler type.
+ */
+typedef void (*app_timer_timeout_handler_t)(void *p_context);
+
+/**
+ * @brief Timer node.
+ */
+typedef struct
+{
+    dk_host_event_t             event;           ///< Simulated interrupt of the expiry.
+    app_timer_timeout_handler_t timeout_handler; ///< Function called when the timer expires.
+    app_timer_mode_t            mode;            ///< Timer mode.
+    uint32_t                    period;          ///< Period of a repeated timer in ticks.
+    uint64_t                    expiry_tick;     ///< Absolute tick of the next expiry.
+    void                       *p_context;       ///< Context passed to the timeout handler.
+} app_timer_t;
+
+typedef app_timer_t *app_timer_id_t; ///< Timer ID type.
+
+/**
+ * @brief Create a timer identifier and statically allocate memory for the timer.
+ */
+#define APP_TIMER_DEF(timer_id)                                                                                        \
+    static app_timer_t          CONCAT_2(timer_id, _data) = {.timeout_handler = NULL};                                 \
+    static app_timer_id_t const timer_id                  = &CONCAT_2(timer_id, _data)
+
+/**
+ * @brief       Initialize the timer module.
+ *
+ * @return      NRF_SUCCESS.
+ */
+ret_code_t app_timer_init(void);
+
+/**
+ * @brief       Create a timer.
+ *
+ * @param[in]   p_timer_id          Pointer to timer identifier.
+ * @param[in]   mode                Timer mode.
+ * @param[in]   timeout_handler     Function to be executed when the timer expires.
+ *
+ * @retval      NRF_SUCCESS             If the timer was successfully created.
+ * @retval      NRF_ERROR_INVALID_PARAM If a parameter was invalid.
+ */
+ret_code_t app_timer_create(app_timer_id_t const      *p_timer_id,
+                            app_timer_mode_t            mode,
+                            app_timer_timeout_handler_t timeout_handler);
+
+/**
+ * @brief       Start a timer, a running timer is restarted.
+ *
+ * @param[in]   timer_id        Timer identifier.
+ * @param[in]   timeout_ticks   Number of ticks to timeout event.
+ * @param[in]   p_context       General purpose pointer passed to the timeout handler.
+ *
+ * @retval      NRF_SUCCESS             If the timer was successfully started.
+ * @retval      NRF_ERROR_INVALID_PARAM If a parameter was invalid.
+ * @retval      NRF_ERROR_INVALID_STATE If the timer was not created.
+ */
+ret_code_t app_timer_start(app_timer_id_t timer_id, uint32_t timeout_ticks, void *p_context);
+
+/**
+ * @brief       Stop a timer.
+ *
+ * @param[in]   timer_id    Timer identifier.
+ *
+ * @retval      NRF_SUCCESS             If the timer was successfully stopped.
+ * @retval      NRF_ERROR_INVALID_PARAM If a parameter was invalid.
+ */
+ret_code_t app_timer_stop(app_timer_id_t timer_id);
+
+/**
+ * @brief       Get the current value of the RTC counter.
+ *
+ * @return      Virtual time in ticks, wrapping at @ref APP_TIMER_MAX_CNT_VAL.
+ */
+uint32_t app_timer_cnt_get(void);
+
+/**
+ * @brief       Compute the difference between two RTC counter values.
+ *
+ * @param[in]   ticks_to    Value returned by app_timer_cnt_get().
+ * @param[in]   ticks_from  Value returned by app_timer_cnt_get().
+ *
+ * @return      Number of ticks from ticks_from to ticks_to.
+ */
+static inline uint32_t app_timer_cnt_diff_compute(uint32_t ticks_to, uint32_t ticks_from)
+{
+    return (ticks_to - ticks_from) & APP_TIMER_MAX_CNT_VAL;
+}
+
+#endif // APP_TIMER_H__
@@ -0,0 +1,65 @@
+/**
+ * @file        app_util.h
+ * @author      Danius Kalvaitis (danius.kalvaitis@gmail.com)
+ * @brief       Host stub of the nRF5 SDK utility macros.
+ * @version     0.1
+ * @date        2026-10-17
+ *
+ * @copyright   Copyright (c) Danius Kalvaitis 2026 All rights reserved
+ *
+ */
+
+#ifndef APP_UTIL_H__
+#define APP_UTIL_H__
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "nordic_common.h"
+#include "nrf.h"
+
+#define STATIC_ASSERT(EXPR) _Static_assert((EXPR), #EXPR) ///< Compile time assertion.
+
+#define ARRAY_SIZE(arr) (sizeof(arr) / sizeof((arr)[0])) ///< Amount of elements of an array.
+
+/**
+ * @brief       Decode a little endian 16-bit value.
+ *
+ * @param[in]   p_encoded_data  Pointer to the encoded value.
+ *
+ * @return      Decoded value.
+ */
+static inline uint16_t uint16_decode(uint8_t const *p_encoded_data)
+{
+    return (uint16_t)(((uint16_t)p_encoded_data[0]) | ((uint16_t)p_encoded_data[1] << 8));
+}
+
+/**
+ * @brief       Encode a 16-bit value little endian.
+ *
+ * @param[in]   value           Value to encode.
+ * @param[out]  p_encoded_data  Buffer the value is written to.
+ *
+ * @return      Amount of bytes written.
+ */
+static inline uint8_t uint16_encode(uint16_t value, uint8_t *p_encoded_data)
+{
+    p_encoded_data[0] = (uint8_t)(value & 0xFF);
+    p_encoded_data[1] = (uint8_t)(value >> 8);
+    return sizeof(uint16_t);
+}
+
+/**
+ * @brief       Decode a 16-bit value big endian.
+ *
+ * @param[in]   p_encoded_data  Buffer where the encoded data is stored.
+ *
+ * @return      Decoded value.
+ */
+static inline uint16_t uint16_big_decode(uint8_t const *p_encoded_data)
+{
+    return (uint16_t)(((uint16_t)p_encoded_data[0] << 8) | ((uint16_t)p_encoded_data[1]));
+}
+
+#endif // APP_UTIL_H__
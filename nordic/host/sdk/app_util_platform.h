@@ -0,0 +1,32 @@
+/**
+ * @file        app_util_platform.h
+ * @author      Danius Kalvaitis (danius.kalvaitis@gmail.com)
+ * @brief       Host stub of the nRF5 SDK platform utilities, critical regions are simulated.
+ * @version     0.1
+ * @date        2026-10-17
+ *
+ * @copyright   Copyright (c) Danius Kalvaitis 2026 All rights reserved
+ *
+ */
+
+#ifndef APP_UTIL_PLATFORM_H__
+#define APP_UTIL_PLATFORM_H__
+
+#include "app_util.h"
+#include "dk_host_sim.h"
+
+/**
+ * @brief Enter a critical region, simulated interrupts stay pending until it is left.
+ */
+#define CRITICAL_REGION_ENTER()                                                                                        \
+    {                                                                                                                  \
+        dk_host_critical_enter();
+
+/**
+ * @brief Leave a critical region entered with @ref CRITICAL_REGION_ENTER.
+ */
+#define CRITICAL_REGION_EXIT()                                                                                         \
+    dk_host_critical_exit();                                                                                           \
+    }
+
+#endif // APP_UTIL_PLATFORM_H__
@@ -0,0 +1,310 @@
+/**
+ * @file        ble.h
+ * @author      Danius Kalvaitis (danius.kalvaitis@gmail.com)
+ * @brief       Host stub of the SoftDevice BLE API, the GATT server is simulated by dk_host_ble.
+ * @version     0.1
+ * @date        2026-10-17
+ *
+ * @copyright   Copyright (c) Danius Kalvaitis 2026 All rights reserved
+ *
+ */
+
+#ifndef BLE_H__
+#define BLE_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "nrf_error.h"
+
+#define BLE_CONN_HANDLE_INVALID     0xFFFF ///< Invalid connection handle.
+#define BLE_UUID_TYPE_VENDOR_BEGIN  0x02   ///< First UUID type of vendor specific UUIDs.
+#define BLE_GATTS_SRVC_TYPE_PRIMARY 0x01   ///< Primary service.
+#define BLE_GATTS_VLOC_STACK        0x01   ///< Attribute value is located in stack memory.
+#define BLE_GATT_HVX_NOTIFICATION   0x01   ///< Handle value notification.
+#define BLE_GATT_CPF_FORMAT_BOOLEAN 0x01   ///< Boolean characteristic presentation format.
+#define BLE_GATT_CPF_FORMAT_FLOAT32 0x14   ///< IEEE-754 32-bit floating point characteristic presentation format.
+
+/**
+ * @brief BLE event IDs.
+ */
+enum
+{
+    BLE_GAP_EVT_CONNECTED    = 0x10, ///< Connected to peer.
+    BLE_GAP_EVT_DISCONNECTED = 0x11, ///< Disconnected from peer.
+    BLE_GATTS_EVT_WRITE      = 0x50, ///< Write operation performed.
+};
+
+/**
+ * @brief Set sec_mode pointed to by ptr to have no access rights.
+ */
+#define BLE_GAP_CONN_SEC_MODE_SET_NO_ACCESS(ptr)                                                                       \
+    do                                                                                                                 \
+    {                                                                                                                  \
+        (ptr)->sm = 0;                                                                                                 \
+        (ptr)->lv = 0;                                                                                                 \
+    } while (0)
+
+/**
+ * @brief Set sec_mode pointed to by ptr to require no protection, open link.
+ */
+#define BLE_GAP_CONN_SEC_MODE_SET_OPEN(ptr)                                                                            \
+    do                                                                                                                 \
+    {                                                                                                                  \
+        (ptr)->sm = 1;                                                                                                 \
+        (ptr)->lv = 1;                                                                                                 \
+    } while (0)
+
+/**
+ * @brief Bluetooth Low Energy UUID type, encapsulates both 16-bit and 128-bit UUIDs.
+ */
+typedef struct
+{
+    uint16_t uuid; ///< 16-bit UUID value or octets 12-13 of 128-bit UUID.
+    uint8_t  type; ///< UUID type.
+} ble_uuid_t;
+
+/**
+ * @brief 128 bit UUID values.
+ */
+typedef struct
+{
+    uint8_t uuid128[16]; ///< Little-Endian UUID bytes.
+} ble_uuid128_t;
+
+/**
+ * @brief GAP connection security modes.
+ */
+typedef struct
+{
+    uint8_t sm : 4; ///< Security Mode (1 or 2), 0 for no permissions at all.
+    uint8_t lv : 4; ///< Level (1, 2, 3 or 4), 0 for no permissions at all.
+} ble_gap_conn_sec_mode_t;
+
+/**
+ * @brief Attribute metadata.
+ */
+typedef struct
+{
+    ble_gap_conn_sec_mode_t read_perm;   ///< Read permissions.
+    ble_gap_conn_sec_mode_t write_perm;  ///< Write permissions.
+    uint8_t                 vlen : 1;    ///< Variable length attribute.
+    uint8_t                 vloc : 2;    ///< Value location.
+    uint8_t                 rd_auth : 1; ///< Read authorization and value will be requested from the application.
+    uint8_t                 wr_auth : 1; ///< Write authorization will be requested from the application.
+} ble_gatts_attr_md_t;
+
+/**
+ * @brief GATT Characteristic Properties.
+ */
+typedef struct
+{
+    uint8_t broadcast : 1;      ///< Broadcasting of the value permitted.
+    uint8_t read : 1;           ///< Reading the value permitted.
+    uint8_t write_wo_resp : 1;  ///< Writing the value with Write Command permitted.
+    uint8_t write : 1;          ///< Writing the value with Write Request permitted.
+    uint8_t notify : 1;         ///< Notification of the value permitted.
+    uint8_t indicate : 1;       ///< Indications of the value permitted.
+    uint8_t auth_signed_wr : 1; ///< Writing the value with Signed Write Command permitted.
+} ble_gatt_char_props_t;
+
+/**
+ * @brief GATT Characteristic Presentation Format.
+ */
+typedef struct
+{
+    uint8_t  format;     ///< Format of the value.
+    int8_t   exponent;   ///< Exponent for integer data types.
+    uint16_t unit;       ///< Unit from Bluetooth Assigned Numbers.
+    uint8_t  name_space; ///< Namespace from Bluetooth Assigned Numbers.
+    uint16_t desc;       ///< Namespace description from Bluetooth Assigned Numbers.
+} ble_gatts_char_pf_t;
+
+/**
+ * @brief GATT Characteristic metadata.
+ */
+typedef struct
+{
+    ble_gatt_char_props_t      char_props;              ///< Characteristic Properties.
+    uint8_t const             *p_char_user_desc;        ///< Pointer to a UTF-8 encoded string, NULL if not required.
+    uint16_t                   char_user_desc_max_size; ///< The maximum size in bytes of the user description.
+    uint16_t                   char_user_desc_size;     ///< The size of the user description.
+    ble_gatts_char_pf_t const *p_char_pf;               ///< Pointer to a presentation format structure or NULL.
+    ble_gatts_attr_md_t const *p_user_desc_md;          ///< Attribute metadata for the User Description descriptor.
+    ble_gatts_attr_md_t const *p_cccd_md;               ///< Attribute metadata for the CCCD or NULL.
+    ble_gatts_attr_md_t const *p_sccd_md;               ///< Attribute metadata for the SCCD or NULL.
+} ble_gatts_char_md_t;
+
+/**
+ * @brief GATT Attribute.
+ */
+typedef struct
+{
+    ble_uuid_t const          *p_uuid;    ///< Pointer to the attribute UUID.
+    ble_gatts_attr_md_t const *p_attr_md; ///< Pointer to the attribute metadata structure.
+    uint16_t                   init_len;  ///< Initial attribute value length in bytes.
+    uint16_t                   init_offs; ///< Initial attribute value offset in bytes.
+    uint16_t                   max_len;   ///< Maximum attribute value length in bytes.
+    uint8_t                   *p_value;   ///< Pointer to the attribute data.
+} ble_gatts_attr_t;
+
+/**
+ * @brief GATT Attribute Value.
+ */
+typedef struct
+{
+    uint16_t len;     ///< Length in bytes to be written or read.
+    uint16_t offset;  ///< Attribute value offset.
+    uint8_t *p_value; ///< Pointer to where value is stored or will be stored.
+} ble_gatts_value_t;
+
+/**
+ * @brief GATT Characteristic Definition Handles.
+ */
+typedef struct
+{
+    uint16_t value_handle;     ///< Handle to the characteristic value.
+    uint16_t user_desc_handle; ///< Handle to the User Description descriptor.
+    uint16_t cccd_handle;      ///< Handle to the Client Characteristic Configuration Descriptor.
+    uint16_t sccd_handle;      ///< Handle to the Server Characteristic Configuration Descriptor.
+} ble_gatts_char_handles_t;
+
+/**
+ * @brief GATT HVx parameters.
+ */
+typedef struct
+{
+    uint16_t       handle; ///< Characteristic Value Handle.
+    uint8_t        type;   ///< Indication or Notification.
+    uint16_t       offset; ///< Offset within the attribute value.
+    uint16_t      *p_len;  ///< Length in bytes to be written, length in bytes written after return.
+    uint8_t const *p_data; ///< Actual data content, use NULL to use the current attribute value.
+} ble_gatts_hvx_params_t;
+
+/**
+ * @brief Event structure for @ref BLE_GATTS_EVT_WRITE.
+ */
+typedef struct
+{
+    uint16_t   handle;        ///< Attribute Handle.
+    ble_uuid_t uuid;          ///< Attribute UUID.
+    uint8_t    op;            ///< Type of write operation.
+    uint8_t    auth_required; ///< Writing operation deferred due to authorization requirement.
+    uint16_t   offset;        ///< Offset for the write operation.
+    uint16_t   len;           ///< Length of the received data.
+    uint8_t    data[20];      ///< Received data, the SoftDevice uses a variable length array.
+} ble_gatts_evt_write_t;
+
+/**
+ * @brief GATTS event structure.
+ */
+typedef struct
+{
+    uint16_t conn_handle; ///< Connection Handle on which the event occurred.
+    union
+    {
+        ble_gatts_evt_write_t write; ///< Write Event Parameters.
+    } params;                        ///< Event Parameters.
+} ble_gatts_evt_t;
+
+/**
+ * @brief GAP event structure.
+ */
+typedef struct
+{
+    uint16_t conn_handle; ///< Connection Handle on which the event occurred.
+} ble_gap_evt_t;
+
+/**
+ * @brief BLE event header.
+ */
+typedef struct
+{
+    uint16_t evt_id;  ///< Value from a BLE_<module>_EVT series.
+    uint16_t evt_len; ///< Length in octets including this header.
+} ble_evt_hdr_t;
+
+/**
+ * @brief Common BLE Event type, wrapping the module specific event reports.
+ */
+typedef struct
+{
+    ble_evt_hdr_t header; ///< Event header.
+    union
+    {
+        ble_gap_evt_t   gap_evt;   ///< GAP originated event.
+        ble_gatts_evt_t gatts_evt; ///< GATT server originated event.
+    } evt;                         ///< Event union.
+} ble_evt_t;
+
+/**
+ * @brief       Add a Vendor Specific base UUID.
+ *
+ * @param[in]   p_vs_uuid   Pointer to a 16-octet (128-bit) little endian Vendor Specific base UUID.
+ * @param[out]  p_uuid_type Pointer to a uint8_t where the type field in @ref ble_uuid_t will be stored.
+ *
+ * @return      NRF_SUCCESS, or NRF_ERROR_NO_MEM if there are no more free slots for VS UUIDs.
+ */
+uint32_t sd_ble_uuid_vs_add(ble_uuid128_t const *p_vs_uuid, uint8_t *p_uuid_type);
+
+/**
+ * @brief       Add a service declaration to the Attribute Table.
+ *
+ * @param[in]   type        Toggles between primary and secondary services.
+ * @param[in]   p_uuid      Pointer to service UUID.
+ * @param[out]  p_handle    Pointer to a 16-bit word where the assigned handle will be stored.
+ *
+ * @return      NRF_SUCCESS, or NRF_ERROR_NO_MEM if the attribute table is full.
+ */
+uint32_t sd_ble_gatts_service_add(uint8_t type, ble_uuid_t const *p_uuid, uint16_t *p_handle);
+
+/**
+ * @brief       Add a characteristic declaration, a characteristic value declaration and descriptors.
+ *
+ * @param[in]   service_handle      Handle of the service where the characteristic is to be placed.
+ * @param[in]   p_char_md           Characteristic metadata.
+ * @param[in]   p_attr_char_value   Pointer to the attribute structure corresponding to the characteristic value.
+ * @param[out]  p_handles           Pointer to the structure where the assigned handles will be stored.
+ *
+ * @return      NRF_SUCCESS, NRF_ERROR_INVALID_PARAM or NRF_ERROR_NO_MEM.
+ */
+uint32_t sd_ble_gatts_characteristic_add(uint16_t                   service_handle,
+                                         ble_gatts_char_md_t const *p_char_md,
+                                         ble_gatts_attr_t const    *p_attr_char_value,
+                                         ble_gatts_char_handles_t  *p_handles);
+
+/**
+ * @brief       Set the value of a given attribute.
+ *
+ * @param[in]       conn_handle Connection handle.
+ * @param[in]       handle      Attribute handle.
+ * @param[in,out]   p_value     Attribute value information.
+ *
+ * @return      NRF_SUCCESS, NRF_ERROR_NOT_FOUND or NRF_ERROR_INVALID_PARAM.
+ */
+uint32_t sd_ble_gatts_value_set(uint16_t conn_handle, uint16_t handle, ble_gatts_value_t *p_value);
+
+/**
+ * @brief       Get the value of a given attribute.
+ *
+ * @param[in]       conn_handle Connection handle.
+ * @param[in]       handle      Attribute handle.
+ * @param[in,out]   p_value     Attribute value information, len is updated to the amount of bytes copied.
+ *
+ * @return      NRF_SUCCESS or NRF_ERROR_NOT_FOUND.
+ */
+uint32_t sd_ble_gatts_value_get(uint16_t conn_handle, uint16_t handle, ble_gatts_value_t *p_value);
+
+/**
+ * @brief       Notify or Indicate an attribute value.
+ *
+ * @param[in]       conn_handle     Connection handle.
+ * @param[in]       p_hvx_params    Pointer to an HVx parameters structure.
+ *
+ * @return      NRF_SUCCESS, NRF_ERROR_NOT_FOUND, NRF_ERROR_INVALID_STATE if notifications are disabled or
+ *              NRF_ERROR_RESOURCES if the notification queue is full.
+ */
+uint32_t sd_ble_gatts_hvx(uint16_t conn_handle, ble_gatts_hvx_params_t const *p_hvx_params);
+
+#endif // BLE_H__
@@ -0,0 +1,95 @@
+/**
+ * @file        ble_srv_common.h
+ * @author      Danius Kalvaitis (danius.kalvaitis@gmail.com)
+ * @brief       Host stub of the nRF5 SDK common BLE service helpers.
+ * @version     0.1
+ * @date        2026-10-17
+ *
+ * @copyright   Copyright (c) Danius Kalvaitis 2026 All rights reserved
+ *
+ */
+
+#ifndef BLE_SRV_COMMON_H__
+#define BLE_SRV_COMMON_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "app_util.h"
+#include "ble.h"
+
+#define ORG_BLUETOOTH_UNIT_THERMODYNAMIC_TEMPERATURE_DEGREE_CELSIUS 0x272F ///< Degree Celsius unit.
+
+/**
+ * @brief Security requirements of an attribute.
+ */
+typedef enum
+{
+    SEC_NO_ACCESS   = 0, ///< Not possible to access.
+    SEC_OPEN        = 1, ///< Access open.
+    SEC_JUST_WORKS  = 2, ///< Access possible with 'Just Works' security at least.
+    SEC_MITM        = 3, ///< Access possible with 'MITM' security at least.
+    SEC_SIGNED      = 4, ///< Access possible with 'signed' security at least.
+    SEC_SIGNED_MITM = 5, ///< Access possible with 'signed and MITM' security at least.
+} security_req_t;
+
+/**
+ * @brief Characteristic User Descriptor parameters.
+ */
+typedef struct
+{
+    uint16_t       max_size;         ///< Maximum size of the user descriptor.
+    uint16_t       size;             ///< Size of the user descriptor.
+    uint8_t const *p_char_user_desc; ///< User descriptor content, pointer to a UTF-8 encoded string.
+    security_req_t read_access;      ///< Security requirement for reading the user descriptor.
+    security_req_t write_access;     ///< Security requirement for writing the user descriptor.
+} ble_add_char_user_desc_t;
+
+/**
+ * @brief Add characteristic parameters structure.
+ */
+typedef struct
+{
+    uint16_t                  uuid;                  ///< Characteristic UUID (16 bits UUIDs).
+    uint8_t                   uuid_type;             ///< Base UUID.
+    uint16_t                  max_len;               ///< Maximum length of the characteristic value.
+    uint16_t                  init_len;              ///< Initial length of the characteristic value.
+    uint8_t                  *p_init_value;          ///< Initial encoded value of the characteristic.
+    bool                      is_var_len;            ///< Indicates if the characteristic value has variable length.
+    ble_gatt_char_props_t     char_props;            ///< Characteristic properties.
+    bool                      is_defered_read;       ///< Indicate if deferred read operations are supported.
+    bool                      is_defered_write;      ///< Indicate if deferred write operations are supported.
+    security_req_t            read_access;           ///< Security requirement for reading the value.
+    security_req_t            write_access;          ///< Security requirement for writing the value.
+    security_req_t            cccd_write_access;     ///< Security requirement for writing the CCCD.
+    bool                      is_value_user;         ///< Characteristic value is in user memory.
+    ble_add_char_user_desc_t *p_user_descr;          ///< Pointer to user descriptor if needed.
+    ble_gatts_char_pf_t      *p_presentation_format; ///< Pointer to characteristic format if needed.
+} ble_add_char_params_t;
+
+/**
+ * @brief       Add a characteristic to a service.
+ *
+ * @param[in]   service_handle  Handle of the service to which the characteristic is to be added.
+ * @param[in]   p_char_props    Information needed to add the characteristic.
+ * @param[out]  p_char_handle   Handle of the added characteristic.
+ *
+ * @return      Error code of sd_ble_gatts_characteristic_add.
+ */
+uint32_t characteristic_add(uint16_t                  service_handle,
+                            ble_add_char_params_t    *p_char_props,
+                            ble_gatts_char_handles_t *p_char_handle);
+
+/**
+ * @brief       Check if notifications are enabled in a CCCD value.
+ *
+ * @param[in]   p_encoded_data  CCCD value, little endian.
+ *
+ * @return      True if notifications are enabled.
+ */
+static inline bool ble_srv_is_notification_enabled(uint8_t const *p_encoded_data)
+{
+    return (uint16_decode(p_encoded_data) & BLE_GATT_HVX_NOTIFICATION) != 0;
+}
+
+#endif // BLE_SRV_COMMON_H__
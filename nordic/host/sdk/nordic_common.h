@@ -0,0 +1,39 @@
+/**
+ * @file        nordic_common.h
+ * @author      Danius Kalvaitis (danius.kalvaitis@gmail.com)
+ * @brief       Host stub of the nRF5 SDK common macros.
+ * @version     0.1
+ * @date        2026-10-17
+ *
+ * @copyright   Copyright (c) Danius Kalvaitis 2026 All rights reserved
+ *
+ */
+
+#ifndef NORDIC_COMMON_H__
+#define NORDIC_COMMON_H__
+
+#include <stdint.h>
+
+#ifndef MIN
+#define MIN(a, b) ((a) < (b) ? (a) : (b)) ///< Smaller of two values.
+#endif
+
+#ifndef MAX
+#define MAX(a, b) ((a) < (b) ? (b) : (a)) ///< Larger of two values.
+#endif
+
+#define CONCAT_2(p1, p2)         CONCAT_2_(p1, p2)         ///< Concatenate two expanded tokens.
+#define CONCAT_2_(p1, p2)        p1##p2                    ///< Auxiliary macro of @ref CONCAT_2.
+#define CONCAT_3(p1, p2, p3)     CONCAT_3_(p1, p2, p3)     ///< Concatenate three expanded tokens.
+#define CONCAT_3_(p1, p2, p3)    p1##p2##p3                ///< Auxiliary macro of @ref CONCAT_3.
+#define STRINGIFY(val)           STRINGIFY_(val)           ///< Expanded token as a string.
+#define STRINGIFY_(val)          #val                      ///< Auxiliary macro of @ref STRINGIFY.
+#define UNUSED_VARIABLE(X)       ((void)(X))               ///< Silence an unused variable.
+#define UNUSED_PARAMETER(X)      UNUSED_VARIABLE(X)        ///< Silence an unused parameter.
+#define UNUSED_RETURN_VALUE(X)   UNUSED_VARIABLE(X)        ///< Silence an unused return value.
+#define IS_POWER_OF_TWO(A)       (((A) != 0) && ((((A) - 1) & (A)) == 0)) ///< Check if a value is a power of two.
+#define ROUNDED_DIV(A, B)        (((A) + ((B) / 2)) / (B)) ///< Division rounded to the nearest integer.
+#define CEIL_DIV(A, B)           (((A) + (B) - 1) / (B))   ///< Division rounded up.
+#define ALIGN_NUM(alignment, sz) ((((sz) + (alignment) - 1) / (alignment)) * (alignment)) ///< Round up to alignment.
+
+#endif // NORDIC_COMMON_H__
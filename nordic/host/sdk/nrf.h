@@ -0,0 +1,67 @@
+/**
+ * @file        nrf.h
+ * @author      Danius Kalvaitis (danius.kalvaitis@gmail.com)
+ * @brief       Host stub of the nRF52 device header, peripherals are plain memory blocks.
+ * @version     0.1
+ * @date        2026-10-17
+ *
+ * @copyright   Copyright (c) Danius Kalvaitis 2026 All rights reserved
+ *
+ */
+
+#ifndef NRF_H
+#define NRF_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "dk_host_sim.h"
+
+#ifndef __STATIC_INLINE
+#define __STATIC_INLINE static inline
+#endif
+
+#define __WFE() dk_host_wait_for_event()
+#define __SEV() ((void)0)
+
+/**
+ * @brief Count leading zeros, 32 for 0 as on Cortex-M (__builtin_clz is undefined for 0).
+ */
+__STATIC_INLINE uint8_t __CLZ(uint32_t value)
+{
+    return (value == 0) ? 32 : (uint8_t)__builtin_clz(value);
+}
+
+#define SPIM0_EASYDMA_MAXCNT_SIZE 8 ///< Width of the SPIM EasyDMA MAXCNT register in bits on nRF52832.
+
+/**
+ * @brief Register block of a serial peripheral. Only the size matters on the host, offset 0xFFC is the POWER register
+ *        toggled by the ERRATA 89 workaround.
+ */
+typedef struct
+{
+    volatile uint32_t reg[0x1000 / sizeof(uint32_t)]; ///< Registers.
+} NRF_SERIAL_Type;
+
+typedef NRF_SERIAL_Type NRF_TWI_Type;  ///< TWI master registers.
+typedef NRF_SERIAL_Type NRF_TWIM_Type; ///< TWI master with EasyDMA registers.
+typedef NRF_SERIAL_Type NRF_SPI_Type;  ///< SPI master registers.
+typedef NRF_SERIAL_Type NRF_SPIM_Type; ///< SPI master with EasyDMA registers.
+
+typedef int32_t IRQn_Type; ///< Interrupt number.
+
+extern NRF_SERIAL_Type dk_host_serial_regs[3]; ///< Memory of the serial peripherals 0 to 2.
+
+#define NRF_TWI0  (&dk_host_serial_regs[0]) ///< TWI instance 0.
+#define NRF_TWI1  (&dk_host_serial_regs[1]) ///< TWI instance 1.
+#define NRF_TWIM0 NRF_TWI0                  ///< TWIM instance 0, shares the peripheral with TWI instance 0.
+#define NRF_TWIM1 NRF_TWI1                  ///< TWIM instance 1, shares the peripheral with TWI instance 1.
+#define NRF_SPI0  NRF_TWI0                  ///< SPI instance 0, shares the peripheral with TWI instance 0.
+#define NRF_SPI1  NRF_TWI1                  ///< SPI instance 1, shares the peripheral with TWI instance 1.
+#define NRF_SPI2  (&dk_host_serial_regs[2]) ///< SPI instance 2.
+#define NRF_SPIM0 NRF_SPI0                  ///< SPIM instance 0.
+#define NRF_SPIM1 NRF_SPI1                  ///< SPIM instance 1.
+#define NRF_SPIM2 NRF_SPI2                  ///< SPIM instance 2.
+
+#endif // NRF_H
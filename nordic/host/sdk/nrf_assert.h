@@ -0,0 +1,31 @@
+/**
+ * @file        nrf_assert.h
+ * @author      Danius Kalvaitis (danius.kalvaitis@gmail.com)
+ * @brief       Host stub of the nRF5 SDK assertions, a failed assertion aborts the program.
+ * @version     0.1
+ * @date        2026-10-17
+ *
+ * @copyright   Copyright (c) Danius Kalvaitis 2026 All rights reserved
+ *
+ */
+
+#ifndef NRF_ASSERT_H_
+#define NRF_ASSERT_H_
+
+#include <stdio.h>
+#include <stdlib.h>
+
+/**
+ * @brief Abort the program with the location of the failed expression.
+ */
+#define ASSERT(expr)                                                                                                   \
+    do                                                                                                                 \
+    {                                                                                                                  \
+        if (!(expr))                                                                                                   \
+        {                                                                                                              \
+            fprintf(stderr, "%s:%d: assertion failed: %s\n", __FILE__, __LINE__, #expr);                               \
+            abort();                                                                                                   \
+        }                                                                                                              \
+    } while (0)
+
+#endif // NRF_ASSERT_H_
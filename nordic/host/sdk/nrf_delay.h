@@ -0,0 +1,39 @@
+/**
+ * @file        nrf_delay.h
+ * @author      Danius Kalvaitis (danius.kalvaitis@gmail.com)
+ * @brief       Host stub of the nRF5 SDK busy wait, virtual time passes instead.
+ * @version     0.1
+ * @date        2026-10-17
+ *
+ * @copyright   Copyright (c) Danius Kalvaitis 2026 All rights reserved
+ *
+ */
+
+#ifndef NRF_DELAY_H
+#define NRF_DELAY_H
+
+#include <stdint.h>
+
+#include "dk_host_sim.h"
+
+/**
+ * @brief       Busy wait for a number of microseconds.
+ *
+ * @param[in]   us_time Microseconds to wait.
+ */
+static inline void nrf_delay_us(uint32_t us_time)
+{
+    dk_host_time_advance((uint64_t)us_time * 1000);
+}
+
+/**
+ * @brief       Busy wait for a number of milliseconds.
+ *
+ * @param[in]   ms_time Milliseconds to wait.
+ */
+static inline void nrf_delay_ms(uint32_t ms_time)
+{
+    dk_host_time_advance((uint64_t)ms_time * 1000000);
+}
+
+#endif // NRF_DELAY_H
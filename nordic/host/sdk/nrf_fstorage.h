@@ -0,0 +1,166 @@
+/**
+ * @file        nrf_fstorage.h
+ * @author      Danius Kalvaitis (danius.kalvaitis@gmail.com)
+ * @brief       Host stub of the nRF5 SDK flash storage, flash is simulated by dk_host_fstorage.
+ * @version     0.1
+ * @date        2026-10-17
+ *
+ * @copyright   Copyright (c) Danius Kalvaitis 2026 All rights reserved
+ *
+ */
+
+#ifndef NRF_FSTORAGE_H__
+#define NRF_FSTORAGE_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "sdk_errors.h"
+
+/**
+ * @brief Event IDs.
+ */
+typedef enum
+{
+    NRF_FSTORAGE_EVT_READ_RESULT,  ///< Unused event reserved for a possible future feature.
+    NRF_FSTORAGE_EVT_WRITE_RESULT, ///< Event for @ref nrf_fstorage_write.
+    NRF_FSTORAGE_EVT_ERASE_RESULT, ///< Event for @ref nrf_fstorage_erase.
+} nrf_fstorage_evt_id_t;
+
+/**
+ * @brief An fstorage event.
+ */
+typedef struct
+{
+    nrf_fstorage_evt_id_t id;      ///< The event ID.
+    ret_code_t            result;  ///< Result of the operation.
+    uint32_t              addr;    ///< Address at which the operation was performed.
+    void const           *p_src;   ///< Buffer written to flash.
+    uint32_t              len;     ///< Length of the operation.
+    void                 *p_param; ///< User-defined parameter passed to the event handler.
+} nrf_fstorage_evt_t;
+
+/**
+ * @brief Event handler function prototype.
+ */
+typedef void (*nrf_fstorage_evt_handler_t)(nrf_fstorage_evt_t *p_evt);
+
+/**
+ * @brief Information about the implementation and the flash peripheral.
+ */
+typedef struct
+{
+    uint32_t erase_unit;   ///< Size of a flash page (in bytes).
+    uint32_t program_unit; ///< Size of the smallest programmable unit (in bytes).
+    bool     rmap;         ///< The device address space is memory mapped to the MCU address space.
+    bool     wmap;         ///< The device address space is memory mapped to a writable MCU address space.
+} nrf_fstorage_info_t;
+
+typedef struct nrf_fstorage_api_s nrf_fstorage_api_t; ///< Flash storage API.
+
+/**
+ * @brief An fstorage instance.
+ */
+typedef struct
+{
+    nrf_fstorage_api_t const  *p_api;        ///< The API implementation used by this instance.
+    nrf_fstorage_info_t const *p_flash_info; ///< Information about the implementation functionality.
+    nrf_fstorage_evt_handler_t evt_handler;  ///< The event handler function.
+    uint32_t                   start_addr;   ///< The beginning of the flash space on which this instance operates.
+    uint32_t                   end_addr;     ///< The last address (exclusive) of the flash space of this instance.
+} nrf_fstorage_t;
+
+/**
+ * @brief Functions provided by the API implementation.
+ */
+struct nrf_fstorage_api_s
+{
+    ret_code_t (*init)(nrf_fstorage_t *p_fs, void *p_param); ///< Initialize the flash peripheral.
+    ret_code_t (*read)(nrf_fstorage_t const *p_fs, uint32_t src, void *p_dest, uint32_t len); ///< Read data.
+    ret_code_t (*write)(nrf_fstorage_t const *p_fs,
+                        uint32_t              dest,
+                        void const           *p_src,
+                        uint32_t              len,
+                        void                 *p_param); ///< Write bytes.
+    ret_code_t (*erase)(nrf_fstorage_t const *p_fs, uint32_t page_addr, uint32_t len, void *p_param); ///< Erase pages.
+    bool (*is_busy)(nrf_fstorage_t const *p_fs); ///< Check if there are any pending operations.
+};
+
+/**
+ * @brief       Initialize an fstorage instance.
+ *
+ * @param[in]   p_fs        The fstorage instance to initialize.
+ * @param[in]   p_api       The API implementation to use.
+ * @param[in]   p_param     An optional parameter to pass to the implementation-specific API call.
+ *
+ * @retval      NRF_SUCCESS         If initialization was successful.
+ * @retval      NRF_ERROR_NULL      If p_fs or p_api field in p_fs is NULL.
+ */
+ret_code_t nrf_fstorage_init(nrf_fstorage_t *p_fs, nrf_fstorage_api_t *p_api, void *p_param);
+
+/**
+ * @brief       Read data from flash.
+ *
+ * @param[in]   p_fs        The fstorage instance.
+ * @param[in]   src         Address in flash where to read from.
+ * @param[in]   p_dest      Buffer where the data should be copied.
+ * @param[in]   len         Length of the data to be copied (in bytes).
+ *
+ * @retval      NRF_SUCCESS             If the operation was successful.
+ * @retval      NRF_ERROR_NULL          If p_fs or p_dest is NULL.
+ * @retval      NRF_ERROR_INVALID_STATE If the module is not initialized.
+ * @retval      NRF_ERROR_INVALID_LENGTH If len is zero.
+ * @retval      NRF_ERROR_INVALID_ADDR  If the address range is outside the flash space of the instance.
+ */
+ret_code_t nrf_fstorage_read(nrf_fstorage_t const *p_fs, uint32_t src, void *p_dest, uint32_t len);
+
+/**
+ * @brief       Write bytes to flash, the result is reported to the event handler.
+ *
+ * @param[in]   p_fs        The fstorage instance.
+ * @param[in]   dest        Address in flash memory where to write the data, word aligned.
+ * @param[in]   p_src       Data to be written, has to stay valid until the operation completes.
+ * @param[in]   len         Length of the data (in bytes), a multiple of the program unit.
+ * @param[in]   p_param     User-defined parameter passed to the event handler.
+ *
+ * @retval      NRF_SUCCESS             If the operation was accepted.
+ * @retval      NRF_ERROR_NULL          If p_fs or p_src is NULL.
+ * @retval      NRF_ERROR_INVALID_STATE If the module is not initialized.
+ * @retval      NRF_ERROR_INVALID_LENGTH If len is zero or not a multiple of the program unit.
+ * @retval      NRF_ERROR_INVALID_ADDR  If the address is outside the flash space of the instance or unaligned.
+ * @retval      NRF_ERROR_NO_MEM        If no memory is available to accept the operation.
+ */
+ret_code_t nrf_fstorage_write(nrf_fstorage_t const *p_fs,
+                              uint32_t              dest,
+                              void const           *p_src,
+                              uint32_t              len,
+                              void                 *p_param);
+
+/**
+ * @brief       Erase flash pages, the result is reported to the event handler.
+ *
+ * @param[in]   p_fs        The fstorage instance.
+ * @param[in]   page_addr   Address of the page to erase.
+ * @param[in]   len         Number of pages to erase.
+ * @param[in]   p_param     User-defined parameter passed to the event handler.
+ *
+ * @retval      NRF_SUCCESS             If the operation was accepted.
+ * @retval      NRF_ERROR_NULL          If p_fs is NULL.
+ * @retval      NRF_ERROR_INVALID_STATE If the module is not initialized.
+ * @retval      NRF_ERROR_INVALID_LENGTH If len is zero.
+ * @retval      NRF_ERROR_INVALID_ADDR  If the address is outside the flash space of the instance or unaligned.
+ * @retval      NRF_ERROR_NO_MEM        If no memory is available to accept the operation.
+ */
+ret_code_t nrf_fstorage_erase(nrf_fstorage_t const *p_fs, uint32_t page_addr, uint32_t len, void *p_param);
+
+/**
+ * @brief       Check if there are any pending flash operations.
+ *
+ * @param[in]   p_fs    The fstorage instance.
+ *
+ * @retval      true    If a flash operation is ongoing or queued.
+ * @retval      false   If there are no pending flash operations.
+ */
+bool nrf_fstorage_is_busy(nrf_fstorage_t const *p_fs);
+
+#endif // NRF_FSTORAGE_H__
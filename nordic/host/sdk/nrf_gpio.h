@@ -0,0 +1,173 @@
+/**
+ * @file        nrf_gpio.h
+ * @author      Danius Kalvaitis (danius.kalvaitis@gmail.com)
+ * @brief       Host stub of the nRF5 GPIO HAL, pins are simulated with open-drain lines pulled up.
+ * @version     0.1
+ * @date        2026-10-17
+ *
+ * @copyright   Copyright (c) Danius Kalvaitis 2026 All rights reserved
+ *
+ */
+
+#ifndef NRF_GPIO_H__
+#define NRF_GPIO_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define DK_HOST_GPIO_PIN_COUNT 64 ///< Amount of simulated pins, P0 and P1.
+
+/**
+ * @brief Pin direction.
+ */
+typedef enum
+{
+    NRF_GPIO_PIN_DIR_INPUT,  ///< Input.
+    NRF_GPIO_PIN_DIR_OUTPUT, ///< Output.
+} nrf_gpio_pin_dir_t;
+
+/**
+ * @brief Connection of the input buffer.
+ */
+typedef enum
+{
+    NRF_GPIO_PIN_INPUT_CONNECT,    ///< Input buffer connected.
+    NRF_GPIO_PIN_INPUT_DISCONNECT, ///< Input buffer disconnected.
+} nrf_gpio_pin_input_t;
+
+/**
+ * @brief Pull resistor.
+ */
+typedef enum
+{
+    NRF_GPIO_PIN_NOPULL   = 0, ///< No pull.
+    NRF_GPIO_PIN_PULLDOWN = 1, ///< Pull down.
+    NRF_GPIO_PIN_PULLUP   = 3, ///< Pull up.
+} nrf_gpio_pin_pull_t;
+
+/**
+ * @brief Drive strength.
+ */
+typedef enum
+{
+    NRF_GPIO_PIN_S0S1, ///< Standard 0, standard 1.
+    NRF_GPIO_PIN_H0S1, ///< High drive 0, standard 1.
+    NRF_GPIO_PIN_S0H1, ///< Standard 0, high drive 1.
+    NRF_GPIO_PIN_H0H1, ///< High drive 0, high drive 1.
+    NRF_GPIO_PIN_D0S1, ///< Disconnect 0, standard 1.
+    NRF_GPIO_PIN_D0H1, ///< Disconnect 0, high drive 1.
+    NRF_GPIO_PIN_S0D1, ///< Standard 0, disconnect 1.
+    NRF_GPIO_PIN_H0D1, ///< High drive 0, disconnect 1.
+} nrf_gpio_pin_drive_t;
+
+/**
+ * @brief Pin sensing.
+ */
+typedef enum
+{
+    NRF_GPIO_PIN_NOSENSE    = 0, ///< No sensing.
+    NRF_GPIO_PIN_SENSE_LOW  = 3, ///< Sense low level.
+    NRF_GPIO_PIN_SENSE_HIGH = 2, ///< Sense high level.
+} nrf_gpio_pin_sense_t;
+
+/**
+ * @brief Function called when the MCU changes the output level of a pin.
+ */
+typedef void (*dk_host_gpio_handler_t)(uint32_t pin_number, uint32_t level);
+
+/**
+ * @brief       Configure a pin.
+ *
+ * @param[in]   pin_number  Pin number.
+ * @param[in]   dir         Pin direction.
+ * @param[in]   input       Connection of the input buffer.
+ * @param[in]   pull        Pull resistor.
+ * @param[in]   drive       Drive strength.
+ * @param[in]   sense       Pin sensing.
+ */
+void nrf_gpio_cfg(uint32_t             pin_number,
+                  nrf_gpio_pin_dir_t   dir,
+                  nrf_gpio_pin_input_t input,
+                  nrf_gpio_pin_pull_t  pull,
+                  nrf_gpio_pin_drive_t drive,
+                  nrf_gpio_pin_sense_t sense);
+
+/**
+ * @brief       Configure a pin as a standard output.
+ *
+ * @param[in]   pin_number  Pin number.
+ */
+void nrf_gpio_cfg_output(uint32_t pin_number);
+
+/**
+ * @brief       Configure a pin as an input.
+ *
+ * @param[in]   pin_number  Pin number.
+ * @param[in]   pull_config Pull resistor.
+ */
+void nrf_gpio_cfg_input(uint32_t pin_number, nrf_gpio_pin_pull_t pull_config);
+
+/**
+ * @brief       Set the output latch of a pin.
+ *
+ * @param[in]   pin_number  Pin number.
+ * @param[in]   value       Zero clears the latch, any other value sets it.
+ */
+void nrf_gpio_pin_write(uint32_t pin_number, uint32_t value);
+
+/**
+ * @brief       Set the output latch of a pin high.
+ *
+ * @param[in]   pin_number  Pin number.
+ */
+void nrf_gpio_pin_set(uint32_t pin_number);
+
+/**
+ * @brief       Set the output latch of a pin low.
+ *
+ * @param[in]   pin_number  Pin number.
+ */
+void nrf_gpio_pin_clear(uint32_t pin_number);
+
+/**
+ * @brief       Read the level of a pin.
+ *
+ * @details     A line is low while the MCU drives it low or a simulated device holds it low, otherwise the pull up
+ *              keeps it high.
+ *
+ * @param[in]   pin_number  Pin number.
+ *
+ * @return      Level of the pin.
+ */
+uint32_t nrf_gpio_pin_read(uint32_t pin_number);
+
+/**
+ * @brief       Get the output latch of a pin.
+ *
+ * @param[in]   pin_number  Pin number.
+ *
+ * @return      Output latch of the pin.
+ */
+uint32_t nrf_gpio_pin_out_read(uint32_t pin_number);
+
+/**
+ * @brief       Reset all pins to inputs with a low latch, release them and remove the handler.
+ */
+void dk_host_gpio_reset(void);
+
+/**
+ * @brief       Let a simulated device hold a line low or release it.
+ *
+ * @param[in]   pin_number  Pin number.
+ * @param[in]   hold        True to hold the line low.
+ */
+void dk_host_gpio_hold_low(uint32_t pin_number, bool hold);
+
+/**
+ * @brief       Set the function called when the MCU changes the output level of a pin.
+ *
+ * @param[in]   handler     Function to call, NULL removes it.
+ */
+void dk_host_gpio_handler_set(dk_host_gpio_handler_t handler);
+
+#endif // NRF_GPIO_H__
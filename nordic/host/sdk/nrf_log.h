@@ -0,0 +1,40 @@
+/**
+ * @file        nrf_log.h
+ * @author      Danius Kalvaitis (danius.kalvaitis@gmail.com)
+ * @brief       Host stub of the nRF5 SDK logger, messages are discarded but their arguments evaluated.
+ * @version     0.1
+ * @date        2026-10-17
+ *
+ * @copyright   Copyright (c) Danius Kalvaitis 2026 All rights reserved
+ *
+ */
+
+#ifndef NRF_LOG_H_
+#define NRF_LOG_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "sdk_common.h"
+
+/**
+ * @brief       Discard a log message.
+ *
+ * @param[in]   p_fmt   Format string of the message.
+ */
+static inline void nrf_log_host_discard(char const *p_fmt, ...)
+{
+    (void)p_fmt;
+}
+
+#define NRF_LOG_MODULE_REGISTER() extern int nrf_log_host_module_unused ///< Register the module of the source file.
+
+#define NRF_LOG_ERROR(...)   nrf_log_host_discard(__VA_ARGS__) ///< Log an error.
+#define NRF_LOG_WARNING(...) nrf_log_host_discard(__VA_ARGS__) ///< Log a warning.
+#define NRF_LOG_INFO(...)    nrf_log_host_discard(__VA_ARGS__) ///< Log information.
+#define NRF_LOG_DEBUG(...)   nrf_log_host_discard(__VA_ARGS__) ///< Log debug information.
+
+#define NRF_LOG_FLOAT_MARKER "%s%d.%02d"                             ///< Format of @ref NRF_LOG_FLOAT.
+#define NRF_LOG_FLOAT(val)   "", (int32_t)(val), (int32_t)((val) * 100) ///< Float arguments of a log message.
+
+#endif // NRF_LOG_H_
@@ -0,0 +1,19 @@
+/**
+ * @file        nrf_log_ctrl.h
+ * @author      Danius Kalvaitis (danius.kalvaitis@gmail.com)
+ * @brief       Host stub of the nRF5 SDK logger control.
+ * @version     0.1
+ * @date        2026-10-17
+ *
+ * @copyright   Copyright (c) Danius Kalvaitis 2026 All rights reserved
+ *
+ */
+
+#ifndef NRF_LOG_CTRL_H
+#define NRF_LOG_CTRL_H
+
+#include "nrf_log.h"
+
+#define NRF_LOG_PROCESS() false ///< Process deferred log messages, there are none on the host.
+
+#endif // NRF_LOG_CTRL_H
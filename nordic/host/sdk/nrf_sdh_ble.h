@@ -0,0 +1,51 @@
+/**
+ * @file        nrf_sdh_ble.h
+ * @author      Danius Kalvaitis (danius.kalvaitis@gmail.com)
+ * @brief       Host stub of the SoftDevice handler BLE observers, events are sent by dk_host_ble.
+ * @version     0.1
+ * @date        2026-10-17
+ *
+ * @copyright   Copyright (c) Danius Kalvaitis 2026 All rights reserved
+ *
+ */
+
+#ifndef NRF_SDH_BLE_H__
+#define NRF_SDH_BLE_H__
+
+#include "app_util.h"
+#include "ble.h"
+
+/**
+ * @brief BLE stack event handler.
+ */
+typedef void (*nrf_sdh_ble_evt_handler_t)(ble_evt_t const *p_ble_evt, void *p_context);
+
+/**
+ * @brief BLE event observer.
+ */
+typedef struct nrf_sdh_ble_evt_observer_s
+{
+    nrf_sdh_ble_evt_handler_t          handler;   ///< BLE event handler.
+    void                              *p_context; ///< A parameter to the event handler.
+    struct nrf_sdh_ble_evt_observer_s *p_next;    ///< Next registered observer.
+} nrf_sdh_ble_evt_observer_t;
+
+/**
+ * @brief       Register an observer, called by @ref NRF_SDH_BLE_OBSERVER before main.
+ *
+ * @param[in]   p_observer  Pointer to the observer.
+ */
+void nrf_sdh_ble_observer_register(nrf_sdh_ble_evt_observer_t *p_observer);
+
+/**
+ * @brief Register a BLE event observer, the priority is ignored and observers are called in registration order.
+ */
+#define NRF_SDH_BLE_OBSERVER(_name, _prio, _handler, _context)                                                         \
+    static nrf_sdh_ble_evt_observer_t _name;                                                                           \
+    __attribute__((constructor)) static void CONCAT_2(_name, _register)(void)                                          \
+    {                                                                                                                  \
+        nrf_sdh_ble_observer_register(&_name);                                                                         \
+    }                                                                                                                  \
+    static nrf_sdh_ble_evt_observer_t _name = {.handler = (_handler), .p_context = (_context)}
+
+#endif // NRF_SDH_BLE_H__
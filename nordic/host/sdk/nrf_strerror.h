@@ -0,0 +1,26 @@
+/**
+ * @file        nrf_strerror.h
+ * @author      Danius Kalvaitis (danius.kalvaitis@gmail.com)
+ * @brief       Host stub of the nRF5 SDK error code strings.
+ * @version     0.1
+ * @date        2026-10-17
+ *
+ * @copyright   Copyright (c) Danius Kalvaitis 2026 All rights reserved
+ *
+ */
+
+#ifndef NRF_STRERROR_H__
+#define NRF_STRERROR_H__
+
+#include "sdk_errors.h"
+
+/**
+ * @brief       Get the name of an error code.
+ *
+ * @param[in]   code    Error code.
+ *
+ * @return      Name of the error code, "Unknown error code" for codes without a name.
+ */
+char const *nrf_strerror_get(ret_code_t code);
+
+#endif // NRF_STRERROR_H__
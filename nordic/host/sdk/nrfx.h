@@ -0,0 +1,45 @@
+/**
+ * @file        nrfx.h
+ * @author      Danius Kalvaitis (danius.kalvaitis@gmail.com)
+ * @brief       Host stub of the nrfx glue.
+ * @version     0.1
+ * @date        2026-10-17
+ *
+ * @copyright   Copyright (c) Danius Kalvaitis 2026 All rights reserved
+ *
+ */
+
+#ifndef NRFX_H__
+#define NRFX_H__
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "app_util_platform.h"
+#include "nordic_common.h"
+#include "nrf.h"
+#include "nrf_assert.h"
+#include "nrfx_errors.h"
+
+#define NRFX_CONCAT_2 CONCAT_2 ///< Concatenate two expanded tokens.
+#define NRFX_CONCAT_3 CONCAT_3 ///< Concatenate three expanded tokens.
+
+/**
+ * @brief Clear a pending interrupt, completions of a disabled simulated peripheral are dropped by its driver.
+ */
+#define NRFX_IRQ_PENDING_CLEAR(irq_number) ((void)(irq_number))
+
+/**
+ * @brief       Get the interrupt number of a peripheral.
+ *
+ * @param[in]   p_reg   Pointer to the peripheral registers.
+ *
+ * @return      Index of the register block, serves as the interrupt number on the host.
+ */
+static inline IRQn_Type nrfx_get_irq_number(void const *p_reg)
+{
+    return (IRQn_Type)((NRF_SERIAL_Type const *)p_reg - dk_host_serial_regs);
+}
+
+#endif // NRFX_H__
@@ -0,0 +1,40 @@
+/**
+ * @file        nrfx_errors.h
+ * @author      Danius Kalvaitis (danius.kalvaitis@gmail.com)
+ * @brief       Host stub of the nrfx error codes, mapped to the SDK error codes like the SDK integration does.
+ * @version     0.1
+ * @date        2026-10-17
+ *
+ * @copyright   Copyright (c) Danius Kalvaitis 2026 All rights reserved
+ *
+ */
+
+#ifndef NRFX_ERRORS_H__
+#define NRFX_ERRORS_H__
+
+#include "sdk_errors.h"
+
+/**
+ * @brief Error codes of the nrfx drivers.
+ */
+typedef enum
+{
+    NRFX_SUCCESS                    = NRF_SUCCESS,                          ///< Operation performed successfully.
+    NRFX_ERROR_INTERNAL             = NRF_ERROR_INTERNAL,                   ///< Internal error.
+    NRFX_ERROR_NO_MEM               = NRF_ERROR_NO_MEM,                     ///< No memory for operation.
+    NRFX_ERROR_NOT_SUPPORTED        = NRF_ERROR_NOT_SUPPORTED,              ///< Not supported.
+    NRFX_ERROR_INVALID_PARAM        = NRF_ERROR_INVALID_PARAM,              ///< Invalid parameter.
+    NRFX_ERROR_INVALID_STATE        = NRF_ERROR_INVALID_STATE,              ///< Invalid state, operation disallowed.
+    NRFX_ERROR_INVALID_LENGTH       = NRF_ERROR_INVALID_LENGTH,             ///< Invalid length.
+    NRFX_ERROR_TIMEOUT              = NRF_ERROR_TIMEOUT,                    ///< Operation timed out.
+    NRFX_ERROR_FORBIDDEN            = NRF_ERROR_FORBIDDEN,                  ///< Operation is forbidden.
+    NRFX_ERROR_NULL                 = NRF_ERROR_NULL,                       ///< Null pointer.
+    NRFX_ERROR_INVALID_ADDR         = NRF_ERROR_INVALID_ADDR,               ///< Bad memory address.
+    NRFX_ERROR_BUSY                 = NRF_ERROR_BUSY,                       ///< Busy.
+    NRFX_ERROR_ALREADY_INITIALIZED  = NRF_ERROR_MODULE_ALREADY_INITIALIZED, ///< Module already initialized.
+    NRFX_ERROR_DRV_TWI_ERR_OVERRUN  = NRF_ERROR_DRV_TWI_ERR_OVERRUN,        ///< TWI error: Overrun.
+    NRFX_ERROR_DRV_TWI_ERR_ANACK    = NRF_ERROR_DRV_TWI_ERR_ANACK,          ///< TWI error: Address not acknowledged.
+    NRFX_ERROR_DRV_TWI_ERR_DNACK    = NRF_ERROR_DRV_TWI_ERR_DNACK,          ///< TWI error: Data not acknowledged.
+} nrfx_err_t;
+
+#endif // NRFX_ERRORS_H__
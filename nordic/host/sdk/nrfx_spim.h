@@ -0,0 +1,179 @@
+/**
+ * @file        nrfx_spim.h
+ * @author      Danius Kalvaitis (danius.kalvaitis@gmail.com)
+ * @brief       Host stub of the nrfx SPIM driver, transfers run on the simulated bus of dk_host_spi.
+ * @version     0.1
+ * @date        2026-10-17
+ *
+ * @copyright   Copyright (c) Danius Kalvaitis 2026 All rights reserved
+ *
+ */
+
+#ifndef NRFX_SPIM_H__
+#define NRFX_SPIM_H__
+
+#include "nrfx.h"
+
+/**
+ * @brief SPIM master data rates, values of the FREQUENCY register.
+ */
+typedef enum
+{
+    NRF_SPIM_FREQ_125K = 0x02000000, ///< 125 kbps.
+    NRF_SPIM_FREQ_250K = 0x04000000, ///< 250 kbps.
+    NRF_SPIM_FREQ_500K = 0x08000000, ///< 500 kbps.
+    NRF_SPIM_FREQ_1M   = 0x10000000, ///< 1 Mbps.
+    NRF_SPIM_FREQ_2M   = 0x20000000, ///< 2 Mbps.
+    NRF_SPIM_FREQ_4M   = 0x40000000, ///< 4 Mbps.
+    NRF_SPIM_FREQ_8M   = 0x80000000, ///< 8 Mbps.
+} nrf_spim_frequency_t;
+
+/**
+ * @brief SPIM modes.
+ */
+typedef enum
+{
+    NRF_SPIM_MODE_0, ///< SCK active high, sample on leading edge of clock.
+    NRF_SPIM_MODE_1, ///< SCK active high, sample on trailing edge of clock.
+    NRF_SPIM_MODE_2, ///< SCK active low, sample on leading edge of clock.
+    NRF_SPIM_MODE_3, ///< SCK active low, sample on trailing edge of clock.
+} nrf_spim_mode_t;
+
+/**
+ * @brief SPIM bit orders.
+ */
+typedef enum
+{
+    NRF_SPIM_BIT_ORDER_MSB_FIRST, ///< Most significant bit shifted out first.
+    NRF_SPIM_BIT_ORDER_LSB_FIRST, ///< Least significant bit shifted out first.
+} nrf_spim_bit_order_t;
+
+#define NRFX_SPIM0_INST_IDX 0 ///< Driver instance index of SPIM0.
+#define NRFX_SPIM1_INST_IDX 1 ///< Driver instance index of SPIM1.
+#define NRFX_SPIM2_INST_IDX 2 ///< Driver instance index of SPIM2.
+
+#define NRFX_SPIM_PIN_NOT_USED 0xFF ///< Value of a pin that is not used.
+
+/**
+ * @brief SPIM master driver instance.
+ */
+typedef struct
+{
+    NRF_SPIM_Type *p_reg;        ///< Pointer to a structure with SPIM registers.
+    uint8_t        drv_inst_idx; ///< Driver instance index.
+} nrfx_spim_t;
+
+/**
+ * @brief Create a SPIM master driver instance.
+ */
+#define NRFX_SPIM_INSTANCE(id)                                                                                         \
+    {                                                                                                                  \
+        .p_reg = NRFX_CONCAT_2(NRF_SPIM, id), .drv_inst_idx = NRFX_CONCAT_3(NRFX_SPIM, id, _INST_IDX),                 \
+    }
+
+/**
+ * @brief SPIM master driver instance configuration.
+ */
+typedef struct
+{
+    uint8_t              sck_pin;      ///< SCK pin number.
+    uint8_t              mosi_pin;     ///< MOSI pin number (optional).
+    uint8_t              miso_pin;     ///< MISO pin number (optional).
+    uint8_t              ss_pin;       ///< Slave Select pin number (optional).
+    uint8_t              irq_priority; ///< Interrupt priority.
+    uint8_t              orc;          ///< Over-run character.
+    nrf_spim_frequency_t frequency;    ///< SPIM frequency.
+    nrf_spim_mode_t      mode;         ///< SPIM mode.
+    nrf_spim_bit_order_t bit_order;    ///< SPIM bit order.
+} nrfx_spim_config_t;
+
+/**
+ * @brief Single transfer descriptor structure.
+ */
+typedef struct
+{
+    uint8_t const *p_tx_buffer; ///< Pointer to TX buffer.
+    size_t         tx_length;   ///< TX buffer length.
+    uint8_t       *p_rx_buffer; ///< Pointer to RX buffer.
+    size_t         rx_length;   ///< RX buffer length.
+} nrfx_spim_xfer_desc_t;
+
+/**
+ * @brief Macro for setting up a single transfer descriptor.
+ */
+#define NRFX_SPIM_XFER_TRX(p_tx_buf, tx_len, p_rx_buf, rx_len)                                                         \
+    {                                                                                                                  \
+        .p_tx_buffer = (uint8_t const *)(p_tx_buf), .tx_length = (tx_len), .p_rx_buffer = (p_rx_buf),                  \
+        .rx_length = (rx_len),                                                                                         \
+    }
+
+/**
+ * @brief Macro for setting up a TX transfer descriptor.
+ */
+#define NRFX_SPIM_XFER_TX(p_buf, length) NRFX_SPIM_XFER_TRX(p_buf, length, NULL, 0)
+
+/**
+ * @brief Macro for setting up an RX transfer descriptor.
+ */
+#define NRFX_SPIM_XFER_RX(p_buf, length) NRFX_SPIM_XFER_TRX(NULL, 0, p_buf, length)
+
+/**
+ * @brief SPIM master driver event types.
+ */
+typedef enum
+{
+    NRFX_SPIM_EVENT_DONE, ///< Transfer done.
+} nrfx_spim_evt_type_t;
+
+/**
+ * @brief SPIM master driver event.
+ */
+typedef struct
+{
+    nrfx_spim_evt_type_t  type;      ///< Event type.
+    nrfx_spim_xfer_desc_t xfer_desc; ///< Transfer details.
+} nrfx_spim_evt_t;
+
+/**
+ * @brief SPIM master driver event handler type.
+ */
+typedef void (*nrfx_spim_evt_handler_t)(nrfx_spim_evt_t const *p_event, void *p_context);
+
+/**
+ * @brief       Initialize the SPIM master driver instance.
+ *
+ * @param[in]   p_instance  Pointer to the driver instance structure.
+ * @param[in]   p_config    Pointer to the structure with the initial configuration.
+ * @param[in]   handler     Event handler provided by the user. If NULL, transfers will be performed in blocking mode.
+ * @param[in]   p_context   Context passed to event handler.
+ *
+ * @retval      NRFX_SUCCESS                If initialization was successful.
+ * @retval      NRFX_ERROR_INVALID_STATE    If the driver was already initialized.
+ */
+nrfx_err_t nrfx_spim_init(nrfx_spim_t const        *p_instance,
+                          nrfx_spim_config_t const *p_config,
+                          nrfx_spim_evt_handler_t   handler,
+                          void                     *p_context);
+
+/**
+ * @brief       Uninitialize the SPIM master driver instance, a transfer in progress is dropped without an event.
+ *
+ * @param[in]   p_instance  Pointer to the driver instance structure.
+ */
+void nrfx_spim_uninit(nrfx_spim_t const *p_instance);
+
+/**
+ * @brief       Start the SPIM data transfer.
+ *
+ * @param[in]   p_instance  Pointer to the driver instance structure.
+ * @param[in]   p_xfer_desc Pointer to the transfer descriptor.
+ * @param[in]   flags       Transfer options (0 for default settings).
+ *
+ * @retval      NRFX_SUCCESS                If the procedure was successful.
+ * @retval      NRFX_ERROR_BUSY             If the driver is not ready for a new transfer.
+ * @retval      NRFX_ERROR_INVALID_STATE    If the instance is not initialized.
+ * @retval      NRFX_ERROR_NOT_SUPPORTED    If the provided parameters are not supported.
+ */
+nrfx_err_t nrfx_spim_xfer(nrfx_spim_t const *p_instance, nrfx_spim_xfer_desc_t const *p_xfer_desc, uint32_t flags);
+
+#endif // NRFX_SPIM_H__
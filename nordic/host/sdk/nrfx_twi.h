@@ -0,0 +1,245 @@
+/**
+ * @file        nrfx_twi.h
+ * @author      Danius Kalvaitis (danius.kalvaitis@gmail.com)
+ * @brief       Host stub of the nrfx TWI driver, transfers run on the simulated bus of dk_host_twi.
+ * @version     0.1
+ * @date        2026-10-17
+ *
+ * @copyright   Copyright (c) Danius Kalvaitis 2026 All rights reserved
+ *
+ */
+
+#ifndef NRFX_TWI_H__
+#define NRFX_TWI_H__
+
+#include "nrfx.h"
+
+/**
+ * @brief TWI frequencies, values of the FREQUENCY register.
+ */
+typedef enum
+{
+    NRF_TWI_FREQ_100K = 0x01980000, ///< 100 kbps.
+    NRF_TWI_FREQ_250K = 0x04000000, ///< 250 kbps.
+    NRF_TWI_FREQ_400K = 0x06680000, ///< 400 kbps.
+} nrf_twi_frequency_t;
+
+#ifndef NRFX_TWI_DEFAULT_CONFIG_FREQUENCY
+#define NRFX_TWI_DEFAULT_CONFIG_FREQUENCY NRF_TWI_FREQ_100K ///< Default frequency.
+#endif
+
+#ifndef NRFX_TWI_DEFAULT_CONFIG_IRQ_PRIORITY
+#define NRFX_TWI_DEFAULT_CONFIG_IRQ_PRIORITY 6 ///< Default interrupt priority.
+#endif
+
+#define NRFX_TWI0_INST_IDX 0 ///< Driver instance index of TWI0.
+#define NRFX_TWI1_INST_IDX 1 ///< Driver instance index of TWI1.
+
+/**
+ * @brief TWI master driver instance.
+ */
+typedef struct
+{
+    NRF_TWI_Type *p_twi;        ///< Pointer to a structure with TWI registers.
+    uint8_t       drv_inst_idx; ///< Driver instance index.
+} nrfx_twi_t;
+
+/**
+ * @brief Create a TWI master driver instance.
+ */
+#define NRFX_TWI_INSTANCE(id)                                                                                          \
+    {                                                                                                                  \
+        .p_twi = NRFX_CONCAT_2(NRF_TWI, id), .drv_inst_idx = NRFX_CONCAT_3(NRFX_TWI, id, _INST_IDX),                   \
+    }
+
+/**
+ * @brief TWI master driver instance configuration.
+ */
+typedef struct
+{
+    uint32_t            scl;                ///< SCL pin number.
+    uint32_t            sda;                ///< SDA pin number.
+    nrf_twi_frequency_t frequency;          ///< TWI frequency.
+    uint8_t             interrupt_priority; ///< Interrupt priority.
+    bool                hold_bus_uninit;    ///< Hold pull up state on GPIO pins after uninit.
+} nrfx_twi_config_t;
+
+#define NRFX_TWI_FLAG_TX_NO_STOP (1UL << 5) ///< Send the data without a STOP condition.
+
+/**
+ * @brief TWI master driver event types.
+ */
+typedef enum
+{
+    NRFX_TWI_EVT_DONE,         ///< Transfer completed event.
+    NRFX_TWI_EVT_ADDRESS_NACK, ///< Error event: NACK received after sending the address.
+    NRFX_TWI_EVT_DATA_NACK,    ///< Error event: NACK received after sending a data byte.
+} nrfx_twi_evt_type_t;
+
+/**
+ * @brief TWI master driver transfer types.
+ */
+typedef enum
+{
+    NRFX_TWI_XFER_TX,   ///< TX transfer.
+    NRFX_TWI_XFER_RX,   ///< RX transfer.
+    NRFX_TWI_XFER_TXRX, ///< TX transfer followed by RX transfer with repeated start.
+    NRFX_TWI_XFER_TXTX, ///< TX transfer followed by TX transfer with repeated start.
+} nrfx_twi_xfer_type_t;
+
+/**
+ * @brief Structure for a TWI transfer descriptor.
+ */
+typedef struct
+{
+    nrfx_twi_xfer_type_t type;             ///< Type of transfer.
+    uint8_t              address;          ///< Slave address.
+    size_t               primary_length;   ///< Number of bytes transferred.
+    size_t               secondary_length; ///< Number of bytes transferred.
+    uint8_t             *p_primary_buf;    ///< Pointer to transferred data.
+    uint8_t             *p_secondary_buf;  ///< Pointer to transferred data.
+} nrfx_twi_xfer_desc_t;
+
+/**
+ * @brief Macro for setting the TX transfer descriptor.
+ */
+#define NRFX_TWI_XFER_DESC_TX(addr, p_data, length)                                                                    \
+    {                                                                                                                  \
+        .type = NRFX_TWI_XFER_TX, .address = (addr), .primary_length = (length), .secondary_length = 0,                \
+        .p_primary_buf = (p_data), .p_secondary_buf = NULL                                                             \
+    }
+
+/**
+ * @brief Macro for setting the RX transfer descriptor.
+ */
+#define NRFX_TWI_XFER_DESC_RX(addr, p_data, length)                                                                    \
+    {                                                                                                                  \
+        .type = NRFX_TWI_XFER_RX, .address = (addr), .primary_length = (length), .secondary_length = 0,                \
+        .p_primary_buf = (p_data), .p_secondary_buf = NULL                                                             \
+    }
+
+/**
+ * @brief Macro for setting the TX-RX transfer descriptor.
+ */
+#define NRFX_TWI_XFER_DESC_TXRX(addr, p_tx, tx_len, p_rx, rx_len)                                                      \
+    {                                                                                                                  \
+        .type = NRFX_TWI_XFER_TXRX, .address = (addr), .primary_length = (tx_len), .secondary_length = (rx_len),       \
+        .p_primary_buf = (p_tx), .p_secondary_buf = (p_rx)                                                             \
+    }
+
+/**
+ * @brief Macro for setting the TX-TX transfer descriptor.
+ */
+#define NRFX_TWI_XFER_DESC_TXTX(addr, p_tx, tx_len, p_tx2, tx_len2)                                                    \
+    {                                                                                                                  \
+        .type = NRFX_TWI_XFER_TXTX, .address = (addr), .primary_length = (tx_len), .secondary_length = (tx_len2),      \
+        .p_primary_buf = (p_tx), .p_secondary_buf = (p_tx2)                                                            \
+    }
+
+/**
+ * @brief Structure for a TWI event.
+ */
+typedef struct
+{
+    nrfx_twi_evt_type_t  type;      ///< Event type.
+    nrfx_twi_xfer_desc_t xfer_desc; ///< Transfer details.
+} nrfx_twi_evt_t;
+
+/**
+ * @brief TWI event handler prototype.
+ */
+typedef void (*nrfx_twi_evt_handler_t)(nrfx_twi_evt_t const *p_event, void *p_context);
+
+/**
+ * @brief       Initialize the TWI driver instance.
+ *
+ * @param[in]   p_instance      Pointer to the driver instance structure.
+ * @param[in]   p_config        Pointer to the structure with the initial configuration.
+ * @param[in]   event_handler   Event handler provided by the user. If NULL, blocking mode is enabled.
+ * @param[in]   p_context       Context passed to event handler.
+ *
+ * @retval      NRFX_SUCCESS                    If initialization is successful.
+ * @retval      NRFX_ERROR_INVALID_STATE        If the driver is in invalid state.
+ * @retval      NRFX_ERROR_BUSY                 If the peripheral is in use by another driver.
+ */
+nrfx_err_t nrfx_twi_init(nrfx_twi_t const        *p_instance,
+                         nrfx_twi_config_t const *p_config,
+                         nrfx_twi_evt_handler_t   event_handler,
+                         void                    *p_context);
+
+/**
+ * @brief       Uninitialize the TWI instance, a transfer in progress is dropped without an event.
+ *
+ * @param[in]   p_instance  Pointer to the driver instance structure.
+ */
+void nrfx_twi_uninit(nrfx_twi_t const *p_instance);
+
+/**
+ * @brief       Enable the TWI instance.
+ *
+ * @param[in]   p_instance  Pointer to the driver instance structure.
+ */
+void nrfx_twi_enable(nrfx_twi_t const *p_instance);
+
+/**
+ * @brief       Disable the TWI instance, a transfer in progress is dropped without an event.
+ *
+ * @param[in]   p_instance  Pointer to the driver instance structure.
+ */
+void nrfx_twi_disable(nrfx_twi_t const *p_instance);
+
+/**
+ * @brief       Perform a TWI transfer.
+ *
+ * @param[in]   p_instance  Pointer to the driver instance structure.
+ * @param[in]   p_xfer_desc Pointer to the transfer descriptor.
+ * @param[in]   flags       Transfer options (0 for default settings).
+ *
+ * @retval      NRFX_SUCCESS                    If the procedure was successful.
+ * @retval      NRFX_ERROR_BUSY                 If the driver is not ready for a new transfer.
+ * @retval      NRFX_ERROR_INVALID_STATE        If the instance is not initialized or enabled.
+ * @retval      NRFX_ERROR_DRV_TWI_ERR_ANACK    If NACK received after sending the address in blocking mode.
+ * @retval      NRFX_ERROR_DRV_TWI_ERR_DNACK    If NACK received after sending a data byte in blocking mode.
+ */
+nrfx_err_t nrfx_twi_xfer(nrfx_twi_t const *p_instance, nrfx_twi_xfer_desc_t const *p_xfer_desc, uint32_t flags);
+
+/**
+ * @brief       Send data to a TWI slave.
+ *
+ * @param[in]   p_instance  Pointer to the driver instance structure.
+ * @param[in]   address     Address of a specific slave device (only 7 LSB).
+ * @param[in]   p_data      Pointer to a transmit buffer.
+ * @param[in]   length      Number of bytes to send.
+ * @param[in]   no_stop     If set, the stop condition is not generated on the bus after the transfer has completed.
+ *
+ * @return      See @ref nrfx_twi_xfer.
+ */
+nrfx_err_t nrfx_twi_tx(nrfx_twi_t const *p_instance,
+                       uint8_t           address,
+                       uint8_t const    *p_data,
+                       size_t            length,
+                       bool              no_stop);
+
+/**
+ * @brief       Read data from a TWI slave.
+ *
+ * @param[in]   p_instance  Pointer to the driver instance structure.
+ * @param[in]   address     Address of a specific slave device (only 7 LSB).
+ * @param[in]   p_data      Pointer to a receive buffer.
+ * @param[in]   length      Number of bytes to be received.
+ *
+ * @return      See @ref nrfx_twi_xfer.
+ */
+nrfx_err_t nrfx_twi_rx(nrfx_twi_t const *p_instance, uint8_t address, uint8_t *p_data, size_t length);
+
+/**
+ * @brief       Check if the TWI driver is busy.
+ *
+ * @param[in]   p_instance  Pointer to the driver instance structure.
+ *
+ * @retval      true        If the driver is busy.
+ * @retval      false       If the driver is ready for a new transfer.
+ */
+bool nrfx_twi_is_busy(nrfx_twi_t const *p_instance);
+
+#endif // NRFX_TWI_H__
@@ -0,0 +1,268 @@
+/**
+ * @file        nrfx_twim.h
+ * @author      Danius Kalvaitis (danius.kalvaitis@gmail.com)
+ * @brief       Host stub of the nrfx TWIM driver, transfers run on the simulated bus of dk_host_twi.
+ * @version     0.1
+ * @date        2026-10-17
+ *
+ * @copyright   Copyright (c) Danius Kalvaitis 2026 All rights reserved
+ *
+ */
+
+#ifndef NRFX_TWIM_H__
+#define NRFX_TWIM_H__
+
+#include "nrfx.h"
+
+/**
+ * @brief TWIM frequencies, values of the FREQUENCY register.
+ */
+typedef enum
+{
+    NRF_TWIM_FREQ_100K = 0x01980000, ///< 100 kbps.
+    NRF_TWIM_FREQ_250K = 0x04000000, ///< 250 kbps.
+    NRF_TWIM_FREQ_400K = 0x06400000, ///< 400 kbps.
+} nrf_twim_frequency_t;
+
+#ifndef NRFX_TWIM_DEFAULT_CONFIG_FREQUENCY
+#define NRFX_TWIM_DEFAULT_CONFIG_FREQUENCY NRF_TWIM_FREQ_100K ///< Default frequency.
+#endif
+
+#ifndef NRFX_TWIM_DEFAULT_CONFIG_IRQ_PRIORITY
+#define NRFX_TWIM_DEFAULT_CONFIG_IRQ_PRIORITY 6 ///< Default interrupt priority.
+#endif
+
+#define NRFX_TWIM0_INST_IDX 0 ///< Driver instance index of TWIM0.
+#define NRFX_TWIM1_INST_IDX 1 ///< Driver instance index of TWIM1.
+
+/**
+ * @brief TWIM master driver instance.
+ */
+typedef struct
+{
+    NRF_TWIM_Type *p_twim;       ///< Pointer to a structure with TWIM registers.
+    uint8_t        drv_inst_idx; ///< Driver instance index.
+} nrfx_twim_t;
+
+/**
+ * @brief Create a TWIM master driver instance.
+ */
+#define NRFX_TWIM_INSTANCE(id)                                                                                         \
+    {                                                                                                                  \
+        .p_twim = NRFX_CONCAT_2(NRF_TWIM, id), .drv_inst_idx = NRFX_CONCAT_3(NRFX_TWIM, id, _INST_IDX),                \
+    }
+
+/**
+ * @brief TWIM master driver instance configuration.
+ */
+typedef struct
+{
+    uint32_t             scl;                ///< SCL pin number.
+    uint32_t             sda;                ///< SDA pin number.
+    nrf_twim_frequency_t frequency;          ///< TWIM frequency.
+    uint8_t              interrupt_priority; ///< Interrupt priority.
+    bool                 hold_bus_uninit;    ///< Hold pull up state on GPIO pins after uninit.
+} nrfx_twim_config_t;
+
+#define NRFX_TWIM_FLAG_TX_POSTINC          (1UL << 0) ///< TX buffer address incremented after the transfer.
+#define NRFX_TWIM_FLAG_RX_POSTINC          (1UL << 1) ///< RX buffer address incremented after the transfer.
+#define NRFX_TWIM_FLAG_NO_XFER_EVT_HANDLER (1UL << 2) ///< Interrupt after each transfer is suppressed.
+#define NRFX_TWIM_FLAG_REPEATED_XFER       (1UL << 3) ///< Transfer is executed multiple times.
+#define NRFX_TWIM_FLAG_HOLD_XFER           (1UL << 4) ///< Set up the transfer but do not start it.
+#define NRFX_TWIM_FLAG_TX_NO_STOP          (1UL << 5) ///< Send the data without a STOP condition.
+
+/**
+ * @brief TWIM master driver event types.
+ */
+typedef enum
+{
+    NRFX_TWIM_EVT_DONE,         ///< Transfer completed event.
+    NRFX_TWIM_EVT_ADDRESS_NACK, ///< Error event: NACK received after sending the address.
+    NRFX_TWIM_EVT_DATA_NACK,    ///< Error event: NACK received after sending a data byte.
+} nrfx_twim_evt_type_t;
+
+/**
+ * @brief TWIM master driver transfer types.
+ */
+typedef enum
+{
+    NRFX_TWIM_XFER_TX,   ///< TX transfer.
+    NRFX_TWIM_XFER_RX,   ///< RX transfer.
+    NRFX_TWIM_XFER_TXRX, ///< TX transfer followed by RX transfer with repeated start.
+    NRFX_TWIM_XFER_TXTX, ///< TX transfer followed by TX transfer with repeated start.
+} nrfx_twim_xfer_type_t;
+
+/**
+ * @brief Structure for a TWIM transfer descriptor.
+ */
+typedef struct
+{
+    nrfx_twim_xfer_type_t type;             ///< Type of transfer.
+    uint8_t               address;          ///< Slave address.
+    size_t                primary_length;   ///< Number of bytes transferred.
+    size_t                secondary_length; ///< Number of bytes transferred.
+    uint8_t              *p_primary_buf;    ///< Pointer to transferred data.
+    uint8_t              *p_secondary_buf;  ///< Pointer to transferred data.
+} nrfx_twim_xfer_desc_t;
+
+/**
+ * @brief Macro for setting the TX transfer descriptor.
+ */
+#define NRFX_TWIM_XFER_DESC_TX(addr, p_data, length)                                                                   \
+    {                                                                                                                  \
+        .type = NRFX_TWIM_XFER_TX, .address = (addr), .primary_length = (length), .secondary_length = 0,               \
+        .p_primary_buf = (p_data), .p_secondary_buf = NULL                                                             \
+    }
+
+/**
+ * @brief Macro for setting the RX transfer descriptor.
+ */
+#define NRFX_TWIM_XFER_DESC_RX(addr, p_data, length)                                                                   \
+    {                                                                                                                  \
+        .type = NRFX_TWIM_XFER_RX, .address = (addr), .primary_length = (length), .secondary_length = 0,               \
+        .p_primary_buf = (p_data), .p_secondary_buf = NULL                                                             \
+    }
+
+/**
+ * @brief Macro for setting the TX-RX transfer descriptor.
+ */
+#define NRFX_TWIM_XFER_DESC_TXRX(addr, p_tx, tx_len, p_rx, rx_len)                                                     \
+    {                                                                                                                  \
+        .type = NRFX_TWIM_XFER_TXRX, .address = (addr), .primary_length = (tx_len), .secondary_length = (rx_len),      \
+        .p_primary_buf = (p_tx), .p_secondary_buf = (p_rx)                                                             \
+    }
+
+/**
+ * @brief Macro for setting the TX-TX transfer descriptor.
+ */
+#define NRFX_TWIM_XFER_DESC_TXTX(addr, p_tx, tx_len, p_tx2, tx_len2)                                                   \
+    {                                                                                                                  \
+        .type = NRFX_TWIM_XFER_TXTX, .address = (addr), .primary_length = (tx_len), .secondary_length = (tx_len2),     \
+        .p_primary_buf = (p_tx), .p_secondary_buf = (p_tx2)                                                            \
+    }
+
+/**
+ * @brief Structure for a TWIM event.
+ */
+typedef struct
+{
+    nrfx_twim_evt_type_t  type;      ///< Event type.
+    nrfx_twim_xfer_desc_t xfer_desc; ///< Transfer details.
+} nrfx_twim_evt_t;
+
+/**
+ * @brief TWIM event handler prototype.
+ */
+typedef void (*nrfx_twim_evt_handler_t)(nrfx_twim_evt_t const *p_event, void *p_context);
+
+/**
+ * @brief       Initialize the TWIM driver instance.
+ *
+ * @param[in]   p_instance      Pointer to the driver instance structure.
+ * @param[in]   p_config        Pointer to the structure with the initial configuration.
+ * @param[in]   event_handler   Event handler provided by the user. If NULL, blocking mode is enabled.
+ * @param[in]   p_context       Context passed to event handler.
+ *
+ * @retval      NRFX_SUCCESS                    If initialization is successful.
+ * @retval      NRFX_ERROR_INVALID_STATE        If the driver is in invalid state.
+ * @retval      NRFX_ERROR_BUSY                 If the peripheral is in use by another driver.
+ */
+nrfx_err_t nrfx_twim_init(nrfx_twim_t const        *p_instance,
+                          nrfx_twim_config_t const *p_config,
+                          nrfx_twim_evt_handler_t   event_handler,
+                          void                     *p_context);
+
+/**
+ * @brief       Uninitialize the TWIM instance, a transfer in progress is dropped without an event.
+ *
+ * @param[in]   p_instance  Pointer to the driver instance structure.
+ */
+void nrfx_twim_uninit(nrfx_twim_t const *p_instance);
+
+/**
+ * @brief       Enable the TWIM instance.
+ *
+ * @param[in]   p_instance  Pointer to the driver instance structure.
+ */
+void nrfx_twim_enable(nrfx_twim_t const *p_instance);
+
+/**
+ * @brief       Disable the TWIM instance, a transfer in progress is dropped without an event.
+ *
+ * @param[in]   p_instance  Pointer to the driver instance structure.
+ */
+void nrfx_twim_disable(nrfx_twim_t const *p_instance);
+
+/**
+ * @brief       Perform a TWIM transfer.
+ *
+ * @param[in]   p_instance  Pointer to the driver instance structure.
+ * @param[in]   p_xfer_desc Pointer to the transfer descriptor.
+ * @param[in]   flags       Transfer options (0 for default settings).
+ *
+ * @retval      NRFX_SUCCESS                    If the procedure was successful.
+ * @retval      NRFX_ERROR_BUSY                 If the driver is not ready for a new transfer.
+ * @retval      NRFX_ERROR_INVALID_STATE        If the instance is not initialized or enabled.
+ * @retval      NRFX_ERROR_DRV_TWI_ERR_ANACK    If NACK received after sending the address in blocking mode.
+ * @retval      NRFX_ERROR_DRV_TWI_ERR_DNACK    If NACK received after sending a data byte in blocking mode.
+ */
+nrfx_err_t nrfx_twim_xfer(nrfx_twim_t const *p_instance, nrfx_twim_xfer_desc_t const *p_xfer_desc, uint32_t flags);
+
+/**
+ * @brief       Send data to a TWIM slave.
+ *
+ * @param[in]   p_instance  Pointer to the driver instance structure.
+ * @param[in]   address     Address of a specific slave device (only 7 LSB).
+ * @param[in]   p_data      Pointer to a transmit buffer.
+ * @param[in]   length      Number of bytes to send.
+ * @param[in]   no_stop     If set, the stop condition is not generated on the bus after the transfer has completed.
+ *
+ * @return      See @ref nrfx_twim_xfer.
+ */
+nrfx_err_t nrfx_twim_tx(nrfx_twim_t const *p_instance,
+                        uint8_t            address,
+                        uint8_t const     *p_data,
+                        size_t             length,
+                        bool               no_stop);
+
+/**
+ * @brief       Read data from a TWIM slave.
+ *
+ * @param[in]   p_instance  Pointer to the driver instance structure.
+ * @param[in]   address     Address of a specific slave device (only 7 LSB).
+ * @param[in]   p_data      Pointer to a receive buffer.
+ * @param[in]   length      Number of bytes to be received.
+ *
+ * @return      See @ref nrfx_twim_xfer.
+ */
+nrfx_err_t nrfx_twim_rx(nrfx_twim_t const *p_instance, uint8_t address, uint8_t *p_data, size_t length);
+
+/**
+ * @brief       Check if the TWIM driver is busy.
+ *
+ * @param[in]   p_instance  Pointer to the driver instance structure.
+ *
+ * @retval      true        If the driver is busy.
+ * @retval      false       If the driver is ready for a new transfer.
+ */
+bool nrfx_twim_is_busy(nrfx_twim_t const *p_instance);
+
+/**
+ * @brief       Get the address of the start task of a transfer type, for a transfer set up with
+ *              @ref NRFX_TWIM_FLAG_HOLD_XFER.
+ *
+ * @param[in]   p_instance  Pointer to the driver instance structure.
+ * @param[in]   xfer_type   Transfer type.
+ *
+ * @return      Task address, trigger it with @ref dk_host_twim_task_trigger.
+ */
+uint32_t nrfx_twim_start_task_get(nrfx_twim_t const *p_instance, nrfx_twim_xfer_type_t xfer_type);
+
+/**
+ * @brief       Trigger a task of a TWIM instance, the host replacement of a PPI channel.
+ *
+ * @param[in]   task_address    Address returned by @ref nrfx_twim_start_task_get.
+ */
+void dk_host_twim_task_trigger(uint32_t task_address);
+
+#endif // NRFX_TWIM_H__
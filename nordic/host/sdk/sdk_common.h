@@ -0,0 +1,24 @@
+/**
+ * @file        sdk_common.h
+ * @author      Danius Kalvaitis (danius.kalvaitis@gmail.com)
+ * @brief       Host stub of the nRF5 SDK common header, included by the SDK headers that include it on the target.
+ * @version     0.1
+ * @date        2026-10-17
+ *
+ * @copyright   Copyright (c) Danius Kalvaitis 2026 All rights reserved
+ *
+ */
+
+#ifndef SDK_COMMON_H__
+#define SDK_COMMON_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "app_util.h"
+#include "nordic_common.h"
+#include "sdk_errors.h"
+#include "sdk_macros.h"
+
+#endif // SDK_COMMON_H__
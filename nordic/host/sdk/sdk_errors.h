@@ -0,0 +1,36 @@
+/**
+ * @file        sdk_errors.h
+ * @author      Danius Kalvaitis (danius.kalvaitis@gmail.com)
+ * @brief       Host stub of the nRF5 SDK error codes.
+ * @version     0.1
+ * @date        2026-10-17
+ *
+ * @copyright   Copyright (c) Danius Kalvaitis 2026 All rights reserved
+ *
+ */
+
+#ifndef SDK_ERRORS_H__
+#define SDK_ERRORS_H__
+
+#include <stdint.h>
+
+#include "nrf_error.h"
+
+#define NRF_ERROR_SDK_ERROR_BASE          (NRF_ERROR_BASE_NUM + 0x8000) ///< Base value for SDK errors.
+#define NRF_ERROR_SDK_COMMON_ERROR_BASE   (NRF_ERROR_BASE_NUM + 0x8000) ///< Base value for SDK common errors.
+#define NRF_ERROR_PERIPH_DRIVERS_ERR_BASE (NRF_ERROR_BASE_NUM + 0x8200) ///< Base value for peripheral driver errors.
+
+#define NRF_ERROR_MODULE_NOT_INITIALIZED     (NRF_ERROR_SDK_COMMON_ERROR_BASE + 0x0000) ///< Module not initialized.
+#define NRF_ERROR_MODULE_ALREADY_INITIALIZED (NRF_ERROR_SDK_COMMON_ERROR_BASE + 0x0005) ///< Module already initialized.
+#define NRF_ERROR_STORAGE_FULL               (NRF_ERROR_SDK_COMMON_ERROR_BASE + 0x0006) ///< Storage full.
+#define NRF_ERROR_API_NOT_IMPLEMENTED        (NRF_ERROR_SDK_COMMON_ERROR_BASE + 0x0010) ///< API not implemented.
+#define NRF_ERROR_FEATURE_NOT_ENABLED        (NRF_ERROR_SDK_COMMON_ERROR_BASE + 0x0011) ///< Feature not enabled.
+#define NRF_ERROR_IO_PENDING                 (NRF_ERROR_SDK_COMMON_ERROR_BASE + 0x0012) ///< Input/output pending.
+
+#define NRF_ERROR_DRV_TWI_ERR_OVERRUN (NRF_ERROR_PERIPH_DRIVERS_ERR_BASE + 0x0000) ///< TWI data overrun.
+#define NRF_ERROR_DRV_TWI_ERR_ANACK   (NRF_ERROR_PERIPH_DRIVERS_ERR_BASE + 0x0001) ///< TWI address NACK.
+#define NRF_ERROR_DRV_TWI_ERR_DNACK   (NRF_ERROR_PERIPH_DRIVERS_ERR_BASE + 0x0002) ///< TWI data NACK.
+
+typedef uint32_t ret_code_t; ///< Result of SDK functions.
+
+#endif // SDK_ERRORS_H__
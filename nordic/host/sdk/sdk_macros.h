@@ -0,0 +1,62 @@
+/**
+ * @file        sdk_macros.h
+ * @author      Danius Kalvaitis (danius.kalvaitis@gmail.com)
+ * @brief       Host stub of the nRF5 SDK verification macros.
+ * @version     0.1
+ * @date        2026-10-17
+ *
+ * @copyright   Copyright (c) Danius Kalvaitis 2026 All rights reserved
+ *
+ */
+
+#ifndef SDK_MACROS_H__
+#define SDK_MACROS_H__
+
+#include <stddef.h>
+
+#include "nrf_assert.h"
+#include "sdk_errors.h"
+
+/**
+ * @brief Return the error code if it is not NRF_SUCCESS.
+ */
+#define VERIFY_SUCCESS(statement)                                                                                      \
+    do                                                                                                                 \
+    {                                                                                                                  \
+        uint32_t _err_code = (uint32_t)(statement);                                                                    \
+        if (_err_code != NRF_SUCCESS)                                                                                  \
+        {                                                                                                              \
+            return _err_code;                                                                                          \
+        }                                                                                                              \
+    } while (0)
+
+/**
+ * @brief Return from a void function if the error code is not NRF_SUCCESS.
+ */
+#define VERIFY_SUCCESS_VOID(err_code)                                                                                  \
+    do                                                                                                                 \
+    {                                                                                                                  \
+        if ((err_code) != NRF_SUCCESS)                                                                                 \
+        {                                                                                                              \
+            return;                                                                                                    \
+        }                                                                                                              \
+    } while (0)
+
+/**
+ * @brief Return the error code if the condition is false.
+ */
+#define VERIFY_TRUE(statement, err_code)                                                                               \
+    do                                                                                                                 \
+    {                                                                                                                  \
+        if (!(statement))                                                                                              \
+        {                                                                                                              \
+            return err_code;                                                                                           \
+        }                                                                                                              \
+    } while (0)
+
+/**
+ * @brief Return NRF_ERROR_NULL if the pointer is NULL.
+ */
+#define VERIFY_PARAM_NOT_NULL(param) VERIFY_TRUE(((param) != NULL), NRF_ERROR_NULL)
+
+#endif // SDK_MACROS_H__
@@ -0,0 +1,98 @@
+/**
+ * @file        dk_host_app_scheduler.c
+ * @author      Danius Kalvaitis (danius.kalvaitis@gmail.com)
+ * @brief       Simulated app_scheduler of the host build.
+ * @version     0.1
+ * @date        2026-10-17
+ *
+ * @copyright   Copyright (c) Danius Kalvaitis 2026 All rights reserved
+ *
+ */
+
+#include "app_scheduler.h"
+
+#include <string.h>
+
+#include "app_util_platform.h"
+#include "nrf_error.h"
+
+/**
+ * @brief Queued scheduler event.
+ */
+typedef struct
+{
+    app_sched_event_handler_t handler;                             ///< Event handler.
+    uint16_t                  size;                                ///< Size of the event data.
+    uint8_t                   data[APP_SCHED_EVENT_DATA_MAX_SIZE]; ///< Copy of the event data.
+} sched_event_t;
+
+static sched_event_t m_queue[APP_SCHED_QUEUE_SIZE]; ///< Event queue.
+static uint16_t      m_head;                        ///< Index of the oldest event.
+static uint16_t      m_count;                       ///< Amount of queued events.
+
+void app_sched_init(void)
+{
+    m_head  = 0;
+    m_count = 0;
+}
+
+ret_code_t app_sched_event_put(void const *p_event_data, uint16_t event_size, app_sched_event_handler_t handler)
+{
+    if (event_size > APP_SCHED_EVENT_DATA_MAX_SIZE)
+    {
+        return NRF_ERROR_INVALID_LENGTH;
+    }
+
+    ret_code_t result = NRF_ERROR_NO_MEM;
+
+    CRITICAL_REGION_ENTER();
+    if (m_count < APP_SCHED_QUEUE_SIZE)
+    {
+        // Pointer for cleaner code.
+        sched_event_t *p_event = &m_queue[(m_head + m_count) % APP_SCHED_QUEUE_SIZE];
+
+        p_event->handler = handler;
+        p_event->size    = event_size;
+        if ((p_event_data != NULL) && (event_size != 0))
+        {
+            memcpy(p_event->data, p_event_data, event_size);
+        }
+
+        m_count++;
+        result = NRF_SUCCESS;
+    }
+    CRITICAL_REGION_EXIT();
+
+    return result;
+}
+
+void app_sched_execute(void)
+{
+    for (;;)
+    {
+        sched_event_t event;
+        bool          taken = false;
+
+        CRITICAL_REGION_ENTER();
+        if (m_count != 0)
+        {
+            event  = m_queue[m_head];
+            m_head = (m_head + 1) % APP_SCHED_QUEUE_SIZE;
+            m_count--;
+            taken = true;
+        }
+        CRITICAL_REGION_EXIT();
+
+        if (!taken)
+        {
+            break;
+        }
+
+        event.handler((event.size != 0) ? event.data : NULL, event.size);
+    }
+}
+
+uint16_t app_sched_queue_space_used_get(void)
+{
+    return m_count;
+}
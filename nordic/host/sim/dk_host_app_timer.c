@@ -0,0 +1,113 @@
+/**
+ * @file        dk_host_app_timer.c
+ * @author      Danius Kalvaitis (danius.kalvaitis@gmail.com)
+ * @brief       Simulated app_timer of the host build, timers are events on the virtual clock.
+ * @version     0.1
+ * @date        2026-10-17
+ *
+ * @copyright   Copyright (c) Danius Kalvaitis 2026 All rights reserved
+ *
+ */
+
+#include "app_timer.h"
+
+#include "nrf_error.h"
+
+#define NS_PER_S 1000000000ULL ///< Nanoseconds in a second.
+
+static uint64_t time_to_tick(uint64_t time_ns)
+{
+    return (time_ns * APP_TIMER_CLOCK_FREQ) / NS_PER_S;
+}
+
+static uint64_t tick_to_time(uint64_t tick)
+{
+    // First nanosecond at which the RTC counter shows the tick.
+    return ((tick * NS_PER_S) + APP_TIMER_CLOCK_FREQ - 1) / APP_TIMER_CLOCK_FREQ;
+}
+
+static void expiry_schedule(app_timer_t *p_timer);
+
+static void timer_expired(void *p_context)
+{
+    app_timer_t *p_timer = p_context;
+
+    if (p_timer->mode == APP_TIMER_MODE_REPEATED)
+    {
+        p_timer->expiry_tick += p_timer->period;
+        expiry_schedule(p_timer);
+    }
+
+    p_timer->timeout_handler(p_timer->p_context);
+}
+
+static void expiry_schedule(app_timer_t *p_timer)
+{
+    uint64_t now    = dk_host_time_get();
+    uint64_t expiry = tick_to_time(p_timer->expiry_tick);
+
+    dk_host_event_schedule(&p_timer->event, (expiry > now) ? (expiry - now) : 0, timer_expired, p_timer);
+}
+
+ret_code_t app_timer_init(void)
+{
+    return NRF_SUCCESS;
+}
+
+ret_code_t app_timer_create(app_timer_id_t const       *p_timer_id,
+                            app_timer_mode_t            mode,
+                            app_timer_timeout_handler_t timeout_handler)
+{
+    if ((p_timer_id == NULL) || (*p_timer_id == NULL) || (timeout_handler == NULL))
+    {
+        return NRF_ERROR_INVALID_PARAM;
+    }
+
+    // Pointer for cleaner code.
+    app_timer_t *p_timer = *p_timer_id;
+
+    dk_host_event_cancel(&p_timer->event);
+
+    p_timer->timeout_handler = timeout_handler;
+    p_timer->mode            = mode;
+
+    return NRF_SUCCESS;
+}
+
+ret_code_t app_timer_start(app_timer_id_t timer_id, uint32_t timeout_ticks, void *p_context)
+{
+    if ((timeout_ticks < APP_TIMER_MIN_TIMEOUT_TICKS) || (timeout_ticks > APP_TIMER_MAX_CNT_VAL))
+    {
+        return NRF_ERROR_INVALID_PARAM;
+    }
+
+    if ((timer_id == NULL) || (timer_id->timeout_handler == NULL))
+    {
+        return NRF_ERROR_INVALID_STATE;
+    }
+
+    timer_id->period      = timeout_ticks;
+    timer_id->p_context   = p_context;
+    timer_id->expiry_tick = time_to_tick(dk_host_time_get()) + timeout_ticks;
+
+    expiry_schedule(timer_id);
+
+    return NRF_SUCCESS;
+}
+
+ret_code_t app_timer_stop(app_timer_id_t timer_id)
+{
+    if (timer_id == NULL)
+    {
+        return NRF_ERROR_INVALID_PARAM;
+    }
+
+    dk_host_event_cancel(&timer_id->event);
+
+    return NRF_SUCCESS;
+}
+
+uint32_t app_timer_cnt_get(void)
+{
+    return (uint32_t)time_to_tick(dk_host_time_get()) & APP_TIMER_MAX_CNT_VAL;
+}
@@ -0,0 +1,421 @@
+/**
+ * @file        dk_host_ble.c
+ * @author      Danius Kalvaitis (danius.kalvaitis@gmail.com)
+ * @brief       Simulated SoftDevice GATT server of the host build.
+ * @version     0.1
+ * @date        2026-10-17
+ *
+ * @copyright   Copyright (c) Danius Kalvaitis 2026 All rights reserved
+ *
+ */
+
+#include "dk_host_ble.h"
+
+#include <string.h>
+
+#include "ble_srv_common.h"
+#include "nrf_error.h"
+#include "nrf_sdh_ble.h"
+#include "nordic_common.h"
+#include "sdk_macros.h"
+
+/**
+ * @brief Simulated attribute.
+ */
+typedef struct
+{
+    ble_uuid_t uuid;                            ///< Attribute UUID.
+    bool       is_cccd;                         ///< Attribute is the CCCD of the previous value.
+    uint16_t   max_len;                         ///< Maximum value length.
+    uint16_t   len;                             ///< Current value length.
+    uint8_t    value[DK_HOST_BLE_ATTR_MAX_LEN]; ///< Current value.
+} attr_t;
+
+static nrf_sdh_ble_evt_observer_t *m_p_observers;                                 ///< Registered observers.
+static attr_t                      m_attrs[DK_HOST_BLE_ATTR_COUNT];               ///< Attribute table, handle - 1.
+static uint16_t                    m_attr_count;                                  ///< Amount of used attributes.
+static ble_uuid128_t               m_vs_uuids[DK_HOST_BLE_VS_UUID_COUNT];         ///< Vendor specific base UUIDs.
+static uint8_t                     m_vs_uuid_count;                               ///< Amount of vendor base UUIDs.
+static uint16_t                    m_conn_handle = BLE_CONN_HANDLE_INVALID;       ///< Connection of the central.
+static uint32_t                    m_notification_count;                          ///< Amount of sent notifications.
+static uint16_t                    m_notification_handle;                         ///< Handle of the last notification.
+static uint16_t                    m_notification_len;                            ///< Length of the last notification.
+static uint8_t                     m_notification_data[DK_HOST_BLE_ATTR_MAX_LEN]; ///< Data of the last notification.
+
+static void evt_send(ble_evt_t const *p_ble_evt)
+{
+    for (nrf_sdh_ble_evt_observer_t *p_observer = m_p_observers; p_observer != NULL; p_observer = p_observer->p_next)
+    {
+        p_observer->handler(p_ble_evt, p_observer->p_context);
+    }
+}
+
+static attr_t *attr_get(uint16_t handle)
+{
+    if ((handle == 0) || (handle > m_attr_count))
+    {
+        return NULL;
+    }
+
+    return &m_attrs[handle - 1];
+}
+
+static uint32_t attr_add(ble_uuid_t const *p_uuid,
+                         uint16_t          max_len,
+                         uint8_t const    *p_value,
+                         uint16_t          len,
+                         uint16_t         *p_handle)
+{
+    if (m_attr_count >= DK_HOST_BLE_ATTR_COUNT)
+    {
+        return NRF_ERROR_NO_MEM;
+    }
+
+    if ((max_len > DK_HOST_BLE_ATTR_MAX_LEN) || (len > max_len))
+    {
+        return NRF_ERROR_INVALID_LENGTH;
+    }
+
+    // Pointer for cleaner code.
+    attr_t *p_attr = &m_attrs[m_attr_count++];
+
+    memset(p_attr, 0, sizeof(attr_t));
+    p_attr->uuid    = *p_uuid;
+    p_attr->max_len = max_len;
+    p_attr->len     = len;
+    if (p_value != NULL)
+    {
+        memcpy(p_attr->value, p_value, len);
+    }
+
+    *p_handle = m_attr_count;
+
+    return NRF_SUCCESS;
+}
+
+void nrf_sdh_ble_observer_register(nrf_sdh_ble_evt_observer_t *p_observer)
+{
+    nrf_sdh_ble_evt_observer_t **pp_observer = &m_p_observers;
+
+    while (*pp_observer != NULL)
+    {
+        pp_observer = &(*pp_observer)->p_next;
+    }
+
+    p_observer->p_next = NULL;
+    *pp_observer       = p_observer;
+}
+
+uint32_t sd_ble_uuid_vs_add(ble_uuid128_t const *p_vs_uuid, uint8_t *p_uuid_type)
+{
+    if ((p_vs_uuid == NULL) || (p_uuid_type == NULL))
+    {
+        return NRF_ERROR_INVALID_ADDR;
+    }
+
+    for (uint8_t i = 0; i < m_vs_uuid_count; i++)
+    {
+        if (memcmp(&m_vs_uuids[i], p_vs_uuid, sizeof(ble_uuid128_t)) == 0)
+        {
+            *p_uuid_type = BLE_UUID_TYPE_VENDOR_BEGIN + i;
+            return NRF_SUCCESS;
+        }
+    }
+
+    if (m_vs_uuid_count >= DK_HOST_BLE_VS_UUID_COUNT)
+    {
+        return NRF_ERROR_NO_MEM;
+    }
+
+    m_vs_uuids[m_vs_uuid_count] = *p_vs_uuid;
+    *p_uuid_type                = BLE_UUID_TYPE_VENDOR_BEGIN + m_vs_uuid_count++;
+
+    return NRF_SUCCESS;
+}
+
+uint32_t sd_ble_gatts_service_add(uint8_t type, ble_uuid_t const *p_uuid, uint16_t *p_handle)
+{
+    if ((p_uuid == NULL) || (p_handle == NULL))
+    {
+        return NRF_ERROR_INVALID_ADDR;
+    }
+
+    if (type != BLE_GATTS_SRVC_TYPE_PRIMARY)
+    {
+        return NRF_ERROR_INVALID_PARAM;
+    }
+
+    return attr_add(p_uuid, 0, NULL, 0, p_handle);
+}
+
+uint32_t sd_ble_gatts_characteristic_add(uint16_t                   service_handle,
+                                         ble_gatts_char_md_t const *p_char_md,
+                                         ble_gatts_attr_t const    *p_attr_char_value,
+                                         ble_gatts_char_handles_t  *p_handles)
+{
+    if ((p_char_md == NULL) || (p_attr_char_value == NULL) || (p_handles == NULL))
+    {
+        return NRF_ERROR_INVALID_ADDR;
+    }
+
+    if (attr_get(service_handle) == NULL)
+    {
+        return NRF_ERROR_INVALID_PARAM;
+    }
+
+    memset(p_handles, 0, sizeof(ble_gatts_char_handles_t));
+
+    uint32_t result = attr_add(p_attr_char_value->p_uuid,
+                               p_attr_char_value->max_len,
+                               p_attr_char_value->p_value,
+                               p_attr_char_value->init_len,
+                               &p_handles->value_handle);
+    VERIFY_SUCCESS(result);
+
+    if (p_char_md->char_props.notify || p_char_md->char_props.indicate)
+    {
+        ble_uuid_t const cccd_uuid     = {.uuid = 0x2902, .type = 1};
+        uint8_t const    cccd_value[2] = {0};
+
+        result = attr_add(&cccd_uuid, sizeof(cccd_value), cccd_value, sizeof(cccd_value), &p_handles->cccd_handle);
+        VERIFY_SUCCESS(result);
+
+        m_attrs[p_handles->cccd_handle - 1].is_cccd = true;
+    }
+
+    if (p_char_md->p_char_user_desc != NULL)
+    {
+        ble_uuid_t const desc_uuid = {.uuid = 0x2901, .type = 1};
+
+        result = attr_add(&desc_uuid,
+                          p_char_md->char_user_desc_max_size,
+                          p_char_md->p_char_user_desc,
+                          p_char_md->char_user_desc_size,
+                          &p_handles->user_desc_handle);
+    }
+
+    return result;
+}
+
+uint32_t sd_ble_gatts_value_set(uint16_t conn_handle, uint16_t handle, ble_gatts_value_t *p_value)
+{
+    (void)conn_handle;
+
+    attr_t *p_attr = attr_get(handle);
+
+    if (p_attr == NULL)
+    {
+        return NRF_ERROR_INVALID_PARAM;
+    }
+
+    if ((p_value == NULL) || ((p_value->len != 0) && (p_value->p_value == NULL)))
+    {
+        return NRF_ERROR_INVALID_ADDR;
+    }
+
+    if (((uint32_t)p_value->offset + p_value->len) > p_attr->max_len)
+    {
+        return NRF_ERROR_INVALID_LENGTH;
+    }
+
+    memcpy(&p_attr->value[p_value->offset], p_value->p_value, p_value->len);
+    p_attr->len = p_value->offset + p_value->len;
+
+    return NRF_SUCCESS;
+}
+
+uint32_t sd_ble_gatts_value_get(uint16_t conn_handle, uint16_t handle, ble_gatts_value_t *p_value)
+{
+    (void)conn_handle;
+
+    attr_t const *p_attr = attr_get(handle);
+
+    if (p_attr == NULL)
+    {
+        return NRF_ERROR_INVALID_PARAM;
+    }
+
+    if (p_value == NULL)
+    {
+        return NRF_ERROR_INVALID_ADDR;
+    }
+
+    if (p_value->offset > p_attr->len)
+    {
+        return NRF_ERROR_INVALID_PARAM;
+    }
+
+    uint16_t len = MIN(p_value->len, (uint16_t)(p_attr->len - p_value->offset));
+
+    if (p_value->p_value != NULL)
+    {
+        memcpy(p_value->p_value, &p_attr->value[p_value->offset], len);
+    }
+    p_value->len = (p_value->p_value != NULL) ? len : (uint16_t)(p_attr->len - p_value->offset);
+
+    return NRF_SUCCESS;
+}
+
+uint32_t sd_ble_gatts_hvx(uint16_t conn_handle, ble_gatts_hvx_params_t const *p_hvx_params)
+{
+    if ((conn_handle == BLE_CONN_HANDLE_INVALID) || (conn_handle != m_conn_handle))
+    {
+        return NRF_ERROR_INVALID_STATE;
+    }
+
+    if (p_hvx_params == NULL)
+    {
+        return NRF_ERROR_INVALID_ADDR;
+    }
+
+    attr_t       *p_attr = attr_get(p_hvx_params->handle);
+    attr_t const *p_cccd = attr_get(p_hvx_params->handle + 1);
+
+    if (p_attr == NULL)
+    {
+        return NRF_ERROR_INVALID_PARAM;
+    }
+
+    if ((p_cccd == NULL) || !p_cccd->is_cccd || !ble_srv_is_notification_enabled(p_cccd->value))
+    {
+        return NRF_ERROR_INVALID_STATE;
+    }
+
+    uint16_t len = (p_hvx_params->p_len != NULL) ? *p_hvx_params->p_len : p_attr->len;
+
+    if (((uint32_t)p_hvx_params->offset + len) > p_attr->max_len)
+    {
+        return NRF_ERROR_INVALID_LENGTH;
+    }
+
+    if (p_hvx_params->p_data != NULL)
+    {
+        memcpy(&p_attr->value[p_hvx_params->offset], p_hvx_params->p_data, len);
+        p_attr->len = p_hvx_params->offset + len;
+    }
+
+    m_notification_count++;
+    m_notification_handle = p_hvx_params->handle;
+    m_notification_len    = len;
+    memcpy(m_notification_data, &p_attr->value[p_hvx_params->offset], len);
+
+    return NRF_SUCCESS;
+}
+
+uint32_t characteristic_add(uint16_t                  service_handle,
+                            ble_add_char_params_t    *p_char_props,
+                            ble_gatts_char_handles_t *p_char_handle)
+{
+    ble_uuid_t          char_uuid = {.uuid = p_char_props->uuid, .type = p_char_props->uuid_type};
+    ble_gatts_attr_md_t attr_md;
+    ble_gatts_char_md_t char_md;
+    ble_gatts_attr_t    attr_char_value;
+
+    memset(&attr_md, 0, sizeof(attr_md));
+    memset(&char_md, 0, sizeof(char_md));
+    memset(&attr_char_value, 0, sizeof(attr_char_value));
+
+    attr_md.vloc = BLE_GATTS_VLOC_STACK;
+    attr_md.vlen = p_char_props->is_var_len;
+
+    char_md.char_props = p_char_props->char_props;
+    char_md.p_char_pf  = p_char_props->p_presentation_format;
+    if (p_char_props->p_user_descr != NULL)
+    {
+        char_md.p_char_user_desc        = p_char_props->p_user_descr->p_char_user_desc;
+        char_md.char_user_desc_max_size = p_char_props->p_user_descr->max_size;
+        char_md.char_user_desc_size     = p_char_props->p_user_descr->size;
+    }
+
+    attr_char_value.p_uuid    = &char_uuid;
+    attr_char_value.p_attr_md = &attr_md;
+    attr_char_value.init_len  = p_char_props->init_len;
+    attr_char_value.max_len   = p_char_props->max_len;
+    attr_char_value.p_value   = p_char_props->p_init_value;
+
+    return sd_ble_gatts_characteristic_add(service_handle, &char_md, &attr_char_value, p_char_handle);
+}
+
+void dk_host_ble_reset(void)
+{
+    memset(m_attrs, 0, sizeof(m_attrs));
+    m_attr_count          = 0;
+    m_vs_uuid_count       = 0;
+    m_conn_handle         = BLE_CONN_HANDLE_INVALID;
+    m_notification_count  = 0;
+    m_notification_handle = 0;
+    m_notification_len    = 0;
+}
+
+void dk_host_ble_connect(uint16_t conn_handle)
+{
+    ble_evt_t evt;
+
+    memset(&evt, 0, sizeof(evt));
+    evt.header.evt_id           = BLE_GAP_EVT_CONNECTED;
+    evt.header.evt_len          = sizeof(evt);
+    evt.evt.gap_evt.conn_handle = conn_handle;
+
+    m_conn_handle = conn_handle;
+    evt_send(&evt);
+}
+
+void dk_host_ble_disconnect(void)
+{
+    ble_evt_t evt;
+
+    memset(&evt, 0, sizeof(evt));
+    evt.header.evt_id           = BLE_GAP_EVT_DISCONNECTED;
+    evt.header.evt_len          = sizeof(evt);
+    evt.evt.gap_evt.conn_handle = m_conn_handle;
+
+    // CCCDs of a peer without bond do not survive the connection.
+    for (uint16_t i = 0; i < m_attr_count; i++)
+    {
+        if (m_attrs[i].is_cccd)
+        {
+            memset(m_attrs[i].value, 0, m_attrs[i].len);
+        }
+    }
+
+    m_conn_handle = BLE_CONN_HANDLE_INVALID;
+    evt_send(&evt);
+}
+
+void dk_host_ble_write(uint16_t handle, uint8_t const *p_data, uint16_t len)
+{
+    attr_t   *p_attr = attr_get(handle);
+    ble_evt_t evt;
+
+    if ((p_attr == NULL) || (len > p_attr->max_len) || (len > sizeof(evt.evt.gatts_evt.params.write.data)))
+    {
+        return;
+    }
+
+    memcpy(p_attr->value, p_data, len);
+    p_attr->len = len;
+
+    memset(&evt, 0, sizeof(evt));
+    evt.header.evt_id                     = BLE_GATTS_EVT_WRITE;
+    evt.header.evt_len                    = sizeof(evt);
+    evt.evt.gatts_evt.conn_handle         = m_conn_handle;
+    evt.evt.gatts_evt.params.write.handle = handle;
+    evt.evt.gatts_evt.params.write.uuid   = p_attr->uuid;
+    evt.evt.gatts_evt.params.write.len    = len;
+    memcpy(evt.evt.gatts_evt.params.write.data, p_data, len);
+
+    evt_send(&evt);
+}
+
+uint32_t dk_host_ble_notification_count_get(void)
+{
+    return m_notification_count;
+}
+
+uint16_t dk_host_ble_notification_last_get(uint16_t *p_handle, uint8_t *p_data)
+{
+    *p_handle = m_notification_handle;
+    memcpy(p_data, m_notification_data, m_notification_len);
+
+    return m_notification_len;
+}
@@ -0,0 +1,74 @@
+/**
+ * @file        dk_host_ble.h
+ * @author      Danius Kalvaitis (danius.kalvaitis@gmail.com)
+ * @brief       Simulated SoftDevice GATT server of the host build.
+ * @version     0.1
+ * @date        2026-10-17
+ *
+ * @copyright   Copyright (c) Danius Kalvaitis 2026 All rights reserved
+ *
+ */
+
+#ifndef DK_HOST_BLE_H
+#define DK_HOST_BLE_H
+
+#include <stdint.h>
+
+#include "ble.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define DK_HOST_BLE_ATTR_COUNT    64 ///< Size of the simulated attribute table.
+#define DK_HOST_BLE_ATTR_MAX_LEN  64 ///< Longest attribute value.
+#define DK_HOST_BLE_VS_UUID_COUNT 4  ///< Amount of vendor specific base UUIDs.
+
+/**
+ * @brief       Clear the attribute table and the connection, registered observers are kept.
+ */
+void dk_host_ble_reset(void);
+
+/**
+ * @brief       Connect a simulated central and send BLE_GAP_EVT_CONNECTED to the observers.
+ *
+ * @param[in]   conn_handle Connection handle.
+ */
+void dk_host_ble_connect(uint16_t conn_handle);
+
+/**
+ * @brief       Disconnect the central, clear the CCCDs and send BLE_GAP_EVT_DISCONNECTED to the observers.
+ */
+void dk_host_ble_disconnect(void);
+
+/**
+ * @brief       Write an attribute from the central and send BLE_GATTS_EVT_WRITE to the observers.
+ *
+ * @param[in]   handle  Attribute handle, a CCCD handle enables or disables notifications.
+ * @param[in]   p_data  Data to write.
+ * @param[in]   len     Length of the data.
+ */
+void dk_host_ble_write(uint16_t handle, uint8_t const *p_data, uint16_t len);
+
+/**
+ * @brief       Get the amount of notifications sent since @ref dk_host_ble_reset.
+ *
+ * @return      Amount of notifications.
+ */
+uint32_t dk_host_ble_notification_count_get(void);
+
+/**
+ * @brief       Get the last notification.
+ *
+ * @param[out]  p_handle    Value handle of the notification.
+ * @param[out]  p_data      Buffer for the data, @ref DK_HOST_BLE_ATTR_MAX_LEN bytes.
+ *
+ * @return      Length of the notification, 0 if none was sent.
+ */
+uint16_t dk_host_ble_notification_last_get(uint16_t *p_handle, uint8_t *p_data);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // DK_HOST_BLE_H
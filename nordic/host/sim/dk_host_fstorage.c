@@ -0,0 +1,306 @@
+/**
+ * @file        dk_host_fstorage.c
+ * @author      Danius Kalvaitis (danius.kalvaitis@gmail.com)
+ * @brief       Simulated flash of the host build, operations complete after the nRF52 write and erase times.
+ * @version     0.1
+ * @date        2026-10-17
+ *
+ * @copyright   Copyright (c) Danius Kalvaitis 2026 All rights reserved
+ *
+ */
+
+#include "dk_host_fstorage.h"
+
+#include <string.h>
+
+#include "dk_host_sim.h"
+#include "nrf_error.h"
+#include "nrf_fstorage_sd.h"
+
+/**
+ * @brief Queued flash operation.
+ */
+typedef struct
+{
+    nrf_fstorage_t const *p_fs;    ///< Instance that requested the operation.
+    nrf_fstorage_evt_id_t id;      ///< Write or erase.
+    uint32_t              addr;    ///< Flash address.
+    void const           *p_src;   ///< Data to write.
+    uint32_t              len;     ///< Bytes to write or pages to erase.
+    void                 *p_param; ///< User parameter.
+} flash_op_t;
+
+static uint8_t         m_flash[DK_HOST_FLASH_SIZE];       ///< Simulated flash.
+static flash_op_t      m_queue[DK_HOST_FLASH_QUEUE_SIZE]; ///< Queued operations, the first one is in progress.
+static uint32_t        m_count;                           ///< Amount of queued operations.
+static dk_host_event_t m_done_event;                      ///< Completion of the operation in progress.
+
+static nrf_fstorage_info_t const m_flash_info = {
+  .erase_unit   = DK_HOST_FLASH_PAGE_SIZE,
+  .program_unit = sizeof(uint32_t),
+  .rmap         = true,
+  .wmap         = false,
+};
+
+static void op_start(void);
+
+static void op_done(void *p_context)
+{
+    (void)p_context;
+
+    flash_op_t op = m_queue[0];
+
+    if (op.id == NRF_FSTORAGE_EVT_WRITE_RESULT)
+    {
+        uint8_t const *p_src = op.p_src;
+
+        // Programming can only clear bits.
+        for (uint32_t i = 0; i < op.len; i++)
+        {
+            m_flash[op.addr + i] &= p_src[i];
+        }
+    } else
+    {
+        memset(&m_flash[op.addr], 0xFF, op.len * DK_HOST_FLASH_PAGE_SIZE);
+    }
+
+    memmove(&m_queue[0], &m_queue[1], (m_count - 1) * sizeof(flash_op_t));
+    m_count--;
+    op_start();
+
+    if (op.p_fs->evt_handler != NULL)
+    {
+        nrf_fstorage_evt_t evt = {
+          .id      = op.id,
+          .result  = NRF_SUCCESS,
+          .addr    = op.addr,
+          .p_src   = op.p_src,
+          .len     = op.len,
+          .p_param = op.p_param,
+        };
+
+        op.p_fs->evt_handler(&evt);
+    }
+}
+
+static void op_start(void)
+{
+    if (m_count == 0)
+    {
+        return;
+    }
+
+    // Pointer for cleaner code.
+    flash_op_t const *p_op = &m_queue[0];
+
+    uint64_t duration = (p_op->id == NRF_FSTORAGE_EVT_WRITE_RESULT)
+                          ? ((uint64_t)(p_op->len / sizeof(uint32_t)) * DK_HOST_FLASH_WRITE_NS)
+                          : ((uint64_t)p_op->len * DK_HOST_FLASH_ERASE_NS);
+
+    dk_host_event_schedule(&m_done_event, duration, op_done, NULL);
+}
+
+static ret_code_t op_put(flash_op_t const *p_op)
+{
+    if (m_count >= DK_HOST_FLASH_QUEUE_SIZE)
+    {
+        return NRF_ERROR_NO_MEM;
+    }
+
+    m_queue[m_count++] = *p_op;
+
+    if (m_count == 1)
+    {
+        op_start();
+    }
+
+    return NRF_SUCCESS;
+}
+
+static bool range_valid(nrf_fstorage_t const *p_fs, uint32_t addr, uint32_t len)
+{
+    return (addr >= p_fs->start_addr) && (addr < p_fs->end_addr) && (len <= (p_fs->end_addr - addr)) &&
+           (p_fs->end_addr <= DK_HOST_FLASH_SIZE);
+}
+
+static ret_code_t sim_init(nrf_fstorage_t *p_fs, void *p_param)
+{
+    (void)p_param;
+
+    p_fs->p_flash_info = &m_flash_info;
+
+    return NRF_SUCCESS;
+}
+
+static ret_code_t sim_read(nrf_fstorage_t const *p_fs, uint32_t src, void *p_dest, uint32_t len)
+{
+    if (!range_valid(p_fs, src, len))
+    {
+        return NRF_ERROR_INVALID_ADDR;
+    }
+
+    memcpy(p_dest, &m_flash[src], len);
+
+    return NRF_SUCCESS;
+}
+
+static ret_code_t sim_write(nrf_fstorage_t const *p_fs,
+                            uint32_t              dest,
+                            void const           *p_src,
+                            uint32_t              len,
+                            void                 *p_param)
+{
+    if ((len % m_flash_info.program_unit) != 0)
+    {
+        return NRF_ERROR_INVALID_LENGTH;
+    }
+
+    if (((dest % m_flash_info.program_unit) != 0) || !range_valid(p_fs, dest, len))
+    {
+        return NRF_ERROR_INVALID_ADDR;
+    }
+
+    flash_op_t op = {
+      .p_fs    = p_fs,
+      .id      = NRF_FSTORAGE_EVT_WRITE_RESULT,
+      .addr    = dest,
+      .p_src   = p_src,
+      .len     = len,
+      .p_param = p_param,
+    };
+
+    return op_put(&op);
+}
+
+static ret_code_t sim_erase(nrf_fstorage_t const *p_fs, uint32_t page_addr, uint32_t len, void *p_param)
+{
+    if (((page_addr % DK_HOST_FLASH_PAGE_SIZE) != 0) ||
+        !range_valid(p_fs, page_addr, (uint32_t)((uint64_t)len * DK_HOST_FLASH_PAGE_SIZE)))
+    {
+        return NRF_ERROR_INVALID_ADDR;
+    }
+
+    flash_op_t op = {
+      .p_fs    = p_fs,
+      .id      = NRF_FSTORAGE_EVT_ERASE_RESULT,
+      .addr    = page_addr,
+      .p_src   = NULL,
+      .len     = len,
+      .p_param = p_param,
+    };
+
+    return op_put(&op);
+}
+
+static bool sim_is_busy(nrf_fstorage_t const *p_fs)
+{
+    (void)p_fs;
+
+    return m_count != 0;
+}
+
+nrf_fstorage_api_t nrf_fstorage_sd = {
+  .init    = sim_init,
+  .read    = sim_read,
+  .write   = sim_write,
+  .erase   = sim_erase,
+  .is_busy = sim_is_busy,
+};
+
+ret_code_t nrf_fstorage_init(nrf_fstorage_t *p_fs, nrf_fstorage_api_t *p_api, void *p_param)
+{
+    if ((p_fs == NULL) || (p_api == NULL))
+    {
+        return NRF_ERROR_NULL;
+    }
+
+    p_fs->p_api = p_api;
+
+    return p_api->init(p_fs, p_param);
+}
+
+ret_code_t nrf_fstorage_read(nrf_fstorage_t const *p_fs, uint32_t src, void *p_dest, uint32_t len)
+{
+    if ((p_fs == NULL) || (p_dest == NULL))
+    {
+        return NRF_ERROR_NULL;
+    }
+
+    if (p_fs->p_api == NULL)
+    {
+        return NRF_ERROR_INVALID_STATE;
+    }
+
+    if (len == 0)
+    {
+        return NRF_ERROR_INVALID_LENGTH;
+    }
+
+    return p_fs->p_api->read(p_fs, src, p_dest, len);
+}
+
+ret_code_t nrf_fstorage_write(nrf_fstorage_t const *p_fs,
+                              uint32_t              dest,
+                              void const           *p_src,
+                              uint32_t              len,
+                              void                 *p_param)
+{
+    if ((p_fs == NULL) || (p_src == NULL))
+    {
+        return NRF_ERROR_NULL;
+    }
+
+    if (p_fs->p_api == NULL)
+    {
+        return NRF_ERROR_INVALID_STATE;
+    }
+
+    if (len == 0)
+    {
+        return NRF_ERROR_INVALID_LENGTH;
+    }
+
+    return p_fs->p_api->write(p_fs, dest, p_src, len, p_param);
+}
+
+ret_code_t nrf_fstorage_erase(nrf_fstorage_t const *p_fs, uint32_t page_addr, uint32_t len, void *p_param)
+{
+    if (p_fs == NULL)
+    {
+        return NRF_ERROR_NULL;
+    }
+
+    if (p_fs->p_api == NULL)
+    {
+        return NRF_ERROR_INVALID_STATE;
+    }
+
+    if (len == 0)
+    {
+        return NRF_ERROR_INVALID_LENGTH;
+    }
+
+    return p_fs->p_api->erase(p_fs, page_addr, len, p_param);
+}
+
+bool nrf_fstorage_is_busy(nrf_fstorage_t const *p_fs)
+{
+    if ((p_fs == NULL) || (p_fs->p_api == NULL))
+    {
+        return m_count != 0;
+    }
+
+    return p_fs->p_api->is_busy(p_fs);
+}
+
+void dk_host_fstorage_reset(void)
+{
+    dk_host_event_cancel(&m_done_event);
+    m_count = 0;
+    memset(m_flash, 0xFF, sizeof(m_flash));
+}
+
+uint8_t const *dk_host_fstorage_mem_get(uint32_t addr)
+{
+    return &m_flash[addr];
+}
@@ -0,0 +1,47 @@
+/**
+ * @file        dk_host_fstorage.h
+ * @author      Danius Kalvaitis (danius.kalvaitis@gmail.com)
+ * @brief       Simulated flash of the host build.
+ * @version     0.1
+ * @date        2026-10-17
+ *
+ * @copyright   Copyright (c) Danius Kalvaitis 2026 All rights reserved
+ *
+ */
+
+#ifndef DK_HOST_FSTORAGE_H
+#define DK_HOST_FSTORAGE_H
+
+#include <stdint.h>
+
+#include "nrf_fstorage.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define DK_HOST_FLASH_SIZE       (512 * 1024) ///< Size of the simulated flash, nRF52832.
+#define DK_HOST_FLASH_PAGE_SIZE  4096         ///< Size of a flash page.
+#define DK_HOST_FLASH_WRITE_NS   41000        ///< Time to write one word.
+#define DK_HOST_FLASH_ERASE_NS   85000000     ///< Time to erase one page.
+#define DK_HOST_FLASH_QUEUE_SIZE 4            ///< Amount of operations that can be queued.
+
+/**
+ * @brief       Erase the whole simulated flash and drop all queued operations.
+ */
+void dk_host_fstorage_reset(void);
+
+/**
+ * @brief       Get the simulated flash content, for inspection in tests.
+ *
+ * @param[in]   addr    Flash address.
+ *
+ * @return      Pointer to the byte at @p addr.
+ */
+uint8_t const *dk_host_fstorage_mem_get(uint32_t addr);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // DK_HOST_FSTORAGE_H
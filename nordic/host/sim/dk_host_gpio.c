@@ -0,0 +1,140 @@
+/**
+ * @file        dk_host_gpio.c
+ * @author      Danius Kalvaitis (danius.kalvaitis@gmail.com)
+ * @brief       Simulated GPIO of the host build, lines are open drain with a pull-up.
+ * @version     0.1
+ * @date        2026-10-17
+ *
+ * @copyright   Copyright (c) Danius Kalvaitis 2026 All rights reserved
+ *
+ */
+
+#include "nrf_gpio.h"
+
+#include "nrf_assert.h"
+
+/**
+ * @brief Simulated pin.
+ */
+typedef struct
+{
+    bool output;   ///< Pin is configured as output.
+    bool latch;    ///< Output latch.
+    bool held_low; ///< A simulated device holds the line low.
+} pin_t;
+
+static pin_t                  m_pins[DK_HOST_GPIO_PIN_COUNT]; ///< Pin states.
+static dk_host_gpio_handler_t m_handler;                      ///< Called when the output level changes.
+
+static void latch_write(uint32_t pin_number, bool value)
+{
+    ASSERT(pin_number < DK_HOST_GPIO_PIN_COUNT);
+
+    // Pointer for cleaner code.
+    pin_t *p_pin = &m_pins[pin_number];
+
+    bool changed = (p_pin->latch != value);
+
+    p_pin->latch = value;
+
+    if (changed && p_pin->output && (m_handler != NULL))
+    {
+        m_handler(pin_number, value);
+    }
+}
+
+void nrf_gpio_cfg(uint32_t             pin_number,
+                  nrf_gpio_pin_dir_t   dir,
+                  nrf_gpio_pin_input_t input,
+                  nrf_gpio_pin_pull_t  pull,
+                  nrf_gpio_pin_drive_t drive,
+                  nrf_gpio_pin_sense_t sense)
+{
+    ASSERT(pin_number < DK_HOST_GPIO_PIN_COUNT);
+
+    (void)input;
+    (void)pull;
+    (void)drive;
+    (void)sense;
+
+    m_pins[pin_number].output = (dir == NRF_GPIO_PIN_DIR_OUTPUT);
+}
+
+void nrf_gpio_cfg_output(uint32_t pin_number)
+{
+    nrf_gpio_cfg(pin_number,
+                 NRF_GPIO_PIN_DIR_OUTPUT,
+                 NRF_GPIO_PIN_INPUT_DISCONNECT,
+                 NRF_GPIO_PIN_NOPULL,
+                 NRF_GPIO_PIN_S0S1,
+                 NRF_GPIO_PIN_NOSENSE);
+}
+
+void nrf_gpio_cfg_input(uint32_t pin_number, nrf_gpio_pin_pull_t pull_config)
+{
+    nrf_gpio_cfg(pin_number,
+                 NRF_GPIO_PIN_DIR_INPUT,
+                 NRF_GPIO_PIN_INPUT_CONNECT,
+                 pull_config,
+                 NRF_GPIO_PIN_S0S1,
+                 NRF_GPIO_PIN_NOSENSE);
+}
+
+void nrf_gpio_pin_write(uint32_t pin_number, uint32_t value)
+{
+    latch_write(pin_number, value != 0);
+}
+
+void nrf_gpio_pin_set(uint32_t pin_number)
+{
+    latch_write(pin_number, true);
+}
+
+void nrf_gpio_pin_clear(uint32_t pin_number)
+{
+    latch_write(pin_number, false);
+}
+
+uint32_t nrf_gpio_pin_read(uint32_t pin_number)
+{
+    ASSERT(pin_number < DK_HOST_GPIO_PIN_COUNT);
+
+    // Pointer for cleaner code.
+    pin_t const *p_pin = &m_pins[pin_number];
+
+    if (p_pin->held_low)
+    {
+        return 0;
+    }
+
+    return p_pin->output ? (uint32_t)p_pin->latch : 1;
+}
+
+uint32_t nrf_gpio_pin_out_read(uint32_t pin_number)
+{
+    ASSERT(pin_number < DK_HOST_GPIO_PIN_COUNT);
+
+    return m_pins[pin_number].latch;
+}
+
+void dk_host_gpio_reset(void)
+{
+    for (uint32_t i = 0; i < DK_HOST_GPIO_PIN_COUNT; i++)
+    {
+        m_pins[i] = (pin_t){.output = false, .latch = false, .held_low = false};
+    }
+
+    m_handler = NULL;
+}
+
+void dk_host_gpio_hold_low(uint32_t pin_number, bool hold)
+{
+    ASSERT(pin_number < DK_HOST_GPIO_PIN_COUNT);
+
+    m_pins[pin_number].held_low = hold;
+}
+
+void dk_host_gpio_handler_set(dk_host_gpio_handler_t handler)
+{
+    m_handler = handler;
+}
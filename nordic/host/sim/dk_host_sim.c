@@ -0,0 +1,233 @@
+/**
+ * @file        dk_host_sim.c
+ * @author      Danius Kalvaitis (danius.kalvaitis@gmail.com)
+ * @brief       Virtual time and interrupt simulation of the host build.
+ * @version     0.1
+ * @date        2026-10-17
+ *
+ * @copyright   Copyright (c) Danius Kalvaitis 2026 All rights reserved
+ *
+ */
+
+#include "dk_host_sim.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "nrf.h"
+
+NRF_SERIAL_Type dk_host_serial_regs[3]; ///< Memory of the serial peripherals, only written by the ERRATA 89 workaround.
+
+static uint64_t         m_time_ns;        ///< Virtual time.
+static dk_host_event_t *m_p_head;         ///< Scheduled events sorted by due time.
+static uint32_t         m_critical_depth; ///< Nesting of critical regions.
+static uint32_t         m_event_depth;    ///< Nesting of event handlers.
+static uint64_t         m_critical_start; ///< Time the outermost critical region was entered.
+static uint64_t         m_critical_max;   ///< Longest critical region.
+
+static void event_unlink(dk_host_event_t *p_event)
+{
+    for (dk_host_event_t **pp_event = &m_p_head; *pp_event != NULL; pp_event = &(*pp_event)->p_next)
+    {
+        if (*pp_event == p_event)
+        {
+            *pp_event = p_event->p_next;
+            break;
+        }
+    }
+
+    p_event->scheduled = false;
+    p_event->p_next    = NULL;
+}
+
+static void event_dispatch(dk_host_event_t *p_event)
+{
+    event_unlink(p_event);
+
+    if (p_event->time_ns > m_time_ns)
+    {
+        m_time_ns = p_event->time_ns;
+    }
+
+    m_event_depth++;
+    p_event->handler(p_event->p_context);
+    m_event_depth--;
+}
+
+/**
+ * @brief Dispatch the events that are due, if thread mode with interrupts enabled is running.
+ */
+static void due_events_dispatch(void)
+{
+    while ((m_critical_depth == 0) && (m_event_depth == 0) && (m_p_head != NULL) && (m_p_head->time_ns <= m_time_ns))
+    {
+        event_dispatch(m_p_head);
+    }
+}
+
+void dk_host_reset(void)
+{
+    while (m_p_head != NULL)
+    {
+        event_unlink(m_p_head);
+    }
+
+    m_time_ns        = 0;
+    m_critical_depth = 0;
+    m_event_depth    = 0;
+    m_critical_max   = 0;
+}
+
+uint64_t dk_host_time_get(void)
+{
+    return m_time_ns;
+}
+
+uint32_t dk_host_cycles_get(void)
+{
+    return (uint32_t)((m_time_ns * (DK_HOST_CPU_HZ / 1000000)) / 1000);
+}
+
+void dk_host_time_advance(uint64_t duration_ns)
+{
+    uint64_t target = m_time_ns + duration_ns;
+
+    while ((m_critical_depth == 0) && (m_event_depth == 0) && (m_p_head != NULL) && (m_p_head->time_ns <= target))
+    {
+        event_dispatch(m_p_head);
+    }
+
+    if (target > m_time_ns)
+    {
+        m_time_ns = target;
+    }
+}
+
+void dk_host_event_schedule(dk_host_event_t        *p_event,
+                            uint64_t                delay_ns,
+                            dk_host_event_handler_t handler,
+                            void                   *p_context)
+{
+    if (p_event->scheduled)
+    {
+        event_unlink(p_event);
+    }
+
+    p_event->time_ns   = m_time_ns + delay_ns;
+    p_event->handler   = handler;
+    p_event->p_context = p_context;
+    p_event->scheduled = true;
+
+    dk_host_event_t **pp_event = &m_p_head;
+
+    // Events due at the same time are dispatched in the order they were scheduled.
+    while ((*pp_event != NULL) && ((*pp_event)->time_ns <= p_event->time_ns))
+    {
+        pp_event = &(*pp_event)->p_next;
+    }
+
+    p_event->p_next = *pp_event;
+    *pp_event       = p_event;
+}
+
+void dk_host_event_cancel(dk_host_event_t *p_event)
+{
+    if (p_event->scheduled)
+    {
+        event_unlink(p_event);
+    }
+}
+
+bool dk_host_run_next(void)
+{
+    if (m_p_head == NULL)
+    {
+        return false;
+    }
+
+    event_dispatch(m_p_head);
+    due_events_dispatch();
+
+    return true;
+}
+
+void dk_host_run_until(uint64_t time_ns)
+{
+    while ((m_p_head != NULL) && (m_p_head->time_ns <= time_ns))
+    {
+        event_dispatch(m_p_head);
+    }
+
+    if (time_ns > m_time_ns)
+    {
+        m_time_ns = time_ns;
+    }
+}
+
+void dk_host_wait_for_event(void)
+{
+    if (m_p_head == NULL)
+    {
+        fprintf(stderr, "dk_host_sim: sleeping with no event scheduled at %llu ns, nothing can wake the CPU\n",
+                (unsigned long long)m_time_ns);
+        abort();
+    }
+
+    if (m_critical_depth != 0)
+    {
+        // Masked interrupts wake the CPU but stay pending until the critical region is left.
+        if (m_p_head->time_ns > m_time_ns)
+        {
+            m_time_ns = m_p_head->time_ns;
+        }
+        return;
+    }
+
+    // A sleep in an event handler is woken by a nested interrupt.
+    event_dispatch(m_p_head);
+    due_events_dispatch();
+}
+
+void dk_host_critical_enter(void)
+{
+    if (m_critical_depth++ == 0)
+    {
+        m_critical_start = m_time_ns;
+    }
+}
+
+void dk_host_critical_exit(void)
+{
+    if (m_critical_depth == 0)
+    {
+        fprintf(stderr, "dk_host_sim: critical region left more often than entered\n");
+        abort();
+    }
+
+    if (--m_critical_depth == 0)
+    {
+        uint64_t duration = m_time_ns - m_critical_start;
+
+        if (duration > m_critical_max)
+        {
+            m_critical_max = duration;
+        }
+
+        due_events_dispatch();
+    }
+}
+
+bool dk_host_in_event(void)
+{
+    return m_event_depth != 0;
+}
+
+uint64_t dk_host_critical_max_get(void)
+{
+    return m_critical_max;
+}
+
+void dk_host_critical_max_reset(void)
+{
+    m_critical_max = 0;
+}
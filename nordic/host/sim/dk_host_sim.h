@@ -0,0 +1,151 @@
+/**
+ * @file        dk_host_sim.h
+ * @author      Danius Kalvaitis (danius.kalvaitis@gmail.com)
+ * @brief       Virtual time and interrupt simulation of the host build.
+ * @version     0.1
+ * @date        2026-10-17
+ *
+ * @copyright   Copyright (c) Danius Kalvaitis 2026 All rights reserved
+ *
+ */
+
+#ifndef DK_HOST_SIM_H
+#define DK_HOST_SIM_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Frequency of the simulated CPU cycle counter in Hz.
+ */
+#define DK_HOST_CPU_HZ 64000000
+
+/**
+ * @brief Function called when an event is dispatched, it runs as an interrupt handler.
+ */
+typedef void (*dk_host_event_handler_t)(void *p_context);
+
+/**
+ * @brief Simulated interrupt.
+ *
+ * @details Memory of the event is provided by the user and has to stay valid while the event is scheduled.
+ */
+typedef struct dk_host_event_s
+{
+    uint64_t                time_ns;   ///< Virtual time the event is due at.
+    dk_host_event_handler_t handler;   ///< Function called when the event is dispatched.
+    void                   *p_context; ///< Context passed to @p handler.
+    struct dk_host_event_s *p_next;    ///< Next scheduled event.
+    bool                    scheduled; ///< Event is in the event list.
+} dk_host_event_t;
+
+/**
+ * @brief       Reset virtual time, drop all scheduled events and clear the critical region statistics.
+ */
+void dk_host_reset(void);
+
+/**
+ * @brief       Get the virtual time.
+ *
+ * @return      Nanoseconds since @ref dk_host_reset.
+ */
+uint64_t dk_host_time_get(void);
+
+/**
+ * @brief       Get the simulated CPU cycle counter (DWT CYCCNT), derived from virtual time.
+ *
+ * @return      Cycles of @ref DK_HOST_CPU_HZ since @ref dk_host_reset, wrapping at 32 bits.
+ */
+uint32_t dk_host_cycles_get(void);
+
+/**
+ * @brief       Let virtual time pass while the CPU is busy, e.g. in nrf_delay_us.
+ *
+ * @details     Events that become due preempt the caller like interrupts, unless the caller is in a critical region
+ *              or an event handler. They stay pending then until the critical region is left.
+ *
+ * @param[in]   duration_ns Time to pass in nanoseconds.
+ */
+void dk_host_time_advance(uint64_t duration_ns);
+
+/**
+ * @brief       Schedule an event, an already scheduled event is moved to the new time.
+ *
+ * @param[in]   p_event     Pointer to event.
+ * @param[in]   delay_ns    Time from now the event is due at.
+ * @param[in]   handler     Function called when the event is dispatched.
+ * @param[in]   p_context   Context passed to @p handler.
+ */
+void dk_host_event_schedule(dk_host_event_t        *p_event,
+                            uint64_t                delay_ns,
+                            dk_host_event_handler_t handler,
+                            void                   *p_context);
+
+/**
+ * @brief       Remove a scheduled event. Events that are not scheduled are ignored.
+ *
+ * @param[in]   p_event Pointer to event.
+ */
+void dk_host_event_cancel(dk_host_event_t *p_event);
+
+/**
+ * @brief       Advance virtual time to the next event and dispatch it.
+ *
+ * @retval      true    If an event was dispatched.
+ * @retval      false   If no event is scheduled.
+ */
+bool dk_host_run_next(void);
+
+/**
+ * @brief       Dispatch all events due before the given time and advance virtual time to it.
+ *
+ * @param[in]   time_ns Virtual time to run to.
+ */
+void dk_host_run_until(uint64_t time_ns);
+
+/**
+ * @brief       Sleep until the next event, the host replacement of WFE.
+ *
+ * @details     Inside a critical region the CPU wakes up at the time the next event is due, but the event stays
+ *              pending until the critical region is left. Aborts the program if nothing could ever wake the CPU.
+ */
+void dk_host_wait_for_event(void);
+
+/**
+ * @brief       Enter a critical region (CRITICAL_REGION_ENTER).
+ */
+void dk_host_critical_enter(void);
+
+/**
+ * @brief       Leave a critical region (CRITICAL_REGION_EXIT), dispatching events that became due inside it.
+ */
+void dk_host_critical_exit(void);
+
+/**
+ * @brief       Check if the caller runs in an event handler.
+ *
+ * @return      True in an event handler (interrupt), false in thread mode.
+ */
+bool dk_host_in_event(void);
+
+/**
+ * @brief       Get the longest time interrupts were disabled by a critical region.
+ *
+ * @return      Virtual time in nanoseconds since @ref dk_host_reset or @ref dk_host_critical_max_reset.
+ */
+uint64_t dk_host_critical_max_get(void);
+
+/**
+ * @brief       Clear the longest critical region time.
+ */
+void dk_host_critical_max_reset(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // DK_HOST_SIM_H
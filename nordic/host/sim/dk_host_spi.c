@@ -0,0 +1,264 @@
+/**
+ * @file        dk_host_spi.c
+ * @author      Danius Kalvaitis (danius.kalvaitis@gmail.com)
+ * @brief       Simulated SPI bus of the host build, implements the nrfx_spi and nrfx_spim stubs.
+ * @version     0.1
+ * @date        2026-10-17
+ *
+ * @copyright   Copyright (c) Danius Kalvaitis 2026 All rights reserved
+ *
+ */
+
+#include "dk_host_spi.h"
+
+#include <string.h>
+
+#include "dk_host_sim.h"
+#include "nrf_assert.h"
+#include "nrf_gpio.h"
+#include "nrfx_spi.h"
+#include "nrfx_spim.h"
+
+#define NS_PER_S          1000000000ULL ///< Nanoseconds in a second.
+#define FREQUENCY_SHIFT   25            ///< FREQUENCY register value shifted by this is the rate in 125 kbps units.
+#define FREQUENCY_UNIT_HZ 125000        ///< Rate of the FREQUENCY register unit.
+
+/**
+ * @brief State of a simulated bus and the driver instance using it.
+ */
+typedef struct
+{
+    dk_host_spi_slave_t    *p_slaves;     ///< Attached slaves.
+    bool                    initialized;  ///< Driver instance is initialized.
+    bool                    busy;         ///< Transfer in progress.
+    bool                    spim;         ///< Instance is used by nrfx_spim.
+    uint8_t                 orc;          ///< Over-run character.
+    uint32_t                frequency_hz; ///< Bus frequency.
+    nrfx_spi_evt_handler_t  spi_handler;  ///< Event handler of nrfx_spi.
+    nrfx_spim_evt_handler_t spim_handler; ///< Event handler of nrfx_spim.
+    void                   *p_context;    ///< Context of the event handler.
+    nrfx_spi_xfer_desc_t    xfer;         ///< Transfer in progress, SPIM descriptors are converted.
+    dk_host_event_t         done_event;   ///< Transfer completion interrupt.
+    uint32_t                xfer_count;   ///< Amount of started transfers.
+} bus_t;
+
+static bus_t m_buses[DK_HOST_SPI_BUS_COUNT]; ///< Simulated buses.
+
+/**
+ * @brief Clock the transfer through the selected slaves and return its duration on the bus.
+ */
+static uint64_t xfer_run(bus_t *p_bus)
+{
+    // Pointer for cleaner code.
+    nrfx_spi_xfer_desc_t const *p_xfer = &p_bus->xfer;
+
+    size_t length = MAX(p_xfer->tx_length, p_xfer->rx_length);
+
+    p_bus->xfer_count++;
+
+    for (size_t i = 0; i < length; i++)
+    {
+        uint8_t mosi = (i < p_xfer->tx_length) ? p_xfer->p_tx_buffer[i] : p_bus->orc;
+        uint8_t miso = 0xFF;
+
+        for (dk_host_spi_slave_t *p_slave = p_bus->p_slaves; p_slave != NULL; p_slave = p_slave->p_next)
+        {
+            if (nrf_gpio_pin_read(p_slave->cs_pin) == 0)
+            {
+                // Several selected slaves drive MISO together, the line reads the wired AND.
+                miso &= p_slave->exchange(p_slave, mosi);
+            }
+        }
+
+        if (i < p_xfer->rx_length)
+        {
+            p_xfer->p_rx_buffer[i] = miso;
+        }
+    }
+
+    return ((uint64_t)length * 8 * NS_PER_S) / p_bus->frequency_hz;
+}
+
+static void xfer_done(void *p_context)
+{
+    bus_t *p_bus = p_context;
+
+    p_bus->busy = false;
+
+    if (p_bus->spim)
+    {
+        nrfx_spim_evt_t event = {
+          .type = NRFX_SPIM_EVENT_DONE,
+          .xfer_desc =
+            {
+              .p_tx_buffer = p_bus->xfer.p_tx_buffer,
+              .tx_length   = p_bus->xfer.tx_length,
+              .p_rx_buffer = p_bus->xfer.p_rx_buffer,
+              .rx_length   = p_bus->xfer.rx_length,
+            },
+        };
+
+        p_bus->spim_handler(&event, p_bus->p_context);
+    } else
+    {
+        nrfx_spi_evt_t event = {.type = NRFX_SPI_EVENT_DONE, .xfer_desc = p_bus->xfer};
+
+        p_bus->spi_handler(&event, p_bus->p_context);
+    }
+}
+
+static nrfx_err_t xfer_start(bus_t *p_bus, nrfx_spi_xfer_desc_t const *p_xfer, bool blocking)
+{
+    if (!p_bus->initialized)
+    {
+        return NRFX_ERROR_INVALID_STATE;
+    }
+
+    if (p_bus->busy)
+    {
+        return NRFX_ERROR_BUSY;
+    }
+
+    p_bus->xfer = *p_xfer;
+
+    uint64_t duration = xfer_run(p_bus);
+
+    if (blocking)
+    {
+        dk_host_time_advance(duration);
+        return NRFX_SUCCESS;
+    }
+
+    p_bus->busy = true;
+    dk_host_event_schedule(&p_bus->done_event, duration, xfer_done, p_bus);
+
+    return NRFX_SUCCESS;
+}
+
+static nrfx_err_t bus_init(bus_t *p_bus, uint32_t frequency, uint8_t orc, void *p_context)
+{
+    if (p_bus->initialized)
+    {
+        return NRFX_ERROR_INVALID_STATE;
+    }
+
+    p_bus->initialized  = true;
+    p_bus->orc          = orc;
+    p_bus->frequency_hz = (frequency >> FREQUENCY_SHIFT) * FREQUENCY_UNIT_HZ;
+    p_bus->p_context    = p_context;
+
+    return NRFX_SUCCESS;
+}
+
+static void bus_uninit(bus_t *p_bus)
+{
+    dk_host_event_cancel(&p_bus->done_event);
+
+    p_bus->busy        = false;
+    p_bus->initialized = false;
+}
+
+void dk_host_spi_reset(void)
+{
+    for (uint8_t i = 0; i < DK_HOST_SPI_BUS_COUNT; i++)
+    {
+        dk_host_event_cancel(&m_buses[i].done_event);
+        memset(&m_buses[i], 0, sizeof(bus_t));
+    }
+}
+
+void dk_host_spi_slave_attach(uint8_t bus, dk_host_spi_slave_t *p_slave)
+{
+    ASSERT(bus < DK_HOST_SPI_BUS_COUNT);
+
+    p_slave->p_next       = m_buses[bus].p_slaves;
+    m_buses[bus].p_slaves = p_slave;
+}
+
+uint32_t dk_host_spi_xfer_count_get(uint8_t bus)
+{
+    ASSERT(bus < DK_HOST_SPI_BUS_COUNT);
+
+    return m_buses[bus].xfer_count;
+}
+
+nrfx_err_t nrfx_spi_init(nrfx_spi_t const        *p_instance,
+                         nrfx_spi_config_t const *p_config,
+                         nrfx_spi_evt_handler_t   handler,
+                         void                    *p_context)
+{
+    ASSERT(p_instance->drv_inst_idx < DK_HOST_SPI_BUS_COUNT);
+
+    // Pointer for cleaner code.
+    bus_t *p_bus = &m_buses[p_instance->drv_inst_idx];
+
+    nrfx_err_t result = bus_init(p_bus, p_config->frequency, p_config->orc, p_context);
+
+    if (result == NRFX_SUCCESS)
+    {
+        p_bus->spim         = false;
+        p_bus->spi_handler  = handler;
+        p_bus->spim_handler = NULL;
+    }
+
+    return result;
+}
+
+void nrfx_spi_uninit(nrfx_spi_t const *p_instance)
+{
+    bus_uninit(&m_buses[p_instance->drv_inst_idx]);
+}
+
+nrfx_err_t nrfx_spi_xfer(nrfx_spi_t const *p_instance, nrfx_spi_xfer_desc_t const *p_xfer_desc, uint32_t flags)
+{
+    (void)flags;
+
+    // Pointer for cleaner code.
+    bus_t *p_bus = &m_buses[p_instance->drv_inst_idx];
+
+    return xfer_start(p_bus, p_xfer_desc, p_bus->spi_handler == NULL);
+}
+
+nrfx_err_t nrfx_spim_init(nrfx_spim_t const        *p_instance,
+                          nrfx_spim_config_t const *p_config,
+                          nrfx_spim_evt_handler_t   handler,
+                          void                     *p_context)
+{
+    ASSERT(p_instance->drv_inst_idx < DK_HOST_SPI_BUS_COUNT);
+
+    // Pointer for cleaner code.
+    bus_t *p_bus = &m_buses[p_instance->drv_inst_idx];
+
+    nrfx_err_t result = bus_init(p_bus, p_config->frequency, p_config->orc, p_context);
+
+    if (result == NRFX_SUCCESS)
+    {
+        p_bus->spim         = true;
+        p_bus->spi_handler  = NULL;
+        p_bus->spim_handler = handler;
+    }
+
+    return result;
+}
+
+void nrfx_spim_uninit(nrfx_spim_t const *p_instance)
+{
+    bus_uninit(&m_buses[p_instance->drv_inst_idx]);
+}
+
+nrfx_err_t nrfx_spim_xfer(nrfx_spim_t const *p_instance, nrfx_spim_xfer_desc_t const *p_xfer_desc, uint32_t flags)
+{
+    (void)flags;
+
+    // Pointer for cleaner code.
+    bus_t *p_bus = &m_buses[p_instance->drv_inst_idx];
+
+    nrfx_spi_xfer_desc_t xfer = {
+      .p_tx_buffer = p_xfer_desc->p_tx_buffer,
+      .tx_length   = p_xfer_desc->tx_length,
+      .p_rx_buffer = p_xfer_desc->p_rx_buffer,
+      .rx_length   = p_xfer_desc->rx_length,
+    };
+
+    return xfer_start(p_bus, &xfer, p_bus->spim_handler == NULL);
+}
@@ -0,0 +1,68 @@
+/**
+ * @file        dk_host_spi.h
+ * @author      Danius Kalvaitis (danius.kalvaitis@gmail.com)
+ * @brief       Simulated SPI bus of the host build, shared by the nrfx_spi and nrfx_spim stubs.
+ * @version     0.1
+ * @date        2026-10-17
+ *
+ * @copyright   Copyright (c) Danius Kalvaitis 2026 All rights reserved
+ *
+ */
+
+#ifndef DK_HOST_SPI_H
+#define DK_HOST_SPI_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define DK_HOST_SPI_BUS_COUNT 3 ///< Amount of simulated buses, SPI instances 0 to 2.
+
+typedef struct dk_host_spi_slave_s dk_host_spi_slave_t; ///< Simulated slave device.
+
+/**
+ * @brief Function called for each byte clocked while the chip select pin of the slave is low.
+ *
+ * @return Byte the slave shifts out on MISO.
+ */
+typedef uint8_t (*dk_host_spi_exchange_t)(dk_host_spi_slave_t *p_slave, uint8_t mosi);
+
+/**
+ * @brief Simulated slave device, embedded as the first member of a device model.
+ */
+struct dk_host_spi_slave_s
+{
+    dk_host_spi_exchange_t exchange; ///< Byte exchange of the device model.
+    uint32_t               cs_pin;   ///< Chip select pin, active low.
+    dk_host_spi_slave_t   *p_next;   ///< Next slave on the bus.
+};
+
+/**
+ * @brief       Detach all slaves and release all buses.
+ */
+void dk_host_spi_reset(void);
+
+/**
+ * @brief       Attach a slave to a bus.
+ *
+ * @param[in]   bus     Bus index, the SPI instance number.
+ * @param[in]   p_slave Pointer to slave.
+ */
+void dk_host_spi_slave_attach(uint8_t bus, dk_host_spi_slave_t *p_slave);
+
+/**
+ * @brief       Get the amount of transfers started on a bus since @ref dk_host_spi_reset.
+ *
+ * @param[in]   bus     Bus index.
+ *
+ * @return      Amount of transfers.
+ */
+uint32_t dk_host_spi_xfer_count_get(uint8_t bus);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // DK_HOST_SPI_H
@@ -0,0 +1,64 @@
+/**
+ * @file        dk_host_strerror.c
+ * @author      Danius Kalvaitis (danius.kalvaitis@gmail.com)
+ * @brief       Error code names of the host build.
+ * @version     0.1
+ * @date        2026-10-17
+ *
+ * @copyright   Copyright (c) Danius Kalvaitis 2026 All rights reserved
+ *
+ */
+
+#include "nrf_strerror.h"
+
+#include "app_util.h"
+#include "nrf_error.h"
+
+/**
+ * @brief Name of an error code.
+ */
+typedef struct
+{
+    ret_code_t  code; ///< Error code.
+    char const *name; ///< Name of the error code.
+} error_name_t;
+
+#define ERROR_NAME(_code) {.code = (_code), .name = #_code} ///< Table entry named after the error code macro.
+
+static error_name_t const m_error_names[] = {
+  ERROR_NAME(NRF_SUCCESS),
+  ERROR_NAME(NRF_ERROR_INTERNAL),
+  ERROR_NAME(NRF_ERROR_NO_MEM),
+  ERROR_NAME(NRF_ERROR_NOT_FOUND),
+  ERROR_NAME(NRF_ERROR_NOT_SUPPORTED),
+  ERROR_NAME(NRF_ERROR_INVALID_PARAM),
+  ERROR_NAME(NRF_ERROR_INVALID_STATE),
+  ERROR_NAME(NRF_ERROR_INVALID_LENGTH),
+  ERROR_NAME(NRF_ERROR_INVALID_FLAGS),
+  ERROR_NAME(NRF_ERROR_INVALID_DATA),
+  ERROR_NAME(NRF_ERROR_DATA_SIZE),
+  ERROR_NAME(NRF_ERROR_TIMEOUT),
+  ERROR_NAME(NRF_ERROR_NULL),
+  ERROR_NAME(NRF_ERROR_FORBIDDEN),
+  ERROR_NAME(NRF_ERROR_INVALID_ADDR),
+  ERROR_NAME(NRF_ERROR_BUSY),
+  ERROR_NAME(NRF_ERROR_RESOURCES),
+  ERROR_NAME(NRF_ERROR_MODULE_NOT_INITIALIZED),
+  ERROR_NAME(NRF_ERROR_MODULE_ALREADY_INITIALIZED),
+  ERROR_NAME(NRF_ERROR_DRV_TWI_ERR_OVERRUN),
+  ERROR_NAME(NRF_ERROR_DRV_TWI_ERR_ANACK),
+  ERROR_NAME(NRF_ERROR_DRV_TWI_ERR_DNACK),
+};
+
+char const *nrf_strerror_get(ret_code_t code)
+{
+    for (size_t i = 0; i < ARRAY_SIZE(m_error_names); i++)
+    {
+        if (m_error_names[i].code == code)
+        {
+            return m_error_names[i].name;
+        }
+    }
+
+    return "Unknown error code";
+}
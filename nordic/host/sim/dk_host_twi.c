@@ -0,0 +1,746 @@
+/**
+ * @file        dk_host_twi.c
+ * @author      Danius Kalvaitis (danius.kalvaitis@gmail.com)
+ * @brief       Simulated TWI bus of the host build, implements the nrfx_twi and nrfx_twim stubs.
+ * @version     0.1
+ * @date        2026-10-17
+ *
+ * @copyright   Copyright (c) Danius Kalvaitis 2026 All rights reserved
+ *
+ */
+
+#include "dk_host_twi.h"
+
+#include <string.h>
+
+#include "dk_host_sim.h"
+#include "nrf_assert.h"
+#include "nrf_gpio.h"
+#include "nrfx_twi.h"
+#include "nrfx_twim.h"
+
+#define NS_PER_S           1000000000ULL ///< Nanoseconds in a second.
+#define BITS_PER_BYTE      9             ///< Eight data bits and the acknowledge bit.
+#define BITS_PER_CONDITION 1             ///< Bus time of a start, repeated start or stop condition.
+
+#define TWIM_TASK_BASE     0x40003000UL ///< Address of the TWIM0 registers.
+#define TWIM_TASK_STARTRX  0x000UL      ///< Offset of the STARTRX task.
+#define TWIM_TASK_STARTTX  0x008UL      ///< Offset of the STARTTX task.
+#define TWIM_INSTANCE_SPAN 0x1000UL     ///< Distance between the TWIM instances.
+
+/**
+ * @brief Transfer outcome, converted to the driver event type.
+ */
+typedef enum
+{
+    XFER_DONE,         ///< Transfer completed.
+    XFER_ADDRESS_NACK, ///< Address was not acknowledged.
+    XFER_DATA_NACK,    ///< Data byte was not acknowledged.
+    XFER_STUCK,        ///< Slave holds SDA low, the transfer never finishes.
+} xfer_result_t;
+
+/**
+ * @brief State of a simulated bus and the driver instance using it.
+ */
+typedef struct
+{
+    dk_host_twi_slave_t    *p_slaves;      ///< Attached slaves.
+    dk_host_twi_slave_t    *p_active;      ///< Slave that acknowledged the last address.
+    bool                    initialized;   ///< Driver instance is initialized.
+    bool                    enabled;       ///< Driver instance is enabled.
+    bool                    busy;          ///< Transfer in progress.
+    bool                    armed;         ///< TWIM transfer waits for the start task.
+    bool                    twim;          ///< Instance is used by nrfx_twim.
+    uint32_t                frequency_hz;  ///< Bus frequency.
+    uint32_t                scl;           ///< SCL pin of the driver instance.
+    uint32_t                sda;           ///< SDA pin of the driver instance.
+    nrfx_twi_evt_handler_t  twi_handler;   ///< Event handler of nrfx_twi.
+    nrfx_twim_evt_handler_t twim_handler;  ///< Event handler of nrfx_twim.
+    void                   *p_context;     ///< Context of the event handler.
+    nrfx_twi_xfer_desc_t    xfer;          ///< Transfer in progress, TWIM descriptors are converted.
+    uint32_t                flags;         ///< Flags of the transfer in progress.
+    xfer_result_t           result;        ///< Outcome of the transfer in progress.
+    dk_host_event_t         done_event;    ///< Transfer completion interrupt.
+    uint32_t                xfer_count;    ///< Amount of started transfers.
+    uint32_t                init_count;    ///< Amount of driver initializations.
+    uint64_t                stretch_ns;    ///< Clock stretching of the transfer in progress.
+    dk_host_twi_fault_t     fault;         ///< Fault given to the next transfers to @p fault_address.
+    uint8_t                 fault_address; ///< Slave address the fault applies to.
+    uint8_t                 fault_count;   ///< Amount of transfers still to fault.
+    dk_host_twi_fault_t     xfer_fault;    ///< Fault of the transfer in progress.
+    bool                    stuck;         ///< A slave holds SDA low.
+    uint8_t                 stuck_clocks;  ///< SCL clocks seen while stuck.
+} bus_t;
+
+static bus_t m_buses[DK_HOST_TWI_BUS_COUNT]; ///< Simulated buses.
+
+static uint32_t frequency_hz_get(uint32_t frequency)
+{
+    switch (frequency)
+    {
+        case NRF_TWI_FREQ_250K:
+            return 250000;
+
+        case NRF_TWI_FREQ_400K:
+        case NRF_TWIM_FREQ_400K:
+            return 400000;
+
+        default:
+            return 100000;
+    }
+}
+
+static uint64_t bits_to_ns(bus_t const *p_bus, uint32_t bits)
+{
+    return ((uint64_t)bits * NS_PER_S) / p_bus->frequency_hz;
+}
+
+/**
+ * @brief Count the SCL clocks of a bus clear and release SDA once the stuck slave shifted out its byte.
+ */
+static void gpio_handler(uint32_t pin_number, uint32_t level)
+{
+    for (uint8_t i = 0; i < DK_HOST_TWI_BUS_COUNT; i++)
+    {
+        // Pointer for cleaner code.
+        bus_t *p_bus = &m_buses[i];
+
+        if (!p_bus->stuck || (pin_number != p_bus->scl) || !level)
+        {
+            continue;
+        }
+
+        if (++p_bus->stuck_clocks >= DK_HOST_TWI_STUCK_CLOCKS)
+        {
+            p_bus->stuck = false;
+            dk_host_gpio_hold_low(p_bus->sda, false);
+        }
+    }
+}
+
+static void stuck_set(bus_t *p_bus)
+{
+    p_bus->stuck        = true;
+    p_bus->stuck_clocks = 0;
+
+    dk_host_gpio_hold_low(p_bus->sda, true);
+    dk_host_gpio_handler_set(gpio_handler);
+}
+
+static dk_host_twi_fault_t fault_take(bus_t *p_bus, uint8_t address)
+{
+    if ((p_bus->fault_count == 0) || (address != p_bus->fault_address))
+    {
+        return DK_HOST_TWI_FAULT_NONE;
+    }
+
+    p_bus->fault_count--;
+
+    return p_bus->fault;
+}
+
+/**
+ * @brief Address a slave and clock the bytes of one segment between two start conditions.
+ */
+static xfer_result_t segment_run(bus_t    *p_bus,
+                                 uint8_t   address,
+                                 bool      read,
+                                 uint8_t  *p_data,
+                                 size_t    length,
+                                 uint32_t *p_bits)
+{
+    // Neither a start condition nor the address can be sent while SDA is held low.
+    if (p_bus->stuck)
+    {
+        return XFER_STUCK;
+    }
+
+    *p_bits += BITS_PER_CONDITION + BITS_PER_BYTE;
+
+    p_bus->p_active = NULL;
+    for (dk_host_twi_slave_t *p_slave = p_bus->p_slaves; p_slave != NULL; p_slave = p_slave->p_next)
+    {
+        // Every slave sees the address byte, like on a real bus.
+        if (p_slave->p_api->start(p_slave, address, read) && (p_bus->p_active == NULL))
+        {
+            p_bus->p_active = p_slave;
+        }
+    }
+
+    if (p_bus->xfer_fault == DK_HOST_TWI_FAULT_ADDRESS_NACK)
+    {
+        p_bus->p_active = NULL;
+    }
+
+    if (p_bus->p_active == NULL)
+    {
+        return XFER_ADDRESS_NACK;
+    }
+
+    if (p_bus->xfer_fault == DK_HOST_TWI_FAULT_STUCK)
+    {
+        stuck_set(p_bus);
+        return XFER_STUCK;
+    }
+
+    for (size_t i = 0; i < length; i++)
+    {
+        *p_bits += BITS_PER_BYTE;
+        p_bus->stretch_ns += p_bus->p_active->stretch_ns;
+
+        if (!read && (p_bus->xfer_fault == DK_HOST_TWI_FAULT_DATA_NACK))
+        {
+            p_bus->xfer_fault = DK_HOST_TWI_FAULT_NONE;
+            return XFER_DATA_NACK;
+        }
+
+        if (read)
+        {
+            p_data[i] = p_bus->p_active->p_api->read(p_bus->p_active);
+        } else if (!p_bus->p_active->p_api->write(p_bus->p_active, p_data[i]))
+        {
+            return XFER_DATA_NACK;
+        }
+    }
+
+    return XFER_DONE;
+}
+
+static void stop_send(bus_t *p_bus, uint32_t *p_bits)
+{
+    *p_bits += BITS_PER_CONDITION;
+
+    for (dk_host_twi_slave_t *p_slave = p_bus->p_slaves; p_slave != NULL; p_slave = p_slave->p_next)
+    {
+        p_slave->p_api->stop(p_slave);
+    }
+}
+
+/**
+ * @brief Run the transfer against the slaves and return its duration on the bus.
+ */
+static uint64_t xfer_run(bus_t *p_bus)
+{
+    // Pointer for cleaner code.
+    nrfx_twi_xfer_desc_t const *p_xfer = &p_bus->xfer;
+
+    uint32_t bits         = 0;
+    bool     primary_read = (p_xfer->type == NRFX_TWI_XFER_RX);
+
+    p_bus->xfer_count++;
+    p_bus->stretch_ns = 0;
+    p_bus->xfer_fault = fault_take(p_bus, p_xfer->address);
+    p_bus->result =
+      segment_run(p_bus, p_xfer->address, primary_read, p_xfer->p_primary_buf, p_xfer->primary_length, &bits);
+
+    if ((p_bus->result == XFER_DONE) &&
+        ((p_xfer->type == NRFX_TWI_XFER_TXRX) || (p_xfer->type == NRFX_TWI_XFER_TXTX)))
+    {
+        p_bus->result = segment_run(p_bus,
+                                    p_xfer->address,
+                                    (p_xfer->type == NRFX_TWI_XFER_TXRX),
+                                    p_xfer->p_secondary_buf,
+                                    p_xfer->secondary_length,
+                                    &bits);
+    }
+
+    if (p_bus->result == XFER_STUCK)
+    {
+        return 0;
+    }
+
+    // The peripheral always sends a stop after an error.
+    if ((p_bus->result != XFER_DONE) || !(p_bus->flags & NRFX_TWI_FLAG_TX_NO_STOP) || primary_read)
+    {
+        stop_send(p_bus, &bits);
+    }
+
+    return bits_to_ns(p_bus, bits) + p_bus->stretch_ns;
+}
+
+static nrfx_err_t result_to_err(xfer_result_t result)
+{
+    switch (result)
+    {
+        case XFER_ADDRESS_NACK:
+            return NRFX_ERROR_DRV_TWI_ERR_ANACK;
+
+        case XFER_DATA_NACK:
+            return NRFX_ERROR_DRV_TWI_ERR_DNACK;
+
+        case XFER_STUCK:
+            return NRFX_ERROR_INTERNAL;
+
+        default:
+            return NRFX_SUCCESS;
+    }
+}
+
+static void xfer_done(void *p_context)
+{
+    bus_t *p_bus = p_context;
+
+    bool repeated = p_bus->twim && (p_bus->flags & NRFX_TWIM_FLAG_REPEATED_XFER) && (p_bus->result == XFER_DONE);
+
+    p_bus->busy  = false;
+    p_bus->armed = repeated;
+
+    if (p_bus->twim)
+    {
+        if ((p_bus->twim_handler == NULL) || (p_bus->flags & NRFX_TWIM_FLAG_NO_XFER_EVT_HANDLER))
+        {
+            return;
+        }
+
+        nrfx_twim_evt_t event = {
+          .type = (p_bus->result == XFER_ADDRESS_NACK) ? NRFX_TWIM_EVT_ADDRESS_NACK
+                  : (p_bus->result == XFER_DATA_NACK)  ? NRFX_TWIM_EVT_DATA_NACK
+                                                       : NRFX_TWIM_EVT_DONE,
+          .xfer_desc =
+            {
+              .type             = (nrfx_twim_xfer_type_t)p_bus->xfer.type,
+              .address          = p_bus->xfer.address,
+              .primary_length   = p_bus->xfer.primary_length,
+              .secondary_length = p_bus->xfer.secondary_length,
+              .p_primary_buf    = p_bus->xfer.p_primary_buf,
+              .p_secondary_buf  = p_bus->xfer.p_secondary_buf,
+            },
+        };
+
+        p_bus->twim_handler(&event, p_bus->p_context);
+    } else if (p_bus->twi_handler != NULL)
+    {
+        nrfx_twi_evt_t event = {
+          .type = (p_bus->result == XFER_ADDRESS_NACK) ? NRFX_TWI_EVT_ADDRESS_NACK
+                  : (p_bus->result == XFER_DATA_NACK)  ? NRFX_TWI_EVT_DATA_NACK
+                                                       : NRFX_TWI_EVT_DONE,
+          .xfer_desc = p_bus->xfer,
+        };
+
+        p_bus->twi_handler(&event, p_bus->p_context);
+    }
+}
+
+static nrfx_err_t xfer_start(bus_t *p_bus, nrfx_twi_xfer_desc_t const *p_xfer, uint32_t flags, bool blocking)
+{
+    if (!p_bus->enabled)
+    {
+        return NRFX_ERROR_INVALID_STATE;
+    }
+
+    if (p_bus->busy)
+    {
+        return NRFX_ERROR_BUSY;
+    }
+
+    p_bus->xfer  = *p_xfer;
+    p_bus->flags = flags;
+
+    if (p_bus->twim && (flags & NRFX_TWIM_FLAG_HOLD_XFER))
+    {
+        p_bus->armed = true;
+        return NRFX_SUCCESS;
+    }
+
+    p_bus->armed = false;
+
+    uint64_t duration = xfer_run(p_bus);
+
+    // A blocking transfer on a stuck bus never returns on target, fail it instead of hanging the test.
+    if (blocking)
+    {
+        dk_host_time_advance(duration);
+        return result_to_err(p_bus->result);
+    }
+
+    p_bus->busy = true;
+
+    // A stuck transfer stays busy until the driver is disabled.
+    if (p_bus->result != XFER_STUCK)
+    {
+        dk_host_event_schedule(&p_bus->done_event, duration, xfer_done, p_bus);
+    }
+
+    return NRFX_SUCCESS;
+}
+
+static void bus_release(bus_t *p_bus)
+{
+    dk_host_event_cancel(&p_bus->done_event);
+
+    p_bus->busy    = false;
+    p_bus->armed   = false;
+    p_bus->enabled = false;
+}
+
+static uint8_t *regfile_reg(dk_host_twi_regfile_t *p_regfile, uint8_t reg)
+{
+    uint8_t page = p_regfile->paged ? (p_regfile->regs[0] & 0x01) : 0;
+
+    return dk_host_twi_regfile_reg_get(p_regfile, page, reg);
+}
+
+static void regfile_pointer_advance(dk_host_twi_regfile_t *p_regfile)
+{
+    if (p_regfile->increment)
+    {
+        p_regfile->pointer = (p_regfile->pointer + 1) & p_regfile->reg_mask;
+    }
+}
+
+static bool regfile_start(dk_host_twi_slave_t *p_slave, uint8_t address, bool read)
+{
+    dk_host_twi_regfile_t *p_regfile = (dk_host_twi_regfile_t *)p_slave;
+
+    bool broadcast = !read && (p_regfile->broadcast_address != 0) && (address == p_regfile->broadcast_address);
+
+    p_regfile->addressed = ((address == p_regfile->address) || broadcast) && !(read && p_regfile->write_only);
+    p_regfile->selecting = !read;
+
+    return p_regfile->addressed;
+}
+
+static bool regfile_write(dk_host_twi_slave_t *p_slave, uint8_t byte)
+{
+    dk_host_twi_regfile_t *p_regfile = (dk_host_twi_regfile_t *)p_slave;
+
+    if (p_regfile->selecting)
+    {
+        p_regfile->pointer   = byte & p_regfile->reg_mask;
+        p_regfile->selecting = false;
+
+        switch (p_regfile->auto_inc)
+        {
+            case DK_HOST_TWI_AUTO_INC_SUB_MSB:
+                p_regfile->increment = (byte & 0x80) != 0;
+                break;
+
+            case DK_HOST_TWI_AUTO_INC_CTRL:
+                p_regfile->increment =
+                  (p_regfile->regs[p_regfile->inc_reg] & p_regfile->inc_mask) == p_regfile->inc_mask;
+                break;
+
+            default:
+                p_regfile->increment = true;
+                break;
+        }
+
+        return true;
+    }
+
+    uint8_t reg = p_regfile->pointer;
+
+    if (!(p_regfile->read_only[reg / 8] & (1 << (reg % 8))))
+    {
+        *regfile_reg(p_regfile, reg) = byte;
+    }
+
+    regfile_pointer_advance(p_regfile);
+
+    if (p_regfile->on_write != NULL)
+    {
+        p_regfile->on_write(p_regfile, reg, byte);
+    }
+
+    return true;
+}
+
+static uint8_t regfile_read(dk_host_twi_slave_t *p_slave)
+{
+    dk_host_twi_regfile_t *p_regfile = (dk_host_twi_regfile_t *)p_slave;
+
+    uint8_t byte = *regfile_reg(p_regfile, p_regfile->pointer);
+
+    regfile_pointer_advance(p_regfile);
+
+    return byte;
+}
+
+static void regfile_stop(dk_host_twi_slave_t *p_slave)
+{
+    dk_host_twi_regfile_t *p_regfile = (dk_host_twi_regfile_t *)p_slave;
+
+    p_regfile->addressed = false;
+}
+
+static dk_host_twi_slave_api_t const m_regfile_api = {
+  .start = regfile_start,
+  .write = regfile_write,
+  .read  = regfile_read,
+  .stop  = regfile_stop,
+};
+
+void dk_host_twi_reset(void)
+{
+    for (uint8_t i = 0; i < DK_HOST_TWI_BUS_COUNT; i++)
+    {
+        dk_host_event_cancel(&m_buses[i].done_event);
+        memset(&m_buses[i], 0, sizeof(bus_t));
+    }
+}
+
+void dk_host_twi_slave_attach(uint8_t bus, dk_host_twi_slave_t *p_slave)
+{
+    ASSERT(bus < DK_HOST_TWI_BUS_COUNT);
+
+    p_slave->p_next       = m_buses[bus].p_slaves;
+    m_buses[bus].p_slaves = p_slave;
+}
+
+void dk_host_twi_fault_inject(uint8_t bus, uint8_t address, dk_host_twi_fault_t fault, uint8_t count)
+{
+    ASSERT(bus < DK_HOST_TWI_BUS_COUNT);
+
+    m_buses[bus].fault         = fault;
+    m_buses[bus].fault_address = address;
+    m_buses[bus].fault_count   = (fault == DK_HOST_TWI_FAULT_NONE) ? 0 : count;
+}
+
+bool dk_host_twi_is_stuck(uint8_t bus)
+{
+    ASSERT(bus < DK_HOST_TWI_BUS_COUNT);
+
+    return m_buses[bus].stuck;
+}
+
+uint32_t dk_host_twi_xfer_count_get(uint8_t bus)
+{
+    ASSERT(bus < DK_HOST_TWI_BUS_COUNT);
+
+    return m_buses[bus].xfer_count;
+}
+
+uint32_t dk_host_twi_init_count_get(uint8_t bus)
+{
+    ASSERT(bus < DK_HOST_TWI_BUS_COUNT);
+
+    return m_buses[bus].init_count;
+}
+
+void dk_host_twi_regfile_init(dk_host_twi_regfile_t *p_regfile, uint8_t address)
+{
+    memset(p_regfile, 0, sizeof(dk_host_twi_regfile_t));
+
+    p_regfile->slave.p_api = &m_regfile_api;
+    p_regfile->address     = address;
+    p_regfile->reg_mask    = 0xFF;
+    p_regfile->auto_inc    = DK_HOST_TWI_AUTO_INC_ALWAYS;
+}
+
+void dk_host_twi_regfile_read_only_set(dk_host_twi_regfile_t *p_regfile, uint8_t reg)
+{
+    p_regfile->read_only[reg / 8] |= (uint8_t)(1 << (reg % 8));
+}
+
+uint8_t *dk_host_twi_regfile_reg_get(dk_host_twi_regfile_t *p_regfile, uint8_t page, uint8_t reg)
+{
+    ASSERT(page <= 1);
+
+    // The page select register is shared by all pages.
+    if ((page == 0) || (reg == 0))
+    {
+        return &p_regfile->regs[reg];
+    }
+
+    return &p_regfile->page1[reg];
+}
+
+nrfx_err_t nrfx_twi_init(nrfx_twi_t const        *p_instance,
+                         nrfx_twi_config_t const *p_config,
+                         nrfx_twi_evt_handler_t   event_handler,
+                         void                    *p_context)
+{
+    ASSERT(p_instance->drv_inst_idx < DK_HOST_TWI_BUS_COUNT);
+
+    // Pointer for cleaner code.
+    bus_t *p_bus = &m_buses[p_instance->drv_inst_idx];
+
+    if (p_bus->initialized)
+    {
+        return NRFX_ERROR_INVALID_STATE;
+    }
+
+    p_bus->initialized  = true;
+    p_bus->init_count++;
+    p_bus->twim         = false;
+    p_bus->frequency_hz = frequency_hz_get(p_config->frequency);
+    p_bus->scl          = p_config->scl;
+    p_bus->sda          = p_config->sda;
+    p_bus->twi_handler  = event_handler;
+    p_bus->twim_handler = NULL;
+    p_bus->p_context    = p_context;
+
+    return NRFX_SUCCESS;
+}
+
+void nrfx_twi_uninit(nrfx_twi_t const *p_instance)
+{
+    // Pointer for cleaner code.
+    bus_t *p_bus = &m_buses[p_instance->drv_inst_idx];
+
+    bus_release(p_bus);
+    p_bus->initialized = false;
+}
+
+void nrfx_twi_enable(nrfx_twi_t const *p_instance)
+{
+    ASSERT(m_buses[p_instance->drv_inst_idx].initialized);
+
+    m_buses[p_instance->drv_inst_idx].enabled = true;
+}
+
+void nrfx_twi_disable(nrfx_twi_t const *p_instance)
+{
+    bus_release(&m_buses[p_instance->drv_inst_idx]);
+}
+
+nrfx_err_t nrfx_twi_xfer(nrfx_twi_t const *p_instance, nrfx_twi_xfer_desc_t const *p_xfer_desc, uint32_t flags)
+{
+    // Pointer for cleaner code.
+    bus_t *p_bus = &m_buses[p_instance->drv_inst_idx];
+
+    return xfer_start(p_bus, p_xfer_desc, flags, p_bus->twi_handler == NULL);
+}
+
+nrfx_err_t nrfx_twi_tx(nrfx_twi_t const *p_instance,
+                       uint8_t           address,
+                       uint8_t const    *p_data,
+                       size_t            length,
+                       bool              no_stop)
+{
+    nrfx_twi_xfer_desc_t xfer = NRFX_TWI_XFER_DESC_TX(address, (uint8_t *)p_data, length);
+
+    return nrfx_twi_xfer(p_instance, &xfer, no_stop ? NRFX_TWI_FLAG_TX_NO_STOP : 0);
+}
+
+nrfx_err_t nrfx_twi_rx(nrfx_twi_t const *p_instance, uint8_t address, uint8_t *p_data, size_t length)
+{
+    nrfx_twi_xfer_desc_t xfer = NRFX_TWI_XFER_DESC_RX(address, p_data, length);
+
+    return nrfx_twi_xfer(p_instance, &xfer, 0);
+}
+
+bool nrfx_twi_is_busy(nrfx_twi_t const *p_instance)
+{
+    return m_buses[p_instance->drv_inst_idx].busy;
+}
+
+nrfx_err_t nrfx_twim_init(nrfx_twim_t const        *p_instance,
+                          nrfx_twim_config_t const *p_config,
+                          nrfx_twim_evt_handler_t   event_handler,
+                          void                     *p_context)
+{
+    ASSERT(p_instance->drv_inst_idx < DK_HOST_TWI_BUS_COUNT);
+
+    // Pointer for cleaner code.
+    bus_t *p_bus = &m_buses[p_instance->drv_inst_idx];
+
+    if (p_bus->initialized)
+    {
+        return NRFX_ERROR_INVALID_STATE;
+    }
+
+    p_bus->initialized  = true;
+    p_bus->init_count++;
+    p_bus->twim         = true;
+    p_bus->frequency_hz = frequency_hz_get(p_config->frequency);
+    p_bus->scl          = p_config->scl;
+    p_bus->sda          = p_config->sda;
+    p_bus->twi_handler  = NULL;
+    p_bus->twim_handler = event_handler;
+    p_bus->p_context    = p_context;
+
+    return NRFX_SUCCESS;
+}
+
+void nrfx_twim_uninit(nrfx_twim_t const *p_instance)
+{
+    // Pointer for cleaner code.
+    bus_t *p_bus = &m_buses[p_instance->drv_inst_idx];
+
+    bus_release(p_bus);
+    p_bus->initialized = false;
+}
+
+void nrfx_twim_enable(nrfx_twim_t const *p_instance)
+{
+    ASSERT(m_buses[p_instance->drv_inst_idx].initialized);
+
+    m_buses[p_instance->drv_inst_idx].enabled = true;
+}
+
+void nrfx_twim_disable(nrfx_twim_t const *p_instance)
+{
+    bus_release(&m_buses[p_instance->drv_inst_idx]);
+}
+
+nrfx_err_t nrfx_twim_xfer(nrfx_twim_t const *p_instance, nrfx_twim_xfer_desc_t const *p_xfer_desc, uint32_t flags)
+{
+    // Pointer for cleaner code.
+    bus_t *p_bus = &m_buses[p_instance->drv_inst_idx];
+
+    nrfx_twi_xfer_desc_t xfer = {
+      .type             = (nrfx_twi_xfer_type_t)p_xfer_desc->type,
+      .address          = p_xfer_desc->address,
+      .primary_length   = p_xfer_desc->primary_length,
+      .secondary_length = p_xfer_desc->secondary_length,
+      .p_primary_buf    = p_xfer_desc->p_primary_buf,
+      .p_secondary_buf  = p_xfer_desc->p_secondary_buf,
+    };
+
+    return xfer_start(p_bus, &xfer, flags, p_bus->twim_handler == NULL);
+}
+
+nrfx_err_t nrfx_twim_tx(nrfx_twim_t const *p_instance,
+                        uint8_t            address,
+                        uint8_t const     *p_data,
+                        size_t             length,
+                        bool               no_stop)
+{
+    nrfx_twim_xfer_desc_t xfer = NRFX_TWIM_XFER_DESC_TX(address, (uint8_t *)p_data, length);
+
+    return nrfx_twim_xfer(p_instance, &xfer, no_stop ? NRFX_TWIM_FLAG_TX_NO_STOP : 0);
+}
+
+nrfx_err_t nrfx_twim_rx(nrfx_twim_t const *p_instance, uint8_t address, uint8_t *p_data, size_t length)
+{
+    nrfx_twim_xfer_desc_t xfer = NRFX_TWIM_XFER_DESC_RX(address, p_data, length);
+
+    return nrfx_twim_xfer(p_instance, &xfer, 0);
+}
+
+bool nrfx_twim_is_busy(nrfx_twim_t const *p_instance)
+{
+    return m_buses[p_instance->drv_inst_idx].busy;
+}
+
+uint32_t nrfx_twim_start_task_get(nrfx_twim_t const *p_instance, nrfx_twim_xfer_type_t xfer_type)
+{
+    uint32_t offset = (xfer_type == NRFX_TWIM_XFER_RX) ? TWIM_TASK_STARTRX : TWIM_TASK_STARTTX;
+
+    return TWIM_TASK_BASE + (p_instance->drv_inst_idx * TWIM_INSTANCE_SPAN) + offset;
+}
+
+void dk_host_twim_task_trigger(uint32_t task_address)
+{
+    uint32_t idx = (task_address - TWIM_TASK_BASE) / TWIM_INSTANCE_SPAN;
+
+    ASSERT(idx < DK_HOST_TWI_BUS_COUNT);
+
+    // Pointer for cleaner code.
+    bus_t *p_bus = &m_buses[idx];
+
+    if (!p_bus->armed || p_bus->busy)
+    {
+        return;
+    }
+
+    p_bus->busy = true;
+
+    uint64_t duration = xfer_run(p_bus);
+
+    if (p_bus->result != XFER_STUCK)
+    {
+        dk_host_event_schedule(&p_bus->done_event, duration, xfer_done, p_bus);
+    }
+}
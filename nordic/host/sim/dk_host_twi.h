@@ -0,0 +1,203 @@
+/**
+ * @file        dk_host_twi.h
+ * @author      Danius Kalvaitis (danius.kalvaitis@gmail.com)
+ * @brief       Simulated TWI bus of the host build, shared by the nrfx_twi and nrfx_twim stubs.
+ * @version     0.1
+ * @date        2026-10-17
+ *
+ * @copyright   Copyright (c) Danius Kalvaitis 2026 All rights reserved
+ *
+ */
+
+#ifndef DK_HOST_TWI_H
+#define DK_HOST_TWI_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define DK_HOST_TWI_BUS_COUNT    2 ///< Amount of simulated buses, TWI instances 0 and 1.
+#define DK_HOST_TWI_STUCK_CLOCKS 9 ///< SCL clocks a stuck slave needs to shift out its byte and release SDA.
+
+typedef struct dk_host_twi_slave_s dk_host_twi_slave_t; ///< Simulated slave device.
+
+/**
+ * @brief Functions of a simulated slave, called byte by byte as the master clocks the bus.
+ */
+typedef struct
+{
+    /**
+     * @brief Start or repeated start followed by an address byte, return true to acknowledge the address.
+     */
+    bool (*start)(dk_host_twi_slave_t *p_slave, uint8_t address, bool read);
+
+    /**
+     * @brief Byte written by the master, return true to acknowledge it.
+     */
+    bool (*write)(dk_host_twi_slave_t *p_slave, uint8_t byte);
+
+    /**
+     * @brief Byte read by the master.
+     */
+    uint8_t (*read)(dk_host_twi_slave_t *p_slave);
+
+    /**
+     * @brief Stop condition.
+     */
+    void (*stop)(dk_host_twi_slave_t *p_slave);
+} dk_host_twi_slave_api_t;
+
+/**
+ * @brief Simulated slave device, embedded as the first member of a device model.
+ */
+struct dk_host_twi_slave_s
+{
+    dk_host_twi_slave_api_t const *p_api;      ///< Functions of the device model.
+    uint32_t                       stretch_ns; ///< Clock stretching after every data byte of the slave.
+    dk_host_twi_slave_t           *p_next;     ///< Next slave on the bus.
+};
+
+/**
+ * @brief Bus faults a slave address can be given.
+ */
+typedef enum
+{
+    DK_HOST_TWI_FAULT_NONE,         ///< Transfers run normally.
+    DK_HOST_TWI_FAULT_ADDRESS_NACK, ///< Address is not acknowledged.
+    DK_HOST_TWI_FAULT_DATA_NACK,    ///< First byte written after the address is not acknowledged.
+    DK_HOST_TWI_FAULT_STUCK,        ///< Slave holds SDA low after its address until SCL is clocked to release it.
+} dk_host_twi_fault_t;
+
+/**
+ * @brief Register pointer auto increment of a register file slave.
+ */
+typedef enum
+{
+    DK_HOST_TWI_AUTO_INC_ALWAYS,  ///< Pointer increments after every byte.
+    DK_HOST_TWI_AUTO_INC_SUB_MSB, ///< Pointer increments if the MSB of the register byte was set.
+    DK_HOST_TWI_AUTO_INC_CTRL,    ///< Pointer increments while the @p inc_mask bits are set in register @p inc_reg.
+} dk_host_twi_auto_inc_t;
+
+typedef struct dk_host_twi_regfile_s dk_host_twi_regfile_t; ///< Register file slave.
+
+/**
+ * @brief Function called after the master wrote a register of a register file slave.
+ */
+typedef void (*dk_host_twi_regfile_write_hook_t)(dk_host_twi_regfile_t *p_regfile, uint8_t reg, uint8_t value);
+
+/**
+ * @brief Slave with 256 byte registers, the first written byte selects the register and the pointer increments
+ *        after each byte. Device models adjust the addressing with the fields after @p selecting.
+ */
+struct dk_host_twi_regfile_s
+{
+    dk_host_twi_slave_t              slave;             ///< Slave interface.
+    uint8_t                          address;           ///< 7-bit slave address.
+    uint8_t                          pointer;           ///< Register pointer.
+    bool                             addressed;         ///< Slave acknowledged the last address byte.
+    bool                             selecting;         ///< Next written byte selects the register.
+    bool                             increment;         ///< Pointer increments after the current byte.
+    uint8_t                          broadcast_address; ///< Second address the slave answers writes to, 0 if none.
+    uint8_t                          reg_mask;          ///< Bits of the register byte that select the register.
+    dk_host_twi_auto_inc_t           auto_inc;          ///< Pointer auto increment.
+    uint8_t                          inc_reg;           ///< Register enabling auto increment (AUTO_INC_CTRL).
+    uint8_t                          inc_mask;          ///< Bits enabling auto increment (AUTO_INC_CTRL).
+    bool                             write_only;        ///< Reads are not acknowledged.
+    bool                             paged;             ///< Register 0 selects the page of the other registers.
+    uint8_t                          read_only[32];     ///< Bitmap of registers that ignore writes.
+    dk_host_twi_regfile_write_hook_t on_write;          ///< Called after a register was written (can be NULL).
+    uint8_t                          regs[256];         ///< Register content (page 0).
+    uint8_t                          page1[256];        ///< Register content of page 1 if @p paged.
+};
+
+/**
+ * @brief       Detach all slaves and release both buses.
+ */
+void dk_host_twi_reset(void);
+
+/**
+ * @brief       Attach a slave to a bus.
+ *
+ * @param[in]   bus     Bus index, the TWI instance number.
+ * @param[in]   p_slave Pointer to slave.
+ */
+void dk_host_twi_slave_attach(uint8_t bus, dk_host_twi_slave_t *p_slave);
+
+/**
+ * @brief       Get the amount of transfers started on a bus since @ref dk_host_twi_reset.
+ *
+ * @param[in]   bus     Bus index.
+ *
+ * @return      Amount of transfers.
+ */
+uint32_t dk_host_twi_xfer_count_get(uint8_t bus);
+
+/**
+ * @brief       Get the amount of times the driver of a bus was initialized since @ref dk_host_twi_reset.
+ *
+ * @param[in]   bus     Bus index.
+ *
+ * @return      Amount of initializations.
+ */
+uint32_t dk_host_twi_init_count_get(uint8_t bus);
+
+/**
+ * @brief       Give the next transfers to a slave address a fault.
+ *
+ * @details     Faults act on the bus like a misbehaving slave, so the driver sees them as real NACK events or as a
+ *              transfer that never finishes. A stuck slave holds SDA low, which also hangs later transfers on the bus,
+ *              until SCL is clocked @ref DK_HOST_TWI_STUCK_CLOCKS times through GPIO (bus clear). A new fault replaces
+ *              the previous one of the bus.
+ *
+ * @param[in]   bus     Bus index.
+ * @param[in]   address 7-bit slave address.
+ * @param[in]   fault   Fault, @ref DK_HOST_TWI_FAULT_NONE clears it.
+ * @param[in]   count   Amount of transfers to fault.
+ */
+void dk_host_twi_fault_inject(uint8_t bus, uint8_t address, dk_host_twi_fault_t fault, uint8_t count);
+
+/**
+ * @brief       Check if a stuck slave holds SDA of a bus low.
+ *
+ * @param[in]   bus     Bus index.
+ *
+ * @retval      true    If SDA is held low.
+ * @retval      false   Otherwise.
+ */
+bool dk_host_twi_is_stuck(uint8_t bus);
+
+/**
+ * @brief       Initialize a register file slave with all registers cleared and plain auto increment.
+ *
+ * @param[out]  p_regfile   Pointer to the slave.
+ * @param[in]   address     7-bit slave address.
+ */
+void dk_host_twi_regfile_init(dk_host_twi_regfile_t *p_regfile, uint8_t address);
+
+/**
+ * @brief       Make a register of a register file slave ignore writes.
+ *
+ * @param[in]   p_regfile   Pointer to the slave.
+ * @param[in]   reg         Register.
+ */
+void dk_host_twi_regfile_read_only_set(dk_host_twi_regfile_t *p_regfile, uint8_t reg);
+
+/**
+ * @brief       Get a register of a register file slave.
+ *
+ * @param[in]   p_regfile   Pointer to the slave.
+ * @param[in]   page        Register page, 0 if the slave is not paged.
+ * @param[in]   reg         Register.
+ *
+ * @return      Pointer to the register.
+ */
+uint8_t *dk_host_twi_regfile_reg_get(dk_host_twi_regfile_t *p_regfile, uint8_t page, uint8_t reg);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // DK_HOST_TWI_H
@@ -0,0 +1,339 @@
+/**
+ * @file        dk_host_twi_models.c
+ * @author      Danius Kalvaitis (danius.kalvaitis@gmail.com)
+ * @brief       Simulated TWI devices of the host build.
+ * @version     0.1
+ * @date        2026-10-17
+ *
+ * @copyright   Copyright (c) Danius Kalvaitis 2026 All rights reserved
+ *
+ */
+
+#include "dk_host_twi_models.h"
+
+#include <string.h>
+
+#include "nordic_common.h"
+#include "nrf_assert.h"
+
+#define LSM9DS1_WHO_AM_I   0x0F ///< WHO_AM_I register of both LSM9DS1 register files.
+#define LSM9DS1_CTRL_REG8  0x22 ///< CTRL_REG8 register of the accelerometer/gyroscope.
+#define LSM9DS1_IF_ADD_INC 0x04 ///< Auto increment bit of CTRL_REG8, set after reset.
+#define LSM9DS1_REG_MASK   0x7F ///< Register bits of the register byte.
+
+#define IS31FL3206_PWM0     0x04 ///< PWM register of OUT1.
+#define IS31FL3206_UPDATE   0x13 ///< Update register, latches the PWM and LED control registers.
+#define IS31FL3206_RESET    0x2F ///< Reset register, restores the reset values.
+
+#define LP5024_BROADCAST      0x3C ///< Broadcast address.
+#define LP5024_DEVICE_CONFIG1 0x01 ///< DEVICE_CONFIG1 register.
+#define LP5024_CONFIG1_RESET  0x3C ///< DEVICE_CONFIG1 reset value, Auto_Incr_EN set.
+#define LP5024_AUTO_INCR_EN   0x08 ///< Auto_Incr_EN bit of DEVICE_CONFIG1.
+#define LP5024_RESET          0x27 ///< Reset register.
+#define LP5024_RESET_VAL      0xFF ///< Value written to the reset register to reset the device.
+
+#define TLV320AIC3106_SOFT_RST     0x01 ///< Software reset register of page 0.
+#define TLV320AIC3106_SOFT_RST_VAL 0x80 ///< Value written to the software reset register to reset the device.
+
+#define MLX90615_CMD_EEPROM    0x10 ///< EEPROM access command.
+#define MLX90615_CMD_RAM       0x20 ///< RAM access command.
+#define MLX90615_CMD_MASK      0xF0 ///< Command bits of the command byte.
+#define MLX90615_CMD_SLEEP     0xC6 ///< Sleep mode enter command.
+#define MLX90615_CMD_SLEEP_PEC 0x6D ///< PEC of the sleep mode enter command.
+#define MLX90615_EEPROM_ID0    0x0E ///< EEPROM word of ID0.
+#define MLX90615_RAM_T_AMB     0x06 ///< RAM word of the ambient temperature.
+#define MLX90615_RAM_T_OBJ     0x07 ///< RAM word of the object temperature.
+#define MLX90615_CRC8_POLY     0x07 ///< SMBus PEC polynomial.
+
+static void is31fl3206_on_write(dk_host_twi_regfile_t *p_regfile, uint8_t reg, uint8_t value)
+{
+    UNUSED_PARAMETER(value);
+
+    dk_host_twi_is31fl3206_t *p_is31fl3206 = (dk_host_twi_is31fl3206_t *)p_regfile;
+
+    if (reg == IS31FL3206_UPDATE)
+    {
+        memcpy(p_is31fl3206->pwm_out, &p_regfile->regs[IS31FL3206_PWM0], DK_HOST_TWI_IS31FL3206_OUT_COUNT);
+        p_is31fl3206->update_count++;
+    } else if (reg == IS31FL3206_RESET)
+    {
+        memset(p_regfile->regs, 0, sizeof(p_regfile->regs));
+        memset(p_is31fl3206->pwm_out, 0, sizeof(p_is31fl3206->pwm_out));
+    }
+}
+
+static void lp5024_on_write(dk_host_twi_regfile_t *p_regfile, uint8_t reg, uint8_t value)
+{
+    if ((reg == LP5024_RESET) && (value == LP5024_RESET_VAL))
+    {
+        memset(p_regfile->regs, 0, sizeof(p_regfile->regs));
+        p_regfile->regs[LP5024_DEVICE_CONFIG1] = LP5024_CONFIG1_RESET;
+    }
+}
+
+static void tlv320aic3106_on_write(dk_host_twi_regfile_t *p_regfile, uint8_t reg, uint8_t value)
+{
+    // Page 0 register 1, the software reset bit clears itself.
+    if ((reg == TLV320AIC3106_SOFT_RST) && (p_regfile->regs[0] == 0) && (value & TLV320AIC3106_SOFT_RST_VAL))
+    {
+        memset(p_regfile->regs, 0, sizeof(p_regfile->regs));
+        memset(p_regfile->page1, 0, sizeof(p_regfile->page1));
+    }
+}
+
+static uint8_t crc8_update(uint8_t crc, uint8_t byte)
+{
+    crc ^= byte;
+
+    for (uint8_t i = 0; i < 8; i++)
+    {
+        crc = (crc & 0x80) ? (uint8_t)((crc << 1) ^ MLX90615_CRC8_POLY) : (uint8_t)(crc << 1);
+    }
+
+    return crc;
+}
+
+static uint16_t *mlx90615_word(dk_host_twi_mlx90615_t *p_mlx90615)
+{
+    uint8_t index = p_mlx90615->command & 0x0F;
+
+    switch (p_mlx90615->command & MLX90615_CMD_MASK)
+    {
+        case MLX90615_CMD_EEPROM:
+            return &p_mlx90615->eeprom[index];
+
+        case MLX90615_CMD_RAM:
+            return &p_mlx90615->ram[index];
+
+        default:
+            return NULL;
+    }
+}
+
+static bool mlx90615_start(dk_host_twi_slave_t *p_slave, uint8_t address, bool read)
+{
+    dk_host_twi_mlx90615_t *p_mlx90615 = (dk_host_twi_mlx90615_t *)p_slave;
+
+    p_mlx90615->addressed = (address == p_mlx90615->address) && !p_mlx90615->asleep;
+    p_mlx90615->read      = read;
+    p_mlx90615->rx_count  = 0;
+    p_mlx90615->tx_count  = 0;
+
+    return p_mlx90615->addressed;
+}
+
+static bool mlx90615_write(dk_host_twi_slave_t *p_slave, uint8_t byte)
+{
+    dk_host_twi_mlx90615_t *p_mlx90615 = (dk_host_twi_mlx90615_t *)p_slave;
+
+    if (p_mlx90615->rx_count++ == 0)
+    {
+        p_mlx90615->command = byte;
+        return true;
+    }
+
+    // Only the sleep command is modelled among the writes, it takes effect if its PEC is right.
+    if ((p_mlx90615->command == MLX90615_CMD_SLEEP) && (byte == MLX90615_CMD_SLEEP_PEC))
+    {
+        p_mlx90615->asleep = true;
+    }
+
+    return true;
+}
+
+static uint8_t mlx90615_read(dk_host_twi_slave_t *p_slave)
+{
+    dk_host_twi_mlx90615_t *p_mlx90615 = (dk_host_twi_mlx90615_t *)p_slave;
+
+    uint16_t const *p_word = mlx90615_word(p_mlx90615);
+    uint16_t        word   = (p_word != NULL) ? *p_word : 0xFFFF;
+
+    switch (p_mlx90615->tx_count++)
+    {
+        case 0:
+            return (uint8_t)word;
+
+        case 1:
+            return (uint8_t)(word >> 8);
+
+        default:
+        {
+            // PEC over the whole SMBus read word frame.
+            uint8_t pec = crc8_update(0, (uint8_t)(p_mlx90615->address << 1));
+
+            pec = crc8_update(pec, p_mlx90615->command);
+            pec = crc8_update(pec, (uint8_t)((p_mlx90615->address << 1) | 0x01));
+            pec = crc8_update(pec, (uint8_t)word);
+
+            return crc8_update(pec, (uint8_t)(word >> 8));
+        }
+    }
+}
+
+static void mlx90615_stop(dk_host_twi_slave_t *p_slave)
+{
+    dk_host_twi_mlx90615_t *p_mlx90615 = (dk_host_twi_mlx90615_t *)p_slave;
+
+    p_mlx90615->addressed = false;
+}
+
+static dk_host_twi_slave_api_t const m_mlx90615_api = {
+  .start = mlx90615_start,
+  .write = mlx90615_write,
+  .read  = mlx90615_read,
+  .stop  = mlx90615_stop,
+};
+
+static bool tca9548a_start(dk_host_twi_slave_t *p_slave, uint8_t address, bool read)
+{
+    dk_host_twi_tca9548a_t *p_tca9548a = (dk_host_twi_tca9548a_t *)p_slave;
+
+    p_tca9548a->own      = (address == p_tca9548a->address);
+    p_tca9548a->p_active = NULL;
+
+    // Slaves of all enabled channels see the address byte, like on a real bus.
+    for (uint8_t i = 0; i < DK_HOST_TWI_TCA9548A_CHANNELS; i++)
+    {
+        for (dk_host_twi_slave_t *p_channel = p_tca9548a->p_channels[i];
+             (p_tca9548a->control & (1 << i)) && (p_channel != NULL);
+             p_channel = p_channel->p_next)
+        {
+            if (p_channel->p_api->start(p_channel, address, read) && (p_tca9548a->p_active == NULL))
+            {
+                p_tca9548a->p_active = p_channel;
+            }
+        }
+    }
+
+    return p_tca9548a->own || (p_tca9548a->p_active != NULL);
+}
+
+static bool tca9548a_write(dk_host_twi_slave_t *p_slave, uint8_t byte)
+{
+    dk_host_twi_tca9548a_t *p_tca9548a = (dk_host_twi_tca9548a_t *)p_slave;
+
+    if (p_tca9548a->own)
+    {
+        p_tca9548a->control = byte;
+        return true;
+    }
+
+    return p_tca9548a->p_active->p_api->write(p_tca9548a->p_active, byte);
+}
+
+static uint8_t tca9548a_read(dk_host_twi_slave_t *p_slave)
+{
+    dk_host_twi_tca9548a_t *p_tca9548a = (dk_host_twi_tca9548a_t *)p_slave;
+
+    if (p_tca9548a->own)
+    {
+        return p_tca9548a->control;
+    }
+
+    return p_tca9548a->p_active->p_api->read(p_tca9548a->p_active);
+}
+
+static void tca9548a_stop(dk_host_twi_slave_t *p_slave)
+{
+    dk_host_twi_tca9548a_t *p_tca9548a = (dk_host_twi_tca9548a_t *)p_slave;
+
+    for (uint8_t i = 0; i < DK_HOST_TWI_TCA9548A_CHANNELS; i++)
+    {
+        for (dk_host_twi_slave_t *p_channel = p_tca9548a->p_channels[i];
+             (p_tca9548a->control & (1 << i)) && (p_channel != NULL);
+             p_channel = p_channel->p_next)
+        {
+            p_channel->p_api->stop(p_channel);
+        }
+    }
+
+    p_tca9548a->own      = false;
+    p_tca9548a->p_active = NULL;
+}
+
+static dk_host_twi_slave_api_t const m_tca9548a_api = {
+  .start = tca9548a_start,
+  .write = tca9548a_write,
+  .read  = tca9548a_read,
+  .stop  = tca9548a_stop,
+};
+
+void dk_host_twi_lsm9ds1_init(dk_host_twi_regfile_t *p_ag,
+                              dk_host_twi_regfile_t *p_mag,
+                              uint8_t                ag_address,
+                              uint8_t                mag_address)
+{
+    dk_host_twi_regfile_init(p_ag, ag_address);
+    p_ag->reg_mask                = LSM9DS1_REG_MASK;
+    p_ag->auto_inc                = DK_HOST_TWI_AUTO_INC_CTRL;
+    p_ag->inc_reg                 = LSM9DS1_CTRL_REG8;
+    p_ag->inc_mask                = LSM9DS1_IF_ADD_INC;
+    p_ag->regs[LSM9DS1_CTRL_REG8] = LSM9DS1_IF_ADD_INC;
+    p_ag->regs[LSM9DS1_WHO_AM_I]  = DK_HOST_TWI_LSM9DS1_AG_WHO_AM_I;
+    dk_host_twi_regfile_read_only_set(p_ag, LSM9DS1_WHO_AM_I);
+
+    dk_host_twi_regfile_init(p_mag, mag_address);
+    p_mag->reg_mask               = LSM9DS1_REG_MASK;
+    p_mag->auto_inc               = DK_HOST_TWI_AUTO_INC_SUB_MSB;
+    p_mag->regs[LSM9DS1_WHO_AM_I] = DK_HOST_TWI_LSM9DS1_MAG_WHO_AM_I;
+    dk_host_twi_regfile_read_only_set(p_mag, LSM9DS1_WHO_AM_I);
+}
+
+void dk_host_twi_is31fl3206_init(dk_host_twi_is31fl3206_t *p_is31fl3206, uint8_t address)
+{
+    memset(p_is31fl3206, 0, sizeof(dk_host_twi_is31fl3206_t));
+
+    dk_host_twi_regfile_init(&p_is31fl3206->regfile, address);
+    p_is31fl3206->regfile.write_only = true;
+    p_is31fl3206->regfile.on_write   = is31fl3206_on_write;
+}
+
+void dk_host_twi_lp5024_init(dk_host_twi_regfile_t *p_lp5024, uint8_t address)
+{
+    dk_host_twi_regfile_init(p_lp5024, address);
+    p_lp5024->broadcast_address           = LP5024_BROADCAST;
+    p_lp5024->auto_inc                    = DK_HOST_TWI_AUTO_INC_CTRL;
+    p_lp5024->inc_reg                     = LP5024_DEVICE_CONFIG1;
+    p_lp5024->inc_mask                    = LP5024_AUTO_INCR_EN;
+    p_lp5024->regs[LP5024_DEVICE_CONFIG1] = LP5024_CONFIG1_RESET;
+    p_lp5024->on_write                    = lp5024_on_write;
+}
+
+void dk_host_twi_tlv320aic3106_init(dk_host_twi_regfile_t *p_tlv320aic3106, uint8_t address)
+{
+    dk_host_twi_regfile_init(p_tlv320aic3106, address);
+    p_tlv320aic3106->paged    = true;
+    p_tlv320aic3106->on_write = tlv320aic3106_on_write;
+}
+
+void dk_host_twi_mlx90615_init(dk_host_twi_mlx90615_t *p_mlx90615, uint8_t address)
+{
+    memset(p_mlx90615, 0, sizeof(dk_host_twi_mlx90615_t));
+
+    p_mlx90615->slave.p_api                 = &m_mlx90615_api;
+    p_mlx90615->address                     = address;
+    p_mlx90615->eeprom[MLX90615_EEPROM_ID0] = DK_HOST_TWI_MLX90615_ID0;
+}
+
+void dk_host_twi_mlx90615_temp_set(dk_host_twi_mlx90615_t *p_mlx90615, float amb_celsius, float obj_celsius)
+{
+    // 0.02 K per LSB, rounded to the nearest step.
+    p_mlx90615->ram[MLX90615_RAM_T_AMB] = (uint16_t)(((amb_celsius + 273.15f) / 0.02f) + 0.5f);
+    p_mlx90615->ram[MLX90615_RAM_T_OBJ] = (uint16_t)(((obj_celsius + 273.15f) / 0.02f) + 0.5f);
+}
+
+void dk_host_twi_tca9548a_init(dk_host_twi_tca9548a_t *p_tca9548a, uint8_t address)
+{
+    memset(p_tca9548a, 0, sizeof(dk_host_twi_tca9548a_t));
+
+    p_tca9548a->slave.p_api = &m_tca9548a_api;
+    p_tca9548a->address     = address;
+}
+
+void dk_host_twi_tca9548a_attach(dk_host_twi_tca9548a_t *p_tca9548a, uint8_t channel, dk_host_twi_slave_t *p_slave)
+{
+    ASSERT(channel < DK_HOST_TWI_TCA9548A_CHANNELS);
+
+    p_slave->p_next                 = p_tca9548a->p_channels[channel];
+    p_tca9548a->p_channels[channel] = p_slave;
+}
@@ -0,0 +1,150 @@
+/**
+ * @file        dk_host_twi_models.h
+ * @author      Danius Kalvaitis (danius.kalvaitis@gmail.com)
+ * @brief       Simulated TWI devices of the host build, modelling the registers the DK Lib drivers rely on.
+ * @version     0.1
+ * @date        2026-10-17
+ *
+ * @copyright   Copyright (c) Danius Kalvaitis 2026 All rights reserved
+ *
+ */
+
+#ifndef DK_HOST_TWI_MODELS_H
+#define DK_HOST_TWI_MODELS_H
+
+#include "dk_host_twi.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define DK_HOST_TWI_LSM9DS1_AG_WHO_AM_I  0x68   ///< WHO_AM_I value of the LSM9DS1 accelerometer and gyroscope.
+#define DK_HOST_TWI_LSM9DS1_MAG_WHO_AM_I 0x3D   ///< WHO_AM_I value of the LSM9DS1 magnetometer.
+#define DK_HOST_TWI_IS31FL3206_OUT_COUNT 12     ///< Amount of IS31FL3206 outputs.
+#define DK_HOST_TWI_MLX90615_ID0         0xCBE0 ///< ID0 EEPROM word of the MLX90615.
+#define DK_HOST_TWI_TCA9548A_CHANNELS    8      ///< Amount of TCA9548A channels.
+
+/**
+ * @brief IS31FL3206 LED driver, PWM registers reach the outputs on the update register write.
+ */
+typedef struct
+{
+    dk_host_twi_regfile_t regfile;                                   ///< Register file of the device.
+    uint8_t               pwm_out[DK_HOST_TWI_IS31FL3206_OUT_COUNT]; ///< PWM latched to the outputs.
+    uint32_t              update_count;                              ///< Amount of update register writes.
+} dk_host_twi_is31fl3206_t;
+
+/**
+ * @brief MLX90615 infrared thermometer, SMBus commands select a RAM or EEPROM word.
+ */
+typedef struct
+{
+    dk_host_twi_slave_t slave;      ///< Slave interface.
+    uint8_t             address;    ///< 7-bit slave address.
+    bool                addressed;  ///< Slave acknowledged the last address byte.
+    bool                read;       ///< Last address byte was a read.
+    uint8_t             command;    ///< Last command byte.
+    uint8_t             rx_count;   ///< Bytes written since the start condition.
+    uint8_t             tx_count;   ///< Bytes read since the start condition.
+    bool                asleep;     ///< Device entered sleep mode and does not answer.
+    uint16_t            ram[16];    ///< RAM words.
+    uint16_t            eeprom[16]; ///< EEPROM words.
+} dk_host_twi_mlx90615_t;
+
+/**
+ * @brief TCA9548A multiplexer, the control register connects the enabled channels to the bus.
+ */
+typedef struct
+{
+    dk_host_twi_slave_t  slave;                                     ///< Slave interface.
+    uint8_t              address;                                   ///< 7-bit slave address.
+    uint8_t              control;                                   ///< Control register, bit per enabled channel.
+    dk_host_twi_slave_t *p_channels[DK_HOST_TWI_TCA9548A_CHANNELS]; ///< Slaves behind each channel, NULL if none.
+    dk_host_twi_slave_t *p_active;                                  ///< Channel slave of the transfer in progress.
+    bool                 own;                                       ///< Transfer in progress addresses the mux.
+} dk_host_twi_tca9548a_t;
+
+/**
+ * @brief       Initialize the LSM9DS1 accelerometer/gyroscope and magnetometer register files.
+ *
+ * @details     WHO_AM_I registers are read only. Accelerometer/gyroscope registers auto increment while IF_ADD_INC
+ *              of CTRL_REG8 is set (reset value), magnetometer registers if the register byte has its MSB set.
+ *
+ * @param[out]  p_ag        Pointer to the accelerometer/gyroscope register file.
+ * @param[out]  p_mag       Pointer to the magnetometer register file.
+ * @param[in]   ag_address  7-bit accelerometer/gyroscope address.
+ * @param[in]   mag_address 7-bit magnetometer address.
+ */
+void dk_host_twi_lsm9ds1_init(dk_host_twi_regfile_t *p_ag,
+                              dk_host_twi_regfile_t *p_mag,
+                              uint8_t                ag_address,
+                              uint8_t                mag_address);
+
+/**
+ * @brief       Initialize an IS31FL3206, a write only device.
+ *
+ * @param[out]  p_is31fl3206    Pointer to the device.
+ * @param[in]   address         7-bit slave address.
+ */
+void dk_host_twi_is31fl3206_init(dk_host_twi_is31fl3206_t *p_is31fl3206, uint8_t address);
+
+/**
+ * @brief       Initialize an LP5024 register file answering writes to the broadcast address too.
+ *
+ * @details     Registers auto increment while Auto_Incr_EN of DEVICE_CONFIG1 is set (reset value). A write of 0xFF
+ *              to the reset register restores the reset values.
+ *
+ * @param[out]  p_lp5024    Pointer to the register file.
+ * @param[in]   address     7-bit slave address.
+ */
+void dk_host_twi_lp5024_init(dk_host_twi_regfile_t *p_lp5024, uint8_t address);
+
+/**
+ * @brief       Initialize a TLV320AIC3106 register file with page select in register 0.
+ *
+ * @details     Setting SOFT_RST of page 0 register 1 clears all registers.
+ *
+ * @param[out]  p_tlv320aic3106 Pointer to the register file.
+ * @param[in]   address         7-bit slave address.
+ */
+void dk_host_twi_tlv320aic3106_init(dk_host_twi_regfile_t *p_tlv320aic3106, uint8_t address);
+
+/**
+ * @brief       Initialize an MLX90615 with the ID0 word in EEPROM.
+ *
+ * @param[out]  p_mlx90615  Pointer to the device.
+ * @param[in]   address     7-bit slave address.
+ */
+void dk_host_twi_mlx90615_init(dk_host_twi_mlx90615_t *p_mlx90615, uint8_t address);
+
+/**
+ * @brief       Set the temperature words of an MLX90615.
+ *
+ * @param[in]   p_mlx90615  Pointer to the device.
+ * @param[in]   amb_celsius Ambient temperature.
+ * @param[in]   obj_celsius Object temperature.
+ */
+void dk_host_twi_mlx90615_temp_set(dk_host_twi_mlx90615_t *p_mlx90615, float amb_celsius, float obj_celsius);
+
+/**
+ * @brief       Initialize a TCA9548A with all channels disabled.
+ *
+ * @param[out]  p_tca9548a  Pointer to the device.
+ * @param[in]   address     7-bit slave address.
+ */
+void dk_host_twi_tca9548a_init(dk_host_twi_tca9548a_t *p_tca9548a, uint8_t address);
+
+/**
+ * @brief       Connect a slave to a channel of a TCA9548A. A channel can have several slaves.
+ *
+ * @param[in]   p_tca9548a  Pointer to the device.
+ * @param[in]   channel     Channel number.
+ * @param[in]   p_slave     Pointer to the slave.
+ */
+void dk_host_twi_tca9548a_attach(dk_host_twi_tca9548a_t *p_tca9548a, uint8_t channel, dk_host_twi_slave_t *p_slave);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // DK_HOST_TWI_MODELS_H
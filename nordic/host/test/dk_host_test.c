@@ -0,0 +1,31 @@
+/**
+ * @file        dk_host_test.c
+ * @author      Danius Kalvaitis (danius.kalvaitis@gmail.com)
+ * @brief       Simulator reset shared by the host tests.
+ * @version     0.1
+ * @date        2026-10-17
+ *
+ * @copyright   Copyright (c) Danius Kalvaitis 2026 All rights reserved
+ *
+ */
+
+#include "dk_host_test.h"
+
+#include "app_scheduler.h"
+#include "dk_host_ble.h"
+#include "dk_host_fstorage.h"
+#include "dk_host_sim.h"
+#include "dk_host_spi.h"
+#include "dk_host_twi.h"
+#include "nrf_gpio.h"
+
+void dk_host_test_reset(void)
+{
+    dk_host_reset();
+    dk_host_gpio_reset();
+    dk_host_twi_reset();
+    dk_host_spi_reset();
+    dk_host_ble_reset();
+    dk_host_fstorage_reset();
+    app_sched_init();
+}
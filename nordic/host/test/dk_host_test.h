@@ -0,0 +1,76 @@
+/**
+ * @file        dk_host_test.h
+ * @author      Danius Kalvaitis (danius.kalvaitis@gmail.com)
+ * @brief       Assertions and simulator reset shared by the host tests.
+ * @version     0.1
+ * @date        2026-10-17
+ *
+ * @copyright   Copyright (c) Danius Kalvaitis 2026 All rights reserved
+ *
+ */
+
+#ifndef DK_HOST_TEST_H
+#define DK_HOST_TEST_H
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Macro for failing the test if a condition does not hold.
+ */
+#define TEST_ASSERT(_condition)                                                                                        \
+    do                                                                                                                 \
+    {                                                                                                                  \
+        if (!(_condition))                                                                                             \
+        {                                                                                                              \
+            fprintf(stderr, "%s:%d: assertion failed: %s\n", __FILE__, __LINE__, #_condition);                         \
+            abort();                                                                                                   \
+        }                                                                                                              \
+    } while (0)
+
+/**
+ * @brief Macro for failing the test if two integer values differ.
+ */
+#define TEST_ASSERT_EQUAL(_expected, _actual)                                                                          \
+    do                                                                                                                 \
+    {                                                                                                                  \
+        long long const test_expected = (long long)(_expected);                                                        \
+        long long const test_actual   = (long long)(_actual);                                                          \
+        if (test_expected != test_actual)                                                                              \
+        {                                                                                                              \
+            fprintf(stderr,                                                                                            \
+                    "%s:%d: %s is %lld, expected %lld\n",                                                              \
+                    __FILE__,                                                                                          \
+                    __LINE__,                                                                                          \
+                    #_actual,                                                                                          \
+                    test_actual,                                                                                       \
+                    test_expected);                                                                                    \
+            abort();                                                                                                   \
+        }                                                                                                              \
+    } while (0)
+
+/**
+ * @brief Macro for running a test function on a freshly reset simulator.
+ */
+#define TEST_RUN(_test)                                                                                                \
+    do                                                                                                                 \
+    {                                                                                                                  \
+        dk_host_test_reset();                                                                                          \
+        _test();                                                                                                       \
+        printf("PASS %s\n", #_test);                                                                                   \
+    } while (0)
+
+/**
+ * @brief       Reset virtual time and all simulated peripherals.
+ */
+void dk_host_test_reset(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // DK_HOST_TEST_H
@@ -0,0 +1,88 @@
+/**
+ * @file        test_dk_ble_services.c
+ * @author      Danius Kalvaitis (danius.kalvaitis@gmail.com)
+ * @brief       Host tests of the BLE services on the simulated GATT server.
+ * @version     0.1
+ * @date        2026-10-17
+ *
+ * @copyright   Copyright (c) Danius Kalvaitis 2026 All rights reserved
+ *
+ */
+
+#include "dk_ble_phil_it_up.h"
+#include "dk_host_ble.h"
+#include "dk_host_test.h"
+
+#define TEST_CONN_HANDLE 1
+
+DK_BLE_PHIL_IT_UP_DEF(m_phil_it_up);
+
+static dk_ble_phil_it_up_evt_t m_last_evt;
+static uint32_t                m_evt_count;
+
+static void phil_it_up_evt_handler(dk_ble_phil_it_up_evt_t *p_dk_ble_phil_it_up_evt)
+{
+    m_last_evt = *p_dk_ble_phil_it_up_evt;
+    m_evt_count++;
+}
+
+static void setup(void)
+{
+    m_evt_count = 0;
+
+    dk_ble_phil_it_up_config_t config = {
+      .evt_handler         = phil_it_up_evt_handler,
+      .initial_mug_up_val  = false,
+      .initial_target_temp = 60.0f,
+    };
+    TEST_ASSERT_EQUAL(NRF_SUCCESS, dk_ble_phil_it_up_init(&m_phil_it_up, &config));
+
+    dk_host_ble_connect(TEST_CONN_HANDLE);
+}
+
+static void test_notification_needs_cccd(void)
+{
+    setup();
+
+    TEST_ASSERT(dk_ble_phil_it_up_amb_tmp_notify(TEST_CONN_HANDLE, &m_phil_it_up, 21.5f) != NRF_SUCCESS);
+    TEST_ASSERT_EQUAL(0, dk_host_ble_notification_count_get());
+
+    uint8_t const cccd_enable[] = {BLE_GATT_HVX_NOTIFICATION, 0x00};
+    dk_host_ble_write(m_phil_it_up.char_handles.amb_temp.cccd_handle, cccd_enable, sizeof(cccd_enable));
+    TEST_ASSERT_EQUAL(1, m_evt_count);
+    TEST_ASSERT_EQUAL(DK_BLE_PHIL_IT_UP_EVT_AMB_NOTIFICATIONS_ENABLED, m_last_evt.evt_type);
+
+    TEST_ASSERT_EQUAL(NRF_SUCCESS, dk_ble_phil_it_up_amb_tmp_notify(TEST_CONN_HANDLE, &m_phil_it_up, 21.5f));
+    TEST_ASSERT_EQUAL(1, dk_host_ble_notification_count_get());
+
+    uint16_t handle;
+    uint8_t  data[32];
+    float    temperature;
+    TEST_ASSERT_EQUAL(sizeof(float), dk_host_ble_notification_last_get(&handle, data));
+    memcpy(&temperature, data, sizeof(temperature));
+    TEST_ASSERT_EQUAL(m_phil_it_up.char_handles.amb_temp.value_handle, handle);
+    TEST_ASSERT(temperature == 21.5f);
+}
+
+static void test_target_temp_write(void)
+{
+    setup();
+
+    float const target = 55.0f;
+    dk_host_ble_write(m_phil_it_up.char_handles.target_temp.value_handle, (uint8_t const *)&target, sizeof(target));
+    TEST_ASSERT_EQUAL(1, m_evt_count);
+    TEST_ASSERT_EQUAL(DK_BLE_PHIL_IT_UP_EVT_TARGET_TEMP_RX, m_last_evt.evt_type);
+    TEST_ASSERT(m_last_evt.params.target_temp == target);
+
+    // Writes of a wrong length are ignored.
+    dk_host_ble_write(m_phil_it_up.char_handles.target_temp.value_handle, (uint8_t const *)&target, 2);
+    TEST_ASSERT_EQUAL(1, m_evt_count);
+}
+
+int main(void)
+{
+    TEST_RUN(test_notification_needs_cccd);
+    TEST_RUN(test_target_temp_write);
+
+    return 0;
+}
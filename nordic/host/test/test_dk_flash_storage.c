@@ -0,0 +1,66 @@
+/**
+ * @file        test_dk_flash_storage.c
+ * @author      Danius Kalvaitis (danius.kalvaitis@gmail.com)
+ * @brief       Host tests of the flash storage wrapper on the simulated flash.
+ * @version     0.1
+ * @date        2026-10-17
+ *
+ * @copyright   Copyright (c) Danius Kalvaitis 2026 All rights reserved
+ *
+ */
+
+#include "dk_flash_storage.h"
+#include "dk_host_fstorage.h"
+#include "dk_host_sim.h"
+#include "dk_host_test.h"
+
+#define TEST_START_ADDRESS 0x3E000
+#define TEST_END_ADDRESS   0x3FFFF
+
+static nrf_fstorage_t m_fstorage;
+
+static uint32_t m_evt_count;
+
+static void fstorage_evt_handler(nrf_fstorage_evt_t *p_evt)
+{
+    TEST_ASSERT_EQUAL(NRF_SUCCESS, p_evt->result);
+    m_evt_count++;
+}
+
+static void test_erase_write_read(void)
+{
+    m_evt_count = 0;
+    dk_flash_storage_init(&m_fstorage, fstorage_evt_handler, TEST_START_ADDRESS, TEST_END_ADDRESS);
+
+    uint32_t const pattern[] = {0x12345678, 0xCAFEF00D};
+    uint32_t       readback[2];
+
+    dk_flash_storage_write(&m_fstorage, TEST_START_ADDRESS, pattern, sizeof(pattern), dk_host_wait_for_event);
+    while (nrf_fstorage_is_busy(&m_fstorage))
+    {
+        dk_host_wait_for_event();
+    }
+
+    dk_flash_storage_read(&m_fstorage, TEST_START_ADDRESS, readback, sizeof(readback), dk_host_wait_for_event);
+    TEST_ASSERT_EQUAL(pattern[0], readback[0]);
+    TEST_ASSERT_EQUAL(pattern[1], readback[1]);
+
+    uint64_t start = dk_host_time_get();
+    dk_flash_storage_erase(&m_fstorage, TEST_START_ADDRESS, 1);
+    while (nrf_fstorage_is_busy(&m_fstorage))
+    {
+        dk_host_wait_for_event();
+    }
+    TEST_ASSERT(dk_host_time_get() - start >= DK_HOST_FLASH_ERASE_NS);
+
+    dk_flash_storage_read(&m_fstorage, TEST_START_ADDRESS, readback, sizeof(readback), dk_host_wait_for_event);
+    TEST_ASSERT_EQUAL(0xFFFFFFFF, readback[0]);
+    TEST_ASSERT_EQUAL(2, m_evt_count);
+}
+
+int main(void)
+{
+    TEST_RUN(test_erase_write_read);
+
+    return 0;
+}
@@ -0,0 +1,129 @@
+/**
+ * @file        test_dk_mpsc_queue.c
+ * @author      Danius Kalvaitis (danius.kalvaitis@gmail.com)
+ * @brief       Host tests of the MPSC queue, including a multi-producer stress test on real threads.
+ * @version     0.1
+ * @date        2026-10-17
+ *
+ * @copyright   Copyright (c) Danius Kalvaitis 2026 All rights reserved
+ *
+ */
+
+#include <pthread.h>
+#include <sched.h>
+
+#include "dk_host_test.h"
+#include "dk_mpsc_queue.h"
+
+#define STRESS_PRODUCER_COUNT   4      ///< Producer threads, each one stands in for an interrupt priority.
+#define STRESS_ELEMENT_COUNT    200000 ///< Elements pushed by every producer.
+#define STRESS_QUEUE_SIZE       8      ///< Small queue so that positions wrap and producers see it full.
+#define STRESS_CHECK(_id, _seq) ((uint32_t)(((_id) * 0x9E3779B1UL) ^ ((_seq) * 0x85EBCA77UL)))
+
+/**
+ * @brief Stress test element, larger than a word so that torn copies are detected.
+ */
+typedef struct
+{
+    uint32_t producer; ///< Producer index.
+    uint32_t seq;      ///< Sequence number within the producer.
+    uint32_t check;    ///< Check value derived from @p producer and @p seq.
+} stress_element_t;
+
+DK_MPSC_QUEUE_DEF(uint32_t, m_queue, 4);
+DK_MPSC_QUEUE_DEF(stress_element_t, m_stress_queue, STRESS_QUEUE_SIZE);
+
+static void *stress_producer(void *p_arg)
+{
+    uint32_t id = (uint32_t)(uintptr_t)p_arg;
+
+    for (uint32_t seq = 0; seq < STRESS_ELEMENT_COUNT;)
+    {
+        stress_element_t element = {.producer = id, .seq = seq, .check = STRESS_CHECK(id, seq)};
+
+        if (dk_mpsc_queue_push(&m_stress_queue, &element) == NRF_SUCCESS)
+        {
+            seq++;
+        } else
+        {
+            sched_yield();
+        }
+    }
+
+    return NULL;
+}
+
+static void test_fifo_full_empty(void)
+{
+    uint32_t element;
+
+    dk_mpsc_queue_init(&m_queue);
+    TEST_ASSERT(dk_mpsc_queue_is_empty(&m_queue));
+    TEST_ASSERT_EQUAL(NRF_ERROR_NOT_FOUND, dk_mpsc_queue_pop(&m_queue, &element));
+
+    // Several rounds so that positions wrap around the slots.
+    for (uint32_t round = 0; round < 3; round++)
+    {
+        for (element = 0; element < 4; element++)
+        {
+            TEST_ASSERT_EQUAL(NRF_SUCCESS, dk_mpsc_queue_push(&m_queue, &element));
+        }
+        TEST_ASSERT_EQUAL(NRF_ERROR_NO_MEM, dk_mpsc_queue_push(&m_queue, &element));
+        TEST_ASSERT_EQUAL(4, dk_mpsc_queue_pending_count(&m_queue));
+        TEST_ASSERT_EQUAL(2, *(uint32_t *)dk_mpsc_queue_pending_get(&m_queue, 2));
+
+        for (uint32_t expected = 0; expected < 4; expected++)
+        {
+            TEST_ASSERT_EQUAL(NRF_SUCCESS, dk_mpsc_queue_pop(&m_queue, &element));
+            TEST_ASSERT_EQUAL(expected, element);
+        }
+        TEST_ASSERT(dk_mpsc_queue_is_empty(&m_queue));
+    }
+}
+
+static void test_multi_producer_stress(void)
+{
+    pthread_t threads[STRESS_PRODUCER_COUNT];
+    uint32_t  next_seq[STRESS_PRODUCER_COUNT] = {0};
+    uint64_t  received                        = 0;
+
+    dk_mpsc_queue_init(&m_stress_queue);
+
+    for (uint32_t i = 0; i < STRESS_PRODUCER_COUNT; i++)
+    {
+        TEST_ASSERT_EQUAL(0, pthread_create(&threads[i], NULL, stress_producer, (void *)(uintptr_t)i));
+    }
+
+    // Every element arrives exactly once, intact and in order per producer.
+    while (received < (uint64_t)STRESS_PRODUCER_COUNT * STRESS_ELEMENT_COUNT)
+    {
+        stress_element_t element;
+
+        if (dk_mpsc_queue_pop(&m_stress_queue, &element) != NRF_SUCCESS)
+        {
+            sched_yield();
+            continue;
+        }
+
+        TEST_ASSERT(element.producer < STRESS_PRODUCER_COUNT);
+        TEST_ASSERT_EQUAL(next_seq[element.producer], element.seq);
+        TEST_ASSERT_EQUAL(STRESS_CHECK(element.producer, element.seq), element.check);
+        next_seq[element.producer]++;
+        received++;
+    }
+
+    for (uint32_t i = 0; i < STRESS_PRODUCER_COUNT; i++)
+    {
+        TEST_ASSERT_EQUAL(0, pthread_join(threads[i], NULL));
+    }
+
+    TEST_ASSERT(dk_mpsc_queue_is_empty(&m_stress_queue));
+}
+
+int main(void)
+{
+    TEST_RUN(test_fifo_full_empty);
+    TEST_RUN(test_multi_producer_stress);
+
+    return 0;
+}
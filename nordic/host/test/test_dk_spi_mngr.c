@@ -0,0 +1,204 @@
+/**
+ * @file        test_dk_spi_mngr.c
+ * @author      Danius Kalvaitis (danius.kalvaitis@gmail.com)
+ * @brief       Host tests of the SPI manager on the simulated bus.
+ * @version     0.1
+ * @date        2026-10-17
+ *
+ * @copyright   Copyright (c) Danius Kalvaitis 2026 All rights reserved
+ *
+ */
+
+#include <string.h>
+
+#include "dk_host_sim.h"
+#include "dk_host_spi.h"
+#include "dk_host_test.h"
+#include "dk_spi_mngr.h"
+#include "nrf_gpio.h"
+
+#define TEST_SCK_PIN  3
+#define TEST_MOSI_PIN 4
+#define TEST_MISO_PIN 28
+#define TEST_CS_A_PIN 29
+#define TEST_CS_B_PIN 30
+
+DK_SPI_MNGR_DEF(m_spi_mngr, 4, 0);
+
+/**
+ * @brief Slave recording MOSI bytes and answering with the previous byte plus one.
+ */
+typedef struct
+{
+    dk_host_spi_slave_t slave;     ///< Slave interface.
+    uint8_t             rx[16];    ///< Received bytes.
+    uint8_t             rx_count;  ///< Amount of received bytes.
+    uint8_t             last_mosi; ///< Last received byte.
+} test_slave_t;
+
+static test_slave_t m_slave_a;
+static test_slave_t m_slave_b;
+
+static ret_code_t m_cb_result;
+static uint32_t   m_cb_count;
+
+static dk_spi_mngr_config_t const m_spi_config = {
+  .sck_pin      = TEST_SCK_PIN,
+  .mosi_pin     = TEST_MOSI_PIN,
+  .miso_pin     = TEST_MISO_PIN,
+  .ss_pin       = DK_SPI_MNGR_PIN_NOT_USED,
+  .irq_priority = 6,
+  .orc          = 0xFF,
+  .frequency    = NRF_SPI_FREQ_4M,
+  .mode         = NRF_SPI_MODE_0,
+  .bit_order    = NRF_SPI_BIT_ORDER_MSB_FIRST,
+};
+
+static uint8_t test_slave_exchange(dk_host_spi_slave_t *p_slave, uint8_t mosi)
+{
+    // Pointer for cleaner code.
+    test_slave_t *p_test_slave = (test_slave_t *)p_slave;
+
+    uint8_t miso = p_test_slave->last_mosi + 1;
+
+    if (p_test_slave->rx_count < sizeof(p_test_slave->rx))
+    {
+        p_test_slave->rx[p_test_slave->rx_count++] = mosi;
+    }
+    p_test_slave->last_mosi = mosi;
+
+    return miso;
+}
+
+static void test_slave_attach(test_slave_t *p_test_slave, uint32_t cs_pin)
+{
+    memset(p_test_slave, 0, sizeof(test_slave_t));
+    p_test_slave->slave.exchange = test_slave_exchange;
+    p_test_slave->slave.cs_pin   = cs_pin;
+    dk_host_spi_slave_attach(0, &p_test_slave->slave);
+
+    nrf_gpio_pin_set(cs_pin);
+    nrf_gpio_cfg_output(cs_pin);
+}
+
+static void spi_mngr_callback(ret_code_t result, void *p_user_data)
+{
+    UNUSED_PARAMETER(p_user_data);
+
+    m_cb_result = result;
+    m_cb_count++;
+}
+
+static void setup(void)
+{
+    m_cb_result = NRF_SUCCESS;
+    m_cb_count  = 0;
+
+    test_slave_attach(&m_slave_a, TEST_CS_A_PIN);
+    test_slave_attach(&m_slave_b, TEST_CS_B_PIN);
+
+    TEST_ASSERT_EQUAL(NRF_SUCCESS, dk_spi_mngr_init(&m_spi_mngr, &m_spi_config));
+}
+
+static void test_perform_selects_slave(void)
+{
+    setup();
+
+    uint8_t                   tx_buffer[] = {0x10, 0x20, 0x30};
+    uint8_t                   rx_buffer[3];
+    dk_spi_mngr_transaction_t transaction = {
+      .xfer_desc = DK_SPI_MNGR_XFER_TRX(tx_buffer, sizeof(tx_buffer), rx_buffer, sizeof(rx_buffer)),
+      .cs_pin    = TEST_CS_B_PIN,
+      .dc_pin    = DK_SPI_MNGR_PIN_NOT_USED,
+    };
+    TEST_ASSERT_EQUAL(NRF_SUCCESS, dk_spi_mngr_perform(&m_spi_mngr, &transaction));
+
+    TEST_ASSERT_EQUAL(0, m_slave_a.rx_count);
+    TEST_ASSERT_EQUAL(3, m_slave_b.rx_count);
+    TEST_ASSERT_EQUAL(0x30, m_slave_b.rx[2]);
+    TEST_ASSERT_EQUAL(0x01, rx_buffer[0]);
+    TEST_ASSERT_EQUAL(0x11, rx_buffer[1]);
+    TEST_ASSERT_EQUAL(0x21, rx_buffer[2]);
+    TEST_ASSERT_EQUAL(1, nrf_gpio_pin_read(TEST_CS_B_PIN));
+
+    dk_spi_mngr_deinit(&m_spi_mngr);
+}
+
+static void test_schedule_in_order(void)
+{
+    setup();
+
+    static uint8_t tx_a[] = {0xA1, 0xA2};
+    static uint8_t tx_b[] = {0xB1};
+
+    dk_spi_mngr_transaction_t transaction = {
+      .callback  = spi_mngr_callback,
+      .xfer_desc = DK_SPI_MNGR_XFER_TX(tx_a, sizeof(tx_a)),
+      .cs_pin    = TEST_CS_A_PIN,
+      .dc_pin    = DK_SPI_MNGR_PIN_NOT_USED,
+    };
+    TEST_ASSERT_EQUAL(NRF_SUCCESS, dk_spi_mngr_schedule(&m_spi_mngr, &transaction));
+
+    transaction.xfer_desc = (dk_spi_mngr_xfer_desc_t)DK_SPI_MNGR_XFER_TX(tx_b, sizeof(tx_b));
+    transaction.cs_pin    = TEST_CS_B_PIN;
+    TEST_ASSERT_EQUAL(NRF_SUCCESS, dk_spi_mngr_schedule(&m_spi_mngr, &transaction));
+
+    while (!dk_spi_mngr_is_idle(&m_spi_mngr))
+    {
+        dk_host_wait_for_event();
+    }
+
+    TEST_ASSERT_EQUAL(2, m_cb_count);
+    TEST_ASSERT_EQUAL(NRF_SUCCESS, m_cb_result);
+    TEST_ASSERT_EQUAL(2, m_slave_a.rx_count);
+    TEST_ASSERT_EQUAL(0xA2, m_slave_a.rx[1]);
+    TEST_ASSERT_EQUAL(1, m_slave_b.rx_count);
+    TEST_ASSERT_EQUAL(0xB1, m_slave_b.rx[0]);
+
+    dk_spi_mngr_deinit(&m_spi_mngr);
+}
+
+static void test_schedule_multiple_all_or_nothing(void)
+{
+    setup();
+
+    static uint8_t tx[] = {0xC1, 0xC2};
+
+    dk_spi_mngr_transaction_t transactions[5];
+    for (uint32_t i = 0; i < ARRAY_SIZE(transactions); i++)
+    {
+        transactions[i] = (dk_spi_mngr_transaction_t){
+          .callback  = spi_mngr_callback,
+          .xfer_desc = DK_SPI_MNGR_XFER_TX(&tx[i % sizeof(tx)], 1),
+          .cs_pin    = TEST_CS_B_PIN,
+          .dc_pin    = DK_SPI_MNGR_PIN_NOT_USED,
+        };
+    }
+
+    // More transactions than the queue holds are rejected as a whole.
+    TEST_ASSERT_EQUAL(NRF_ERROR_NO_MEM, dk_spi_mngr_schedule_multiple(&m_spi_mngr, transactions, 5));
+    TEST_ASSERT(dk_spi_mngr_is_idle(&m_spi_mngr));
+
+    TEST_ASSERT_EQUAL(NRF_SUCCESS, dk_spi_mngr_schedule_multiple(&m_spi_mngr, transactions, 4));
+
+    while (!dk_spi_mngr_is_idle(&m_spi_mngr))
+    {
+        dk_host_wait_for_event();
+    }
+
+    TEST_ASSERT_EQUAL(4, m_cb_count);
+    TEST_ASSERT_EQUAL(4, m_slave_b.rx_count);
+    TEST_ASSERT_EQUAL(0xC1, m_slave_b.rx[2]);
+    TEST_ASSERT_EQUAL(0xC2, m_slave_b.rx[3]);
+
+    dk_spi_mngr_deinit(&m_spi_mngr);
+}
+
+int main(void)
+{
+    TEST_RUN(test_perform_selects_slave);
+    TEST_RUN(test_schedule_in_order);
+    TEST_RUN(test_schedule_multiple_all_or_nothing);
+
+    return 0;
+}
@@ -0,0 +1,200 @@
+/**
+ * @file        test_dk_twi_bus_group.c
+ * @author      Danius Kalvaitis (danius.kalvaitis@gmail.com)
+ * @brief       Host tests of the TWI bus group on two simulated buses.
+ * @version     0.1
+ * @date        2026-10-17
+ *
+ * @copyright   Copyright (c) Danius Kalvaitis 2026 All rights reserved
+ *
+ */
+
+#include "app_timer.h"
+#include "dk_host_sim.h"
+#include "dk_host_test.h"
+#include "dk_host_twi.h"
+#include "dk_twi_bus_group.h"
+
+#define TEST_SLAVE_ADDRESS 0x6A
+#define TEST_STRETCH_NS    100000
+
+enum
+{
+    TEST_DEVICE_A,     ///< Device on bus 0.
+    TEST_DEVICE_B,     ///< Device on bus 1, at the same address as device A.
+    TEST_DEVICE_COUNT, ///< Amount of devices, the first index that is out of range.
+};
+
+DK_TWI_MNGR_DEF(m_twi_bus_0, 4, 4, 4, 0, 4, 2);
+DK_TWI_MNGR_DEF(m_twi_bus_1, 4, 4, 4, 1, 4, 2);
+
+static dk_twi_mngr_t const *const m_buses[]             = {&m_twi_bus_0, &m_twi_bus_1};
+static uint8_t const              m_device_bus[]        = {[TEST_DEVICE_A] = 0, [TEST_DEVICE_B] = 1};
+static uint8_t const              m_device_bus_no_bus[] = {[TEST_DEVICE_A] = 0, [TEST_DEVICE_B] = 2};
+
+DK_TWI_BUS_GROUP_DEF(m_twi_bus_group, m_buses, m_device_bus);
+DK_TWI_BUS_GROUP_DEF(m_twi_bus_group_no_bus, m_buses, m_device_bus_no_bus);
+
+static dk_host_twi_regfile_t m_regfile_a;
+static dk_host_twi_regfile_t m_regfile_b;
+
+static ret_code_t m_cb_result[TEST_DEVICE_COUNT];
+static uint32_t   m_cb_count[TEST_DEVICE_COUNT];
+
+static dk_twi_mngr_config_t const m_twi_configs[] = {
+  {.scl = 26, .sda = 27, .frequency = NRF_TWI_FREQ_400K, .interrupt_priority = 6, .hold_bus_uninit = false},
+  {.scl = 24, .sda = 25, .frequency = NRF_TWI_FREQ_400K, .interrupt_priority = 6, .hold_bus_uninit = false},
+};
+
+static void twi_mngr_callback(ret_code_t result, uint8_t evt, dk_twi_mngr_transfer_t *p_transfer, void *p_user_data)
+{
+    UNUSED_PARAMETER(evt);
+    UNUSED_PARAMETER(p_transfer);
+
+    uint8_t device = (uint8_t)(uintptr_t)p_user_data;
+
+    m_cb_result[device] = result;
+    m_cb_count[device]++;
+}
+
+static void setup(void)
+{
+    for (uint8_t i = 0; i < TEST_DEVICE_COUNT; i++)
+    {
+        m_cb_result[i] = NRF_SUCCESS;
+        m_cb_count[i]  = 0;
+    }
+
+    // Every byte a slave sends is stretched, so a transfer keeps its bus busy for a while.
+    dk_host_twi_regfile_init(&m_regfile_a, TEST_SLAVE_ADDRESS);
+    dk_host_twi_regfile_init(&m_regfile_b, TEST_SLAVE_ADDRESS);
+    m_regfile_a.slave.stretch_ns = TEST_STRETCH_NS;
+    m_regfile_b.slave.stretch_ns = TEST_STRETCH_NS;
+    dk_host_twi_slave_attach(0, &m_regfile_a.slave);
+    dk_host_twi_slave_attach(1, &m_regfile_b.slave);
+
+    TEST_ASSERT_EQUAL(NRF_SUCCESS, app_timer_init());
+    TEST_ASSERT_EQUAL(NRF_SUCCESS, dk_twi_bus_group_init(&m_twi_bus_group, m_twi_configs));
+}
+
+static void test_device_bus_mapping(void)
+{
+    setup();
+
+    TEST_ASSERT(dk_twi_bus_group_mngr_get(&m_twi_bus_group, TEST_DEVICE_A) == &m_twi_bus_0);
+    TEST_ASSERT(dk_twi_bus_group_mngr_get(&m_twi_bus_group, TEST_DEVICE_B) == &m_twi_bus_1);
+
+    uint8_t tx_a[] = {0x10, 0xA1};
+    uint8_t tx_b[] = {0x10, 0xB1};
+
+    dk_twi_mngr_transfer_t write_a = {
+      .transfer_description = DK_TWI_MNGR_XFER_DESC_TX(TEST_SLAVE_ADDRESS, tx_a, sizeof(tx_a)),
+    };
+    dk_twi_mngr_transfer_t write_b = {
+      .transfer_description = DK_TWI_MNGR_XFER_DESC_TX(TEST_SLAVE_ADDRESS, tx_b, sizeof(tx_b)),
+    };
+
+    // Both devices share the address, each write only reaches the slave on the bus of its device.
+    TEST_ASSERT_EQUAL(NRF_SUCCESS, dk_twi_bus_group_perform(&m_twi_bus_group, TEST_DEVICE_A, &write_a, 10));
+    TEST_ASSERT_EQUAL(NRF_SUCCESS, dk_twi_bus_group_perform(&m_twi_bus_group, TEST_DEVICE_B, &write_b, 10));
+    TEST_ASSERT_EQUAL(0xA1, m_regfile_a.regs[0x10]);
+    TEST_ASSERT_EQUAL(0xB1, m_regfile_b.regs[0x10]);
+    TEST_ASSERT_EQUAL(1, dk_host_twi_xfer_count_get(0));
+    TEST_ASSERT_EQUAL(1, dk_host_twi_xfer_count_get(1));
+
+    dk_twi_bus_group_deinit(&m_twi_bus_group);
+}
+
+static void test_buses_in_parallel(void)
+{
+    setup();
+
+    uint8_t reg = 0x00;
+    uint8_t rx_a[8];
+    uint8_t rx_b[8];
+
+    dk_twi_mngr_transaction_t read_a = {
+      .callback       = twi_mngr_callback,
+      .p_user_data    = (void *)(uintptr_t)TEST_DEVICE_A,
+      .transfer       = {.transfer_description =
+                           DK_TWI_MNGR_XFER_DESC_TXRX(TEST_SLAVE_ADDRESS, &reg, sizeof(reg), rx_a, sizeof(rx_a))},
+      .buff_ownership = DK_TWI_MNGR_BUFF_BORROWED,
+    };
+    dk_twi_mngr_transaction_t read_b = read_a;
+
+    read_b.p_user_data                                   = (void *)(uintptr_t)TEST_DEVICE_B;
+    read_b.transfer.transfer_description.p_secondary_buf = rx_b;
+
+    // Time of a single read, every read byte is stretched.
+    uint64_t start = dk_host_time_get();
+    TEST_ASSERT_EQUAL(NRF_SUCCESS, dk_twi_bus_group_schedule(&m_twi_bus_group, TEST_DEVICE_A, &read_a));
+    while (!dk_twi_bus_group_is_idle(&m_twi_bus_group))
+    {
+        dk_host_wait_for_event();
+    }
+    uint64_t single = dk_host_time_get() - start;
+    TEST_ASSERT(single >= (sizeof(rx_a) * TEST_STRETCH_NS));
+
+    start = dk_host_time_get();
+    TEST_ASSERT_EQUAL(NRF_SUCCESS, dk_twi_bus_group_schedule(&m_twi_bus_group, TEST_DEVICE_A, &read_a));
+    TEST_ASSERT_EQUAL(NRF_SUCCESS, dk_twi_bus_group_schedule(&m_twi_bus_group, TEST_DEVICE_B, &read_b));
+
+    // Both buses are busy at once.
+    TEST_ASSERT(!dk_twi_mngr_is_idle(&m_twi_bus_0));
+    TEST_ASSERT(!dk_twi_mngr_is_idle(&m_twi_bus_1));
+
+    while (!dk_twi_bus_group_is_idle(&m_twi_bus_group))
+    {
+        dk_host_wait_for_event();
+    }
+
+    // The reads overlapped instead of running one after another.
+    TEST_ASSERT(dk_host_time_get() - start < (single * 3) / 2);
+    TEST_ASSERT_EQUAL(2, m_cb_count[TEST_DEVICE_A]);
+    TEST_ASSERT_EQUAL(1, m_cb_count[TEST_DEVICE_B]);
+    TEST_ASSERT_EQUAL(NRF_SUCCESS, m_cb_result[TEST_DEVICE_A]);
+    TEST_ASSERT_EQUAL(NRF_SUCCESS, m_cb_result[TEST_DEVICE_B]);
+
+    dk_twi_bus_group_deinit(&m_twi_bus_group);
+}
+
+static void test_device_out_of_range(void)
+{
+    setup();
+
+    uint8_t tx_buffer[] = {0x20, 0x01};
+
+    dk_twi_mngr_transfer_t write = {
+      .transfer_description = DK_TWI_MNGR_XFER_DESC_TX(TEST_SLAVE_ADDRESS, tx_buffer, sizeof(tx_buffer)),
+    };
+    dk_twi_mngr_transaction_t transaction = {
+      .callback       = twi_mngr_callback,
+      .transfer       = write,
+      .buff_ownership = DK_TWI_MNGR_BUFF_BORROWED,
+    };
+
+    TEST_ASSERT(dk_twi_bus_group_mngr_get(&m_twi_bus_group, TEST_DEVICE_COUNT) == NULL);
+    TEST_ASSERT_EQUAL(NRF_ERROR_INVALID_PARAM,
+                      dk_twi_bus_group_schedule(&m_twi_bus_group, TEST_DEVICE_COUNT, &transaction));
+    TEST_ASSERT_EQUAL(NRF_ERROR_INVALID_PARAM,
+                      dk_twi_bus_group_perform(&m_twi_bus_group, TEST_DEVICE_COUNT, &write, 10));
+    TEST_ASSERT(dk_twi_bus_group_data_buffer_alloc(&m_twi_bus_group, TEST_DEVICE_COUNT, 2) == NULL);
+
+    // Nothing was put on either bus.
+    TEST_ASSERT_EQUAL(0, dk_host_twi_xfer_count_get(0));
+    TEST_ASSERT_EQUAL(0, dk_host_twi_xfer_count_get(1));
+
+    dk_twi_bus_group_deinit(&m_twi_bus_group);
+
+    // A device mapped to a bus that is not in the group is rejected before any bus is initialized.
+    TEST_ASSERT_EQUAL(NRF_ERROR_INVALID_PARAM, dk_twi_bus_group_init(&m_twi_bus_group_no_bus, m_twi_configs));
+}
+
+int main(void)
+{
+    TEST_RUN(test_device_bus_mapping);
+    TEST_RUN(test_buses_in_parallel);
+    TEST_RUN(test_device_out_of_range);
+
+    return 0;
+}
@@ -0,0 +1,273 @@
+/**
+ * @file        test_dk_twi_drivers.c
+ * @author      Danius Kalvaitis (danius.kalvaitis@gmail.com)
+ * @brief       Host tests of the TWI device drivers against the simulated devices.
+ * @version     0.1
+ * @date        2026-10-17
+ *
+ * @copyright   Copyright (c) Danius Kalvaitis 2026 All rights reserved
+ *
+ */
+
+#include <math.h>
+#include <string.h>
+
+#include "app_scheduler.h"
+#include "app_timer.h"
+#include "dk_host_sim.h"
+#include "dk_host_test.h"
+#include "dk_host_twi_models.h"
+#include "dk_twi_mngr.h"
+#include "is31fl3206.h"
+#include "lp5024.h"
+#include "lsm9ds1.h"
+#include "mlx90615.h"
+#include "tca9548a.h"
+#include "tlv320aic3106.h"
+
+#define IS31FL3206_ADDRESS    0x6D
+#define LSM9DS1_AG_ADDRESS    0x6B
+#define LSM9DS1_MAG_ADDRESS   0x1E
+#define LP5024_ADDRESS        0x28
+#define MLX90615_ADDRESS      0x5B
+#define TCA9548A_ADDRESS      0x70
+#define TLV320AIC3106_ADDRESS 0x18
+#define MUXED_ADDRESS         0x44
+
+DK_TWI_MNGR_DEF(m_twi_mngr, 4, 4, 4, 0, 4, 2);
+
+// LP5024 still talks to its own instance directly, it is not a TWI manager client.
+static nrfx_twi_t m_twi1 = NRFX_TWI_INSTANCE(1);
+
+IS31FL3206_DEF(m_is31fl3206, &m_twi_mngr, IS31FL3206_ADDRESS);
+MLX90615_DEF(m_mlx90615, &m_twi_mngr);
+TCA9548A_DEF(m_tca9548a, &m_twi_mngr, TCA9548A_ADDRESS);
+TLV320AIC3106_DEF(m_tlv320aic3106, &m_twi_mngr, TLV320AIC3106_ADDRESS);
+
+LSM9DS1_DEF(m_lsm9ds1, &m_twi_mngr, TCA9548A_CHANNEL6, LSM9DS1_AG_ADDRESS, LSM9DS1_MAG_ADDRESS);
+LP5024_DEF(m_lp5024, &m_twi1, LP5024_ADDRESS);
+
+static mlx90615_evt_t m_mlx90615_evt;
+static uint32_t       m_mlx90615_evt_count;
+
+static dk_twi_mngr_config_t const m_twi_config = {
+  .scl                = 26,
+  .sda                = 27,
+  .frequency          = NRF_TWI_FREQ_400K,
+  .interrupt_priority = 6,
+  .hold_bus_uninit    = false,
+};
+
+static nrfx_twi_config_t const m_twi1_config = {
+  .scl                = 28,
+  .sda                = 29,
+  .frequency          = NRF_TWI_FREQ_400K,
+  .interrupt_priority = 6,
+  .hold_bus_uninit    = false,
+};
+
+static void mlx90615_evt_handler(mlx90615_evt_t *p_evt)
+{
+    m_mlx90615_evt = *p_evt;
+    m_mlx90615_evt_count++;
+}
+
+static void mngr_setup(void)
+{
+    TEST_ASSERT_EQUAL(NRF_SUCCESS, app_timer_init());
+    TEST_ASSERT_EQUAL(NRF_SUCCESS, dk_twi_mngr_init(&m_twi_mngr, &m_twi_config));
+}
+
+static void idle_wait(void)
+{
+    while (!dk_twi_mngr_is_idle(&m_twi_mngr))
+    {
+        dk_host_wait_for_event();
+    }
+}
+
+static void test_is31fl3206_pwm_order(void)
+{
+    static dk_host_twi_is31fl3206_t is31fl3206;
+
+    dk_host_twi_is31fl3206_init(&is31fl3206, IS31FL3206_ADDRESS);
+    dk_host_twi_slave_attach(0, &is31fl3206.regfile.slave);
+    mngr_setup();
+
+    is31fl3206_all_out_pwm_t all_out_pwm;
+    memset(all_out_pwm.pwm, 0x20, sizeof(all_out_pwm.pwm));
+
+    // The first write occupies the bus, the rest stays queued until the PWM writes are all scheduled.
+    TEST_ASSERT_EQUAL(NRF_SUCCESS, is31fl3206_set_out_frequency(&m_is31fl3206, IS31FL3206_OFS_24KHZ));
+    TEST_ASSERT_EQUAL(NRF_SUCCESS, is31fl3206_set_out_pwm(&m_is31fl3206, IS31FL3206_OUT1, 0x10));
+    TEST_ASSERT_EQUAL(NRF_SUCCESS, is31fl3206_set_all_out_pwm(&m_is31fl3206, &all_out_pwm));
+    TEST_ASSERT_EQUAL(NRF_SUCCESS, is31fl3206_set_out_pwm(&m_is31fl3206, IS31FL3206_OUT1, 0x30));
+    TEST_ASSERT_EQUAL(NRF_SUCCESS, is31fl3206_update(&m_is31fl3206));
+    idle_wait();
+
+    // The last OUT1 write must not replace the first one, which went out before the block write.
+    TEST_ASSERT_EQUAL(1, is31fl3206.update_count);
+    TEST_ASSERT_EQUAL(0x30, is31fl3206.pwm_out[IS31FL3206_OUT1]);
+    TEST_ASSERT_EQUAL(0x20, is31fl3206.pwm_out[IS31FL3206_OUT2]);
+
+    dk_twi_mngr_deinit(&m_twi_mngr);
+}
+
+static void test_lsm9ds1_init(void)
+{
+    static dk_host_twi_tca9548a_t tca9548a;
+    static dk_host_twi_regfile_t  ag;
+    static dk_host_twi_regfile_t  mag;
+
+    // The sensor sits behind the mux, the manager selects its channel before each access.
+    dk_host_twi_tca9548a_init(&tca9548a, TCA9548A_ADDRESS);
+    dk_host_twi_lsm9ds1_init(&ag, &mag, LSM9DS1_AG_ADDRESS, LSM9DS1_MAG_ADDRESS);
+    dk_host_twi_tca9548a_attach(&tca9548a, 6, &ag.slave);
+    dk_host_twi_tca9548a_attach(&tca9548a, 6, &mag.slave);
+    dk_host_twi_slave_attach(0, &tca9548a.slave);
+    mngr_setup();
+
+    TEST_ASSERT_EQUAL(NRF_SUCCESS, tca9548a_init(&m_tca9548a));
+
+    TEST_ASSERT(lsm9ds1_init(&m_lsm9ds1));
+    TEST_ASSERT_EQUAL(TCA9548A_CHANNEL6, tca9548a.control);
+    TEST_ASSERT_EQUAL(DK_HOST_TWI_LSM9DS1_AG_WHO_AM_I, ag.regs[0x0F]);
+    TEST_ASSERT_EQUAL(DK_HOST_TWI_LSM9DS1_MAG_WHO_AM_I, mag.regs[0x0F]);
+
+    // A wrong WHO_AM_I is detected.
+    mag.regs[0x0F] = 0x00;
+    TEST_ASSERT(!lsm9ds1_init(&m_lsm9ds1));
+
+    dk_twi_mngr_deinit(&m_twi_mngr);
+}
+
+static void test_lp5024_broadcast_init(void)
+{
+    static dk_host_twi_regfile_t lp5024;
+
+    dk_host_twi_lp5024_init(&lp5024, LP5024_ADDRESS);
+    dk_host_twi_slave_attach(1, &lp5024.slave);
+
+    // Without an event handler the driver runs in blocking mode.
+    TEST_ASSERT_EQUAL(NRF_SUCCESS, nrfx_twi_init(&m_twi1, &m_twi1_config, NULL, NULL));
+    nrfx_twi_enable(&m_twi1);
+
+    lp5024.regs[0x07] = 0x55;
+
+    lp5024_config_t config = {
+      .device_config0 = {.chip_en = true},
+      .led_config0    = 0x0F,
+    };
+    TEST_ASSERT_EQUAL(NRF_SUCCESS, lp5024_init(&m_lp5024, true, &config));
+
+    // The reset restored the brightness register, the configuration was written through auto increment.
+    TEST_ASSERT_EQUAL(0x00, lp5024.regs[0x07]);
+    TEST_ASSERT_EQUAL(0x0F, lp5024.regs[0x02]);
+    TEST_ASSERT(lp5024.regs[0x00] != 0);
+
+    nrfx_twi_uninit(&m_twi1);
+}
+
+static void test_mlx90615_read_temp(void)
+{
+    static dk_host_twi_mlx90615_t mlx90615;
+
+    dk_host_twi_mlx90615_init(&mlx90615, MLX90615_ADDRESS);
+    dk_host_twi_mlx90615_temp_set(&mlx90615, 25.0f, 36.6f);
+    dk_host_twi_slave_attach(0, &mlx90615.slave);
+    mngr_setup();
+
+    m_mlx90615_evt_count = 0;
+    TEST_ASSERT_EQUAL(NRF_SUCCESS, mlx90615_init(&m_mlx90615, mlx90615_evt_handler));
+
+    TEST_ASSERT_EQUAL(NRF_SUCCESS, mlx90615_read_obj_temp_float(&m_mlx90615));
+    idle_wait();
+    app_sched_execute();
+
+    TEST_ASSERT_EQUAL(1, m_mlx90615_evt_count);
+    TEST_ASSERT_EQUAL(MLX90615_EVT_TYPE_OBJ_TEMP_FLOAT_READY, m_mlx90615_evt.type);
+    TEST_ASSERT(fabsf(m_mlx90615_evt.params.float_temp - 36.6f) < 0.02f);
+
+    // A sleeping sensor does not acknowledge its address.
+    TEST_ASSERT_EQUAL(NRF_SUCCESS, mlx90615_sleep_mode_enter(&m_mlx90615));
+    idle_wait();
+    app_sched_execute();
+    TEST_ASSERT(mlx90615.asleep);
+    TEST_ASSERT_EQUAL(NRF_ERROR_INTERNAL, mlx90615_init(&m_mlx90615, mlx90615_evt_handler));
+
+    dk_twi_mngr_deinit(&m_twi_mngr);
+}
+
+static void test_tca9548a_channel(void)
+{
+    static dk_host_twi_tca9548a_t tca9548a;
+    static dk_host_twi_regfile_t  muxed;
+
+    dk_host_twi_tca9548a_init(&tca9548a, TCA9548A_ADDRESS);
+    dk_host_twi_regfile_init(&muxed, MUXED_ADDRESS);
+    dk_host_twi_tca9548a_attach(&tca9548a, 5, &muxed.slave);
+    dk_host_twi_slave_attach(0, &tca9548a.slave);
+    mngr_setup();
+
+    TEST_ASSERT_EQUAL(NRF_SUCCESS, tca9548a_init(&m_tca9548a));
+
+    uint8_t write[] = {0x10, 0x3C};
+
+    // The slave is not reachable while its channel is disabled.
+    dk_twi_mngr_transfer_t transfer = DK_TWI_MNGR_TX(MUXED_ADDRESS, write, sizeof(write), 0);
+    TEST_ASSERT_EQUAL(NRF_ERROR_INTERNAL, dk_twi_mngr_perform(&m_twi_mngr, &transfer, dk_host_wait_for_event));
+
+    dk_twi_mngr_transaction_t transaction = {
+      .transfer       = DK_TWI_MNGR_TX(MUXED_ADDRESS, write, sizeof(write), 0),
+      .mux_channels   = TCA9548A_CHANNEL5,
+      .buff_ownership = DK_TWI_MNGR_BUFF_BORROWED,
+    };
+    TEST_ASSERT_EQUAL(NRF_SUCCESS, dk_twi_mngr_schedule(&m_twi_mngr, &transaction));
+    idle_wait();
+
+    TEST_ASSERT_EQUAL(TCA9548A_CHANNEL5, tca9548a.control);
+    TEST_ASSERT_EQUAL(0x3C, muxed.regs[0x10]);
+
+    dk_twi_mngr_deinit(&m_twi_mngr);
+}
+
+static void test_tlv320aic3106_pages(void)
+{
+    static dk_host_twi_regfile_t tlv320aic3106;
+
+    dk_host_twi_tlv320aic3106_init(&tlv320aic3106, TLV320AIC3106_ADDRESS);
+    dk_host_twi_slave_attach(0, &tlv320aic3106.slave);
+    mngr_setup();
+
+    tlv320aic3106.regs[0x07] = 0x12;
+
+    TEST_ASSERT_EQUAL(NRF_SUCCESS, tlv320aic3106_init(&m_tlv320aic3106, (tlv320aic3106_evt_handler_t)1));
+    TEST_ASSERT_EQUAL(0x00, tlv320aic3106.regs[0x07]);
+
+    uint8_t page_select[] = {0x00, 0x01};
+    uint8_t coefficient[] = {0x05, 0xAB};
+
+    dk_twi_mngr_transfer_t const transfers[] = {
+      DK_TWI_MNGR_TX(TLV320AIC3106_ADDRESS, page_select, sizeof(page_select), 0),
+      DK_TWI_MNGR_TX(TLV320AIC3106_ADDRESS, coefficient, sizeof(coefficient), 0),
+    };
+    TEST_ASSERT_EQUAL(NRF_SUCCESS,
+                      dk_twi_mngr_perform_sequence_timeout(&m_twi_mngr, transfers, ARRAY_SIZE(transfers), 10));
+
+    TEST_ASSERT_EQUAL(0xAB, *dk_host_twi_regfile_reg_get(&tlv320aic3106, 1, 0x05));
+    TEST_ASSERT_EQUAL(0x00, *dk_host_twi_regfile_reg_get(&tlv320aic3106, 0, 0x05));
+
+    dk_twi_mngr_deinit(&m_twi_mngr);
+}
+
+int main(void)
+{
+    TEST_RUN(test_is31fl3206_pwm_order);
+    TEST_RUN(test_lsm9ds1_init);
+    TEST_RUN(test_lp5024_broadcast_init);
+    TEST_RUN(test_mlx90615_read_temp);
+    TEST_RUN(test_tca9548a_channel);
+    TEST_RUN(test_tlv320aic3106_pages);
+
+    return 0;
+}
@@ -0,0 +1,645 @@
+/**
+ * @file        test_dk_twi_mngr.c
+ * @author      Danius Kalvaitis (danius.kalvaitis@gmail.com)
+ * @brief       Host tests of the TWI manager on the simulated bus.
+ * @version     0.1
+ * @date        2026-10-17
+ *
+ * @copyright   Copyright (c) Danius Kalvaitis 2026 All rights reserved
+ *
+ */
+
+#include "app_timer.h"
+#include "dk_host_sim.h"
+#include "dk_host_test.h"
+#include "dk_host_twi.h"
+#include "dk_twi_mngr.h"
+
+#define TEST_SLAVE_ADDRESS  0x6A
+#define TEST_ABSENT_ADDRESS 0x50
+#define TEST_OTHER_ADDRESS  0x51
+
+DK_TWI_MNGR_DEF(m_twi_mngr, 4, 4, 4, 0, 4, 2);
+
+static dk_host_twi_regfile_t m_regfile;
+
+static ret_code_t m_cb_result;
+static uint32_t   m_cb_count;
+
+static dk_twi_mngr_config_t const m_twi_config = {
+  .scl                = 26,
+  .sda                = 27,
+  .frequency          = NRF_TWI_FREQ_400K,
+  .interrupt_priority = 6,
+  .hold_bus_uninit    = false,
+};
+
+static void twi_mngr_callback(ret_code_t result, uint8_t evt, dk_twi_mngr_transfer_t *p_transfer, void *p_user_data)
+{
+    UNUSED_PARAMETER(evt);
+    UNUSED_PARAMETER(p_transfer);
+    UNUSED_PARAMETER(p_user_data);
+
+    m_cb_result = result;
+    m_cb_count++;
+}
+
+static void setup(void)
+{
+    m_cb_result = NRF_SUCCESS;
+    m_cb_count  = 0;
+
+    dk_host_twi_regfile_init(&m_regfile, TEST_SLAVE_ADDRESS);
+    dk_host_twi_slave_attach(0, &m_regfile.slave);
+
+    TEST_ASSERT_EQUAL(NRF_SUCCESS, app_timer_init());
+    TEST_ASSERT_EQUAL(NRF_SUCCESS, dk_twi_mngr_init(&m_twi_mngr, &m_twi_config));
+}
+
+static void test_perform_write_read(void)
+{
+    setup();
+
+    uint8_t tx_buffer[] = {0x10, 0xA5, 0x5A};
+
+    dk_twi_mngr_transfer_t write = {
+      .transfer_description = DK_TWI_MNGR_XFER_DESC_TX(TEST_SLAVE_ADDRESS, tx_buffer, sizeof(tx_buffer)),
+    };
+    TEST_ASSERT_EQUAL(NRF_SUCCESS, dk_twi_mngr_perform(&m_twi_mngr, &write, dk_host_wait_for_event));
+    TEST_ASSERT_EQUAL(0xA5, m_regfile.regs[0x10]);
+    TEST_ASSERT_EQUAL(0x5A, m_regfile.regs[0x11]);
+
+    uint8_t reg          = 0x10;
+    uint8_t rx_buffer[2] = {0};
+
+    dk_twi_mngr_transfer_t read = {
+      .transfer_description =
+        DK_TWI_MNGR_XFER_DESC_TXRX(TEST_SLAVE_ADDRESS, &reg, sizeof(reg), rx_buffer, sizeof(rx_buffer)),
+    };
+    TEST_ASSERT_EQUAL(NRF_SUCCESS, dk_twi_mngr_perform(&m_twi_mngr, &read, dk_host_wait_for_event));
+    TEST_ASSERT_EQUAL(0xA5, rx_buffer[0]);
+    TEST_ASSERT_EQUAL(0x5A, rx_buffer[1]);
+
+    dk_twi_mngr_deinit(&m_twi_mngr);
+}
+
+static void test_schedule_pool_buffer(void)
+{
+    setup();
+
+    uint8_t *p_buffer = dk_twi_mngr_data_buffer_alloc(&m_twi_mngr, 2);
+    TEST_ASSERT(p_buffer != NULL);
+    p_buffer[0] = 0x20;
+    p_buffer[1] = 0x42;
+
+    dk_twi_mngr_transaction_t transaction = {
+      .callback = twi_mngr_callback,
+      .transfer = {.transfer_description = DK_TWI_MNGR_XFER_DESC_TX(TEST_SLAVE_ADDRESS, p_buffer, 2)},
+    };
+    TEST_ASSERT_EQUAL(NRF_SUCCESS, dk_twi_mngr_schedule(&m_twi_mngr, &transaction));
+    TEST_ASSERT_EQUAL(0, m_cb_count);
+
+    while (!dk_twi_mngr_is_idle(&m_twi_mngr))
+    {
+        dk_host_wait_for_event();
+    }
+
+    TEST_ASSERT_EQUAL(1, m_cb_count);
+    TEST_ASSERT_EQUAL(NRF_SUCCESS, m_cb_result);
+    TEST_ASSERT_EQUAL(0x42, m_regfile.regs[0x20]);
+    TEST_ASSERT_EQUAL(1, dk_host_twi_xfer_count_get(0));
+
+    dk_twi_mngr_deinit(&m_twi_mngr);
+}
+
+static void test_address_nack(void)
+{
+    setup();
+
+    uint8_t tx_buffer[] = {0x00, 0x01};
+
+    dk_twi_mngr_transfer_t write = {
+      .transfer_description = DK_TWI_MNGR_XFER_DESC_TX(TEST_ABSENT_ADDRESS, tx_buffer, sizeof(tx_buffer)),
+    };
+    // The manager reports any failed transfer as an internal error, like nrf_twi_mngr.
+    TEST_ASSERT_EQUAL(NRF_ERROR_INTERNAL, dk_twi_mngr_perform(&m_twi_mngr, &write, dk_host_wait_for_event));
+
+    dk_twi_mngr_deinit(&m_twi_mngr);
+}
+
+static void test_perform_timeout(void)
+{
+    setup();
+
+    uint8_t reg          = 0x00;
+    uint8_t rx_buffer[4] = {0};
+
+    dk_twi_mngr_transfer_t read = {
+      .transfer_description =
+        DK_TWI_MNGR_XFER_DESC_TXRX(TEST_SLAVE_ADDRESS, &reg, sizeof(reg), rx_buffer, sizeof(rx_buffer)),
+    };
+    m_regfile.regs[0x03] = 0x77;
+
+    uint64_t start = dk_host_time_get();
+    TEST_ASSERT_EQUAL(NRF_SUCCESS, dk_twi_mngr_perform_timeout(&m_twi_mngr, &read, 10));
+    TEST_ASSERT_EQUAL(0x77, rx_buffer[3]);
+    TEST_ASSERT(dk_host_time_get() - start < 10000000);
+
+    dk_twi_mngr_deinit(&m_twi_mngr);
+}
+
+static void test_perform_timeout_expired(void)
+{
+    setup();
+
+    uint8_t tx_buffer[] = {0x60, 0x33};
+
+    dk_twi_mngr_transfer_t write = {
+      .transfer_description = DK_TWI_MNGR_XFER_DESC_TX(TEST_SLAVE_ADDRESS, tx_buffer, sizeof(tx_buffer)),
+    };
+
+    // The stuck transfer is aborted by the perform timeout, well before the bus watchdog would expire.
+    dk_host_twi_fault_inject(0, TEST_SLAVE_ADDRESS, DK_HOST_TWI_FAULT_STUCK, 1);
+
+    uint64_t start = dk_host_time_get();
+    TEST_ASSERT_EQUAL(NRF_ERROR_TIMEOUT, dk_twi_mngr_perform_timeout(&m_twi_mngr, &write, 5));
+    TEST_ASSERT(dk_host_time_get() - start < (DK_TWI_MNGR_TRANSACTION_TIMEOUT_MS * 1000000ULL));
+
+    // The timeout of the previous call does not leak into the next one.
+    TEST_ASSERT_EQUAL(NRF_SUCCESS, dk_twi_mngr_perform_timeout(&m_twi_mngr, &write, 5));
+    TEST_ASSERT_EQUAL(0x33, m_regfile.regs[0x60]);
+
+    dk_twi_mngr_deinit(&m_twi_mngr);
+}
+
+static void test_perform_timeout_watchdog_expired(void)
+{
+    setup();
+
+    uint8_t tx_buffer[] = {0x68, 0x44};
+
+    dk_twi_mngr_transfer_t write = {
+      .transfer_description = DK_TWI_MNGR_XFER_DESC_TX(TEST_SLAVE_ADDRESS, tx_buffer, sizeof(tx_buffer)),
+    };
+
+    // The perform timeout and the bus watchdog of the stuck transfer expire on the same tick, whichever finishes the
+    // transaction has to leave the result to the waiting call.
+    dk_host_twi_fault_inject(0, TEST_SLAVE_ADDRESS, DK_HOST_TWI_FAULT_STUCK, 1);
+
+    uint64_t start = dk_host_time_get();
+    TEST_ASSERT_EQUAL(NRF_ERROR_TIMEOUT,
+                      dk_twi_mngr_perform_timeout(&m_twi_mngr, &write, DK_TWI_MNGR_TRANSACTION_TIMEOUT_MS));
+    TEST_ASSERT(dk_host_time_get() - start >= (DK_TWI_MNGR_TRANSACTION_TIMEOUT_MS * 1000000ULL));
+    TEST_ASSERT(dk_twi_mngr_is_idle(&m_twi_mngr));
+    TEST_ASSERT(!dk_host_twi_is_stuck(0));
+
+    // Nothing refers to the stack frame of the finished call anymore.
+    TEST_ASSERT_EQUAL(NRF_SUCCESS, dk_twi_mngr_perform_timeout(&m_twi_mngr, &write, 5));
+    TEST_ASSERT_EQUAL(0x44, m_regfile.regs[0x68]);
+
+    dk_twi_mngr_deinit(&m_twi_mngr);
+}
+
+static void test_data_nack_fault(void)
+{
+    setup();
+
+    uint8_t tx_buffer[] = {0x30, 0x11};
+
+    dk_twi_mngr_transfer_t write = {
+      .transfer_description = DK_TWI_MNGR_XFER_DESC_TX(TEST_SLAVE_ADDRESS, tx_buffer, sizeof(tx_buffer)),
+    };
+
+    dk_host_twi_fault_inject(0, TEST_SLAVE_ADDRESS, DK_HOST_TWI_FAULT_DATA_NACK, 1);
+    TEST_ASSERT_EQUAL(NRF_ERROR_INTERNAL, dk_twi_mngr_perform(&m_twi_mngr, &write, dk_host_wait_for_event));
+    TEST_ASSERT_EQUAL(0x00, m_regfile.regs[0x30]);
+
+    // The fault only applied to one transfer.
+    TEST_ASSERT_EQUAL(NRF_SUCCESS, dk_twi_mngr_perform(&m_twi_mngr, &write, dk_host_wait_for_event));
+    TEST_ASSERT_EQUAL(0x11, m_regfile.regs[0x30]);
+
+    dk_twi_mngr_deinit(&m_twi_mngr);
+}
+
+static void test_stuck_bus_recovery(void)
+{
+    setup();
+
+    uint8_t tx_buffer[] = {0x40, 0x22};
+
+    dk_twi_mngr_transaction_t transaction = {
+      .callback       = twi_mngr_callback,
+      .transfer       = {.transfer_description = DK_TWI_MNGR_XFER_DESC_TX(TEST_SLAVE_ADDRESS, tx_buffer, 2)},
+      .timeout_ms     = 5,
+      .buff_ownership = DK_TWI_MNGR_BUFF_BORROWED,
+    };
+
+    dk_host_twi_fault_inject(0, TEST_SLAVE_ADDRESS, DK_HOST_TWI_FAULT_STUCK, 1);
+    TEST_ASSERT_EQUAL(NRF_SUCCESS, dk_twi_mngr_schedule(&m_twi_mngr, &transaction));
+
+    while (!dk_twi_mngr_is_idle(&m_twi_mngr))
+    {
+        dk_host_wait_for_event();
+    }
+
+    // The watchdog aborted the transaction and clocked the slave free.
+    TEST_ASSERT_EQUAL(1, m_cb_count);
+    TEST_ASSERT_EQUAL(NRF_ERROR_TIMEOUT, m_cb_result);
+    TEST_ASSERT(!dk_host_twi_is_stuck(0));
+
+    dk_twi_mngr_transfer_t write = transaction.transfer;
+    TEST_ASSERT_EQUAL(NRF_SUCCESS, dk_twi_mngr_perform(&m_twi_mngr, &write, dk_host_wait_for_event));
+    TEST_ASSERT_EQUAL(0x22, m_regfile.regs[0x40]);
+
+    dk_twi_mngr_deinit(&m_twi_mngr);
+}
+
+static void test_clock_stretch(void)
+{
+    setup();
+
+    uint8_t tx_buffer[] = {0x50, 0x01, 0x02, 0x03};
+
+    dk_twi_mngr_transfer_t write = {
+      .transfer_description = DK_TWI_MNGR_XFER_DESC_TX(TEST_SLAVE_ADDRESS, tx_buffer, sizeof(tx_buffer)),
+    };
+
+    uint64_t start = dk_host_time_get();
+    TEST_ASSERT_EQUAL(NRF_SUCCESS, dk_twi_mngr_perform(&m_twi_mngr, &write, dk_host_wait_for_event));
+    uint64_t plain_ns = dk_host_time_get() - start;
+
+    m_regfile.slave.stretch_ns = 10000;
+
+    start = dk_host_time_get();
+    TEST_ASSERT_EQUAL(NRF_SUCCESS, dk_twi_mngr_perform(&m_twi_mngr, &write, dk_host_wait_for_event));
+
+    // Every data byte is stretched by the slave.
+    TEST_ASSERT_EQUAL(plain_ns + (sizeof(tx_buffer) * 10000), dk_host_time_get() - start);
+
+    dk_twi_mngr_deinit(&m_twi_mngr);
+}
+
+static void test_superseded_queue_wait(void)
+{
+    setup();
+
+    // A tick left unstamped by the manager would count as a wait of a whole second.
+    dk_host_time_advance(1000000000ULL);
+
+    uint8_t busy_buffer[] = {0x70, 0x01, 0x02, 0x03};
+
+    dk_twi_mngr_transaction_t busy = {
+      .transfer       = {.transfer_description = DK_TWI_MNGR_XFER_DESC_TX(TEST_SLAVE_ADDRESS, busy_buffer, 4)},
+      .buff_ownership = DK_TWI_MNGR_BUFF_BORROWED,
+    };
+    m_regfile.slave.stretch_ns = 100000;
+    TEST_ASSERT_EQUAL(NRF_SUCCESS, dk_twi_mngr_schedule(&m_twi_mngr, &busy));
+
+    for (uint8_t value = 0x10; value <= 0x20; value += 0x10)
+    {
+        uint8_t *p_buffer = dk_twi_mngr_data_buffer_alloc(&m_twi_mngr, 2);
+        TEST_ASSERT(p_buffer != NULL);
+        p_buffer[0] = 0x78;
+        p_buffer[1] = value;
+
+        dk_twi_mngr_transaction_t write = {
+          .transfer = {.transfer_description = DK_TWI_MNGR_XFER_DESC_TX(TEST_SLAVE_ADDRESS, p_buffer, 2)},
+          .flags    = DK_TWI_MNGR_FLAG_SUPERSEDE,
+        };
+        TEST_ASSERT_EQUAL(NRF_SUCCESS, dk_twi_mngr_schedule(&m_twi_mngr, &write));
+    }
+
+    while (!dk_twi_mngr_is_idle(&m_twi_mngr))
+    {
+        dk_host_wait_for_event();
+    }
+
+    dk_twi_mngr_stats_t stats;
+    dk_twi_mngr_stats_get(&m_twi_mngr, &stats);
+
+    // The second write replaced the first one in the queue.
+    TEST_ASSERT_EQUAL(0x20, m_regfile.regs[0x78]);
+    TEST_ASSERT_EQUAL(2, dk_host_twi_xfer_count_get(0));
+    TEST_ASSERT_EQUAL(0, stats.queue_wait_hist[DK_TWI_MNGR_STATS_HIST_BINS - 1]);
+
+    dk_twi_mngr_deinit(&m_twi_mngr);
+}
+
+static void test_shared_read_barrier(void)
+{
+    setup();
+
+    m_regfile.regs[0x08] = 0x11;
+
+    uint8_t reg             = 0x08;
+    uint8_t first_value     = 0;
+    uint8_t follower_value  = 0;
+    uint8_t write_buffer[2] = {0x08, 0x22};
+
+    dk_twi_mngr_transaction_t first = {
+      .transfer =
+        {.transfer_description = DK_TWI_MNGR_XFER_DESC_TXRX(TEST_SLAVE_ADDRESS, &reg, 1, &first_value, 1)},
+      .priority       = DK_TWI_MNGR_PRIORITY_LOW,
+      .flags          = DK_TWI_MNGR_FLAG_SHARED_READ,
+      .buff_ownership = DK_TWI_MNGR_BUFF_BORROWED,
+    };
+    dk_twi_mngr_transaction_t follower = first;
+    follower.transfer.transfer_description.p_secondary_buf = &follower_value;
+
+    dk_twi_mngr_transaction_t write = {
+      .transfer       = {.transfer_description = DK_TWI_MNGR_XFER_DESC_TX(TEST_SLAVE_ADDRESS, write_buffer, 2)},
+      .priority       = DK_TWI_MNGR_PRIORITY_HIGH,
+      .buff_ownership = DK_TWI_MNGR_BUFF_BORROWED,
+    };
+
+    // The write is queued after the follower, but in a queue that gets to the bus first.
+    TEST_ASSERT_EQUAL(NRF_SUCCESS, dk_twi_mngr_schedule(&m_twi_mngr, &first));
+    TEST_ASSERT_EQUAL(NRF_SUCCESS, dk_twi_mngr_schedule(&m_twi_mngr, &follower));
+    TEST_ASSERT_EQUAL(NRF_SUCCESS, dk_twi_mngr_schedule(&m_twi_mngr, &write));
+
+    while (!dk_twi_mngr_is_idle(&m_twi_mngr))
+    {
+        dk_host_wait_for_event();
+    }
+
+    TEST_ASSERT_EQUAL(0x11, first_value);
+    TEST_ASSERT_EQUAL(0x22, follower_value);
+    TEST_ASSERT_EQUAL(3, dk_host_twi_xfer_count_get(0));
+
+    dk_twi_mngr_deinit(&m_twi_mngr);
+}
+
+static uint32_t m_release_count;
+
+static void owned_buffer_release(void *p_buffer, void *p_user_data)
+{
+    UNUSED_PARAMETER(p_buffer);
+    UNUSED_PARAMETER(p_user_data);
+
+    m_release_count++;
+}
+
+static void test_cancel_owner(void)
+{
+    setup();
+
+    static uint8_t owner_a;
+    static uint8_t owner_b;
+
+    uint8_t busy_buffer[]  = {0x28, 0x01, 0x02, 0x03};
+    uint8_t owned_buffer[] = {0x2C, 0x55};
+
+    dk_twi_mngr_transaction_t busy = {
+      .transfer       = {.transfer_description = DK_TWI_MNGR_XFER_DESC_TX(TEST_SLAVE_ADDRESS, busy_buffer, 4)},
+      .buff_ownership = DK_TWI_MNGR_BUFF_BORROWED,
+    };
+    dk_twi_mngr_transaction_t owned = {
+      .callback       = twi_mngr_callback,
+      .p_user_data    = &owner_a,
+      .transfer       = {.transfer_description = DK_TWI_MNGR_XFER_DESC_TX(TEST_SLAVE_ADDRESS, owned_buffer, 2)},
+      .buff_ownership = DK_TWI_MNGR_BUFF_OWNED,
+      .release        = owned_buffer_release,
+    };
+
+    uint16_t free_count = m_twi_mngr.p_dk_twi_mngr_cb->buff_pool_cb[DK_TWI_MNGR_BUFF_CLASS_SMALL].free_count;
+
+    m_release_count = 0;
+
+    // The bus is busy, so everything scheduled after this write stays queued.
+    TEST_ASSERT_EQUAL(NRF_SUCCESS, dk_twi_mngr_schedule(&m_twi_mngr, &busy));
+    TEST_ASSERT_EQUAL(NRF_SUCCESS, dk_twi_mngr_schedule(&m_twi_mngr, &owned));
+    TEST_ASSERT_EQUAL(NRF_SUCCESS, dk_twi_mngr_schedule(&m_twi_mngr, &owned));
+
+    uint8_t *p_buffer = dk_twi_mngr_data_buffer_alloc(&m_twi_mngr, 2);
+    TEST_ASSERT(p_buffer != NULL);
+    p_buffer[0] = 0x2D;
+    p_buffer[1] = 0x66;
+
+    dk_twi_mngr_transaction_t pooled = {
+      .callback    = twi_mngr_callback,
+      .p_user_data = &owner_a,
+      .transfer    = {.transfer_description = DK_TWI_MNGR_XFER_DESC_TX(TEST_SLAVE_ADDRESS, p_buffer, 2)},
+    };
+    TEST_ASSERT_EQUAL(NRF_SUCCESS, dk_twi_mngr_schedule(&m_twi_mngr, &pooled));
+
+    dk_twi_mngr_transaction_t other = owned;
+    other.p_user_data               = &owner_b;
+    TEST_ASSERT_EQUAL(NRF_SUCCESS, dk_twi_mngr_schedule(&m_twi_mngr, &other));
+
+    // Silent cancel releases the buffers of all transactions of the owner without calling back.
+    TEST_ASSERT_EQUAL(3, dk_twi_mngr_cancel(&m_twi_mngr, &owner_a, false));
+    TEST_ASSERT_EQUAL(0, m_cb_count);
+    TEST_ASSERT_EQUAL(2, m_release_count);
+    TEST_ASSERT_EQUAL(free_count,
+                      m_twi_mngr.p_dk_twi_mngr_cb->buff_pool_cb[DK_TWI_MNGR_BUFF_CLASS_SMALL].free_count);
+
+    // Nothing is left of the owner, the transaction of the other owner is still queued.
+    TEST_ASSERT_EQUAL(0, dk_twi_mngr_cancel(&m_twi_mngr, &owner_a, true));
+    TEST_ASSERT_EQUAL(1, dk_twi_mngr_cancel(&m_twi_mngr, &owner_b, true));
+    TEST_ASSERT_EQUAL(1, m_cb_count);
+    TEST_ASSERT_EQUAL(DK_TWI_MNGR_ERROR_ABORTED, m_cb_result);
+    TEST_ASSERT_EQUAL(3, m_release_count);
+
+    while (!dk_twi_mngr_is_idle(&m_twi_mngr))
+    {
+        dk_host_wait_for_event();
+    }
+
+    // Only the write that was already on the bus was performed.
+    TEST_ASSERT_EQUAL(1, dk_host_twi_xfer_count_get(0));
+    TEST_ASSERT_EQUAL(0x01, m_regfile.regs[0x28]);
+    TEST_ASSERT_EQUAL(0x00, m_regfile.regs[0x2C]);
+    TEST_ASSERT_EQUAL(0x00, m_regfile.regs[0x2D]);
+    TEST_ASSERT_EQUAL(1, m_cb_count);
+
+    dk_twi_mngr_deinit(&m_twi_mngr);
+}
+
+static uint32_t   m_group_cb_count;
+static ret_code_t m_group_cb_result;
+
+static void group_callback(ret_code_t result, void *p_user_data)
+{
+    UNUSED_PARAMETER(p_user_data);
+
+    m_group_cb_result = result;
+    m_group_cb_count++;
+}
+
+static void test_group_member_failure(void)
+{
+    setup();
+
+    static dk_host_twi_regfile_t other;
+
+    dk_host_twi_regfile_init(&other, TEST_OTHER_ADDRESS);
+    dk_host_twi_slave_attach(0, &other.slave);
+
+    uint8_t ok_buffer[]     = {0x38, 0x0A};
+    uint8_t absent_buffer[] = {0x38, 0x0B};
+    uint8_t stuck_buffer[]  = {0x39, 0x0C};
+
+    dk_twi_mngr_transaction_t const members[] = {
+      {.callback       = twi_mngr_callback,
+       .transfer       = {.transfer_description = DK_TWI_MNGR_XFER_DESC_TX(TEST_SLAVE_ADDRESS, ok_buffer, 2)},
+       .buff_ownership = DK_TWI_MNGR_BUFF_BORROWED},
+      {.callback       = twi_mngr_callback,
+       .transfer       = {.transfer_description = DK_TWI_MNGR_XFER_DESC_TX(TEST_ABSENT_ADDRESS, absent_buffer, 2)},
+       .buff_ownership = DK_TWI_MNGR_BUFF_BORROWED},
+      {.callback       = twi_mngr_callback,
+       .transfer       = {.transfer_description = DK_TWI_MNGR_XFER_DESC_TX(TEST_OTHER_ADDRESS, stuck_buffer, 2)},
+       .timeout_ms     = 5,
+       .buff_ownership = DK_TWI_MNGR_BUFF_BORROWED},
+    };
+
+    // The second member fails with a NACK, the third one later with a timeout.
+    dk_host_twi_fault_inject(0, TEST_OTHER_ADDRESS, DK_HOST_TWI_FAULT_STUCK, 1);
+
+    dk_twi_mngr_group_t group;
+
+    m_group_cb_count = 0;
+    dk_twi_mngr_group_open(&group, group_callback, NULL);
+    for (uint8_t i = 0; i < ARRAY_SIZE(members); i++)
+    {
+        TEST_ASSERT_EQUAL(NRF_SUCCESS, dk_twi_mngr_group_schedule(&m_twi_mngr, &group, &members[i]));
+    }
+    dk_twi_mngr_group_close(&group);
+    TEST_ASSERT_EQUAL(0, m_group_cb_count);
+
+    while (!dk_twi_mngr_is_idle(&m_twi_mngr))
+    {
+        dk_host_wait_for_event();
+    }
+
+    // Every member finished, the group reports once with the first failure.
+    TEST_ASSERT_EQUAL(3, m_cb_count);
+    TEST_ASSERT_EQUAL(NRF_ERROR_TIMEOUT, m_cb_result);
+    TEST_ASSERT_EQUAL(1, m_group_cb_count);
+    TEST_ASSERT_EQUAL(NRF_ERROR_INTERNAL, m_group_cb_result);
+    TEST_ASSERT_EQUAL(0x0A, m_regfile.regs[0x38]);
+
+    dk_twi_mngr_deinit(&m_twi_mngr);
+}
+
+static uint8_t m_order[4];
+static uint8_t m_order_count;
+
+static void order_callback(ret_code_t result, uint8_t evt, dk_twi_mngr_transfer_t *p_transfer, void *p_user_data)
+{
+    UNUSED_PARAMETER(result);
+    UNUSED_PARAMETER(evt);
+    UNUSED_PARAMETER(p_transfer);
+
+    m_order[m_order_count++] = (uint8_t)(uintptr_t)p_user_data;
+}
+
+static void test_edf_order(void)
+{
+    setup();
+
+    static dk_host_twi_regfile_t other;
+
+    dk_host_twi_regfile_init(&other, TEST_OTHER_ADDRESS);
+    dk_host_twi_slave_attach(0, &other.slave);
+
+    uint8_t  tx_buffer[] = {0x00, 0x00};
+    uint32_t now         = app_timer_cnt_get();
+
+    dk_twi_mngr_transaction_t const transactions[] = {
+      {.callback       = order_callback,
+       .p_user_data    = (void *)0,
+       .transfer       = {.transfer_description = DK_TWI_MNGR_XFER_DESC_TX(TEST_SLAVE_ADDRESS, tx_buffer, 2)},
+       .buff_ownership = DK_TWI_MNGR_BUFF_BORROWED},
+      {.callback       = order_callback,
+       .p_user_data    = (void *)1,
+       .transfer       = {.transfer_description = DK_TWI_MNGR_XFER_DESC_TX(TEST_SLAVE_ADDRESS, tx_buffer, 2)},
+       .buff_ownership = DK_TWI_MNGR_BUFF_BORROWED},
+      {.callback       = order_callback,
+       .p_user_data    = (void *)2,
+       .transfer       = {.transfer_description = DK_TWI_MNGR_XFER_DESC_TX(TEST_SLAVE_ADDRESS, tx_buffer, 2)},
+       .flags          = DK_TWI_MNGR_FLAG_DEADLINE,
+       .deadline       = now + 100,
+       .buff_ownership = DK_TWI_MNGR_BUFF_BORROWED},
+      {.callback       = order_callback,
+       .p_user_data    = (void *)3,
+       .transfer       = {.transfer_description = DK_TWI_MNGR_XFER_DESC_TX(TEST_OTHER_ADDRESS, tx_buffer, 2)},
+       .flags          = DK_TWI_MNGR_FLAG_DEADLINE,
+       .deadline       = now + 200,
+       .buff_ownership = DK_TWI_MNGR_BUFF_BORROWED},
+    };
+
+    m_order_count = 0;
+    for (uint8_t i = 0; i < ARRAY_SIZE(transactions); i++)
+    {
+        TEST_ASSERT_EQUAL(NRF_SUCCESS, dk_twi_mngr_schedule(&m_twi_mngr, &transactions[i]));
+    }
+
+    while (!dk_twi_mngr_is_idle(&m_twi_mngr))
+    {
+        dk_host_wait_for_event();
+    }
+
+    // The first one took the bus right away. The deadline of the other slave goes first, the earlier deadline of
+    // the same slave does not pass the older transaction to it.
+    TEST_ASSERT_EQUAL(4, m_order_count);
+    TEST_ASSERT_EQUAL(0, m_order[0]);
+    TEST_ASSERT_EQUAL(3, m_order[1]);
+    TEST_ASSERT_EQUAL(1, m_order[2]);
+    TEST_ASSERT_EQUAL(2, m_order[3]);
+
+    dk_twi_mngr_deinit(&m_twi_mngr);
+}
+
+static void test_deadline_late(void)
+{
+    setup();
+
+    uint8_t tx_buffer[] = {0x48, 0x01, 0x02, 0x03};
+
+    dk_twi_mngr_transaction_t transaction = {
+      .callback       = twi_mngr_callback,
+      .transfer       = {.transfer_description = DK_TWI_MNGR_XFER_DESC_TX(TEST_SLAVE_ADDRESS, tx_buffer, 4)},
+      .flags          = DK_TWI_MNGR_FLAG_DEADLINE,
+      .buff_ownership = DK_TWI_MNGR_BUFF_BORROWED,
+      .deadline       = app_timer_cnt_get() + 2,
+    };
+    m_regfile.slave.stretch_ns = 100000;
+    TEST_ASSERT_EQUAL(NRF_SUCCESS, dk_twi_mngr_schedule(&m_twi_mngr, &transaction));
+
+    while (!dk_twi_mngr_is_idle(&m_twi_mngr))
+    {
+        dk_host_wait_for_event();
+    }
+
+    dk_twi_mngr_stats_t stats;
+    dk_twi_mngr_stats_get(&m_twi_mngr, &stats);
+
+    // The transfer started in time, its data is valid even though it finished after the deadline.
+    TEST_ASSERT_EQUAL(1, m_cb_count);
+    TEST_ASSERT_EQUAL(NRF_SUCCESS, m_cb_result);
+    TEST_ASSERT_EQUAL(0, stats.deadline_missed);
+    TEST_ASSERT_EQUAL(1, stats.deadline_late);
+
+    dk_twi_mngr_deinit(&m_twi_mngr);
+}
+
+int main(void)
+{
+    TEST_RUN(test_perform_write_read);
+    TEST_RUN(test_schedule_pool_buffer);
+    TEST_RUN(test_address_nack);
+    TEST_RUN(test_perform_timeout);
+    TEST_RUN(test_perform_timeout_expired);
+    TEST_RUN(test_perform_timeout_watchdog_expired);
+    TEST_RUN(test_data_nack_fault);
+    TEST_RUN(test_stuck_bus_recovery);
+    TEST_RUN(test_clock_stretch);
+    TEST_RUN(test_superseded_queue_wait);
+    TEST_RUN(test_shared_read_barrier);
+    TEST_RUN(test_cancel_owner);
+    TEST_RUN(test_group_member_failure);
+    TEST_RUN(test_edf_order);
+    TEST_RUN(test_deadline_late);
+
+    return 0;
+}
@@ -0,0 +1,86 @@
+/**
+ * @file        test_dk_twi_mngr_idle.c
+ * @author      Danius Kalvaitis (danius.kalvaitis@gmail.com)
+ * @brief       Host tests of the TWI manager powering the peripheral down on an idle bus.
+ * @version     0.1
+ * @date        2026-10-17
+ *
+ * @copyright   Copyright (c) Danius Kalvaitis 2026 All rights reserved
+ *
+ */
+
+#include "app_timer.h"
+#include "dk_host_sim.h"
+#include "dk_host_test.h"
+#include "dk_host_twi.h"
+#include "dk_twi_mngr.h"
+
+#if !DK_TWI_MNGR_IDLE_TIMEOUT_MS
+#error "Build this test with DK_TWI_MNGR_IDLE_TIMEOUT_MS set!"
+#endif
+
+#define TEST_SLAVE_ADDRESS 0x6A
+
+DK_TWI_MNGR_DEF(m_twi_mngr, 4, 4, 4, 0, 4, 2);
+
+static dk_host_twi_regfile_t m_regfile;
+
+static dk_twi_mngr_config_t const m_twi_config = {
+  .scl                = 26,
+  .sda                = 27,
+  .frequency          = NRF_TWI_FREQ_400K,
+  .interrupt_priority = 6,
+  .hold_bus_uninit    = false,
+};
+
+static void setup(void)
+{
+    dk_host_twi_regfile_init(&m_regfile, TEST_SLAVE_ADDRESS);
+    dk_host_twi_slave_attach(0, &m_regfile.slave);
+
+    TEST_ASSERT_EQUAL(NRF_SUCCESS, app_timer_init());
+    TEST_ASSERT_EQUAL(NRF_SUCCESS, dk_twi_mngr_init(&m_twi_mngr, &m_twi_config));
+}
+
+static void test_idle_power_down(void)
+{
+    setup();
+
+    uint8_t tx_buffer[] = {0x10, 0x01};
+
+    dk_twi_mngr_transfer_t write = {
+      .transfer_description = DK_TWI_MNGR_XFER_DESC_TX(TEST_SLAVE_ADDRESS, tx_buffer, sizeof(tx_buffer)),
+    };
+    TEST_ASSERT_EQUAL(NRF_SUCCESS, dk_twi_mngr_perform(&m_twi_mngr, &write, dk_host_wait_for_event));
+    TEST_ASSERT_EQUAL(1, dk_host_twi_init_count_get(0));
+
+    // The idle timer expires and powers the peripheral down, it stays down while nothing is scheduled.
+    dk_host_run_until(dk_host_time_get() + (4 * DK_TWI_MNGR_IDLE_TIMEOUT_MS * 1000000ULL));
+
+    uint64_t powered_ticks = dk_twi_mngr_powered_ticks_get(&m_twi_mngr);
+    TEST_ASSERT(powered_ticks >= APP_TIMER_TICKS(DK_TWI_MNGR_IDLE_TIMEOUT_MS));
+
+    dk_host_run_until(dk_host_time_get() + 100000000ULL);
+    TEST_ASSERT_EQUAL(powered_ticks, dk_twi_mngr_powered_ticks_get(&m_twi_mngr));
+    TEST_ASSERT(dk_twi_mngr_is_idle(&m_twi_mngr));
+
+    // The next transaction initializes the peripheral again and the powered time runs again.
+    tx_buffer[1] = 0x02;
+    TEST_ASSERT_EQUAL(NRF_SUCCESS, dk_twi_mngr_perform(&m_twi_mngr, &write, dk_host_wait_for_event));
+    TEST_ASSERT_EQUAL(2, dk_host_twi_init_count_get(0));
+    TEST_ASSERT_EQUAL(0x02, m_regfile.regs[0x10]);
+
+    dk_host_run_until(dk_host_time_get() + (4 * DK_TWI_MNGR_IDLE_TIMEOUT_MS * 1000000ULL));
+    TEST_ASSERT(dk_twi_mngr_powered_ticks_get(&m_twi_mngr) >=
+                powered_ticks + APP_TIMER_TICKS(DK_TWI_MNGR_IDLE_TIMEOUT_MS));
+    TEST_ASSERT_EQUAL(2, dk_host_twi_init_count_get(0));
+
+    dk_twi_mngr_deinit(&m_twi_mngr);
+}
+
+int main(void)
+{
+    TEST_RUN(test_idle_power_down);
+
+    return 0;
+}
@@ -0,0 +1,203 @@
+/**
+ * @file        dk_cpu_load.c
+ * @author      Danius Kalvaitis (danius.kalvaitis@gmail.com)
+ * @brief       CPU load and idle time accounting.
+ * @version     0.1
+ * @date        2026-10-17
+ *
+ * @copyright   Copyright (c) Danius Kalvaitis 2026 All rights reserved
+ *
+ */
+
+#include "dk_lib_common.h"
+#if DK_MODULE_ENABLED(DK_CPU_LOAD)
+
+#include "dk_cpu_load.h"
+
+#include <stdbool.h>
+
+#include "app_timer.h"
+#include "app_util_platform.h"
+#include "dk_wait_for_event.h"
+
+#define WINDOW_TICKS APP_TIMER_TICKS(DK_CPU_LOAD_WINDOW_MS)
+
+// A replaced sleep can not run with interrupts masked, it relies on the wakeup marks.
+#if defined(DK_WAIT_FOR_EVENT_HOOK)
+#define MASKED_SLEEP_SUPPORTED 0
+#else
+#define MASKED_SLEEP_SUPPORTED 1
+#endif
+
+static volatile bool     m_sleeping;     ///< An accounted sleep is in progress.
+static volatile bool     m_woken;        ///< An interrupt ended the idle time of the current sleep.
+static volatile uint32_t m_idle_end;     ///< Tick the interrupt ended the idle time.
+static uint32_t          m_busy_start;   ///< Tick the current busy period started.
+static uint32_t          m_busy_max;     ///< Longest busy period.
+static uint32_t          m_window_start; ///< Tick the current window started.
+static uint32_t          m_window_idle;  ///< Idle time of the current window.
+static uint8_t           m_load;         ///< CPU load of the last full window.
+
+/**
+ * @brief       Close the current window if it is long enough. Must be called from a critical region.
+ *
+ * @details     Idle time is added to the window the sleep ended in, a sleep longer than a window stretches it.
+ *
+ * @param[in]   now     Current app_timer tick.
+ */
+static void window_update(uint32_t now)
+{
+    uint32_t elapsed = app_timer_cnt_diff_compute(now, m_window_start);
+
+    if (elapsed < WINDOW_TICKS)
+    {
+        return;
+    }
+
+    uint32_t busy = elapsed - MIN(m_window_idle, elapsed);
+
+    m_load         = (uint8_t)(((uint64_t)busy * 100 + (elapsed / 2)) / elapsed);
+    m_window_start = now;
+    m_window_idle  = 0;
+}
+
+#if MASKED_SLEEP_SUPPORTED
+/**
+ * @brief       Check if the sleep can run with interrupts masked.
+ *
+ * @return      True if the SoftDevice is disabled, sd_app_evt_wait must not be called with PRIMASK set.
+ */
+static bool masked_sleep_possible(void)
+{
+#ifdef SOFTDEVICE_PRESENT
+    return !nrf_sdh_is_enabled();
+#else
+    return true;
+#endif
+}
+
+/**
+ * @brief       Sleep with interrupts masked and account the time as idle.
+ *
+ * @details     The waking interrupt stays pending until PRIMASK is restored, so the idle time is closed before any
+ *              handler runs and no wakeup mark is needed. An interrupt that finished the awaited work before PRIMASK
+ *              was set has left the event register set, WFE returns right away then.
+ */
+static void masked_sleep(void)
+{
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+
+    // Let an interrupt that becomes pending while masked end WFE.
+    SCB->SCR |= SCB_SCR_SEVONPEND_Msk;
+
+    uint32_t idle_start = app_timer_cnt_get();
+    m_busy_max          = MAX(m_busy_max, app_timer_cnt_diff_compute(idle_start, m_busy_start));
+
+    __WFE();
+
+    uint32_t now = app_timer_cnt_get();
+
+    m_window_idle += app_timer_cnt_diff_compute(now, idle_start);
+    m_busy_start = now;
+
+    window_update(now);
+
+    __set_PRIMASK(primask);
+}
+#endif // MASKED_SLEEP_SUPPORTED
+
+void dk_cpu_load_init(void)
+{
+    CRITICAL_REGION_ENTER();
+    m_sleeping     = false;
+    m_busy_start   = app_timer_cnt_get();
+    m_busy_max     = 0;
+    m_window_start = m_busy_start;
+    m_window_idle  = 0;
+    m_load         = 0;
+    CRITICAL_REGION_EXIT();
+}
+
+void dk_cpu_load_sleep(void)
+{
+    bool     nested;
+    uint32_t idle_start = 0;
+
+#if MASKED_SLEEP_SUPPORTED
+    if (masked_sleep_possible())
+    {
+        masked_sleep();
+        return;
+    }
+#endif
+
+    CRITICAL_REGION_ENTER();
+    nested = m_sleeping;
+    if (!nested)
+    {
+        idle_start = app_timer_cnt_get();
+        m_busy_max = MAX(m_busy_max, app_timer_cnt_diff_compute(idle_start, m_busy_start));
+        m_sleeping = true;
+        m_woken    = false;
+    }
+    CRITICAL_REGION_EXIT();
+
+    dk_sleep_until_event();
+
+    if (nested)
+    {
+        // The interrupted sleep already counts this time as idle or the wakeup mark ended it.
+        return;
+    }
+
+    CRITICAL_REGION_ENTER();
+    uint32_t now      = app_timer_cnt_get();
+    uint32_t idle_end = m_woken ? m_idle_end : now;
+
+    m_window_idle += app_timer_cnt_diff_compute(idle_end, idle_start);
+    m_busy_start = idle_end;
+    m_sleeping   = false;
+
+    window_update(now);
+    CRITICAL_REGION_EXIT();
+}
+
+void dk_cpu_load_wakeup(void)
+{
+    CRITICAL_REGION_ENTER();
+    if (m_sleeping && !m_woken)
+    {
+        m_idle_end = app_timer_cnt_get();
+        m_woken    = true;
+    }
+    CRITICAL_REGION_EXIT();
+}
+
+uint8_t dk_cpu_load_get(void)
+{
+    uint8_t load;
+
+    CRITICAL_REGION_ENTER();
+    // The caller is running, so a window that has elapsed without any sleep is closed as fully busy.
+    window_update(app_timer_cnt_get());
+    load = m_load;
+    CRITICAL_REGION_EXIT();
+
+    return load;
+}
+
+uint32_t dk_cpu_load_busy_max_get(void)
+{
+    return m_busy_max;
+}
+
+void dk_cpu_load_busy_max_reset(void)
+{
+    CRITICAL_REGION_ENTER();
+    m_busy_max = 0;
+    CRITICAL_REGION_EXIT();
+}
+
+#endif // DK_MODULE_ENABLED(DK_CPU_LOAD)
@@ -0,0 +1,94 @@
+/**
+ * @file        dk_cpu_load.h
+ * @author      Danius Kalvaitis (danius.kalvaitis@gmail.com)
+ * @brief       CPU load and idle time accounting.
+ * @version     0.1
+ * @date        2026-10-17
+ *
+ * @copyright   Copyright (c) Danius Kalvaitis 2026 All rights reserved
+ *
+ */
+
+#ifndef DK_CPU_LOAD_H
+#define DK_CPU_LOAD_H
+
+#include <stdint.h>
+
+#include "dk_lib_common.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Minimum length of the window the CPU load is averaged over.
+ */
+#ifndef DK_CPU_LOAD_WINDOW_MS
+#define DK_CPU_LOAD_WINDOW_MS 1000
+#endif
+
+#if DK_MODULE_ENABLED(DK_CPU_LOAD)
+/**
+ * @brief Macro for ending the idle time at the start of an interrupt handler, compiled out when the module is
+ *        disabled.
+ *
+ * @details Only needed while the SoftDevice is enabled or the sleep is replaced with DK_WAIT_FOR_EVENT_HOOK. An
+ *          interrupt that wakes the CPU is handled before the sleep returns then, without this mark the handler is
+ *          counted as idle time. The TWI and SPI manager handlers call it, add it to every other handler that wakes
+ *          the CPU in such a setup (SoftDevice events, app_timer, GPIOTE and so on).
+ */
+#define DK_CPU_LOAD_WAKEUP() dk_cpu_load_wakeup()
+#else
+#define DK_CPU_LOAD_WAKEUP()
+#endif
+
+/**
+ * @brief       Start accounting.
+ *
+ * @note        app_timer has to be initialized, its counter measures the time.
+ */
+void dk_cpu_load_init(void);
+
+/**
+ * @brief       Sleep until an event or an interrupt arrives and account the time as idle.
+ *
+ * @details     Replaces sd_app_evt_wait or __WFE in the idle loop of the application. The blocking calls of the DK
+ *              Lib modules use it through @ref dk_wait_for_event. Without the SoftDevice the CPU sleeps with
+ *              interrupts masked by PRIMASK and the wakeup is timestamped before the handlers run. With the
+ *              SoftDevice the handlers run inside sd_app_evt_wait and end the idle time with @ref DK_CPU_LOAD_WAKEUP.
+ *              Sleeps nested in an interrupt that woke an accounted sleep are not counted twice.
+ */
+void dk_cpu_load_sleep(void);
+
+/**
+ * @brief       Mark the end of the idle time, see @ref DK_CPU_LOAD_WAKEUP.
+ */
+void dk_cpu_load_wakeup(void);
+
+/**
+ * @brief       Get the CPU load.
+ *
+ * @note        Call it from the idle loop context, a call from an interrupt that woke an unmarked sleep closes the
+ *              window with the rest of that sleep counted as busy.
+ *
+ * @return      Busy time of the last full window in percent.
+ */
+uint8_t dk_cpu_load_get(void);
+
+/**
+ * @brief       Get the longest time the CPU was busy without sleeping.
+ *
+ * @return      Longest busy period since @ref dk_cpu_load_init or @ref dk_cpu_load_busy_max_reset in app_timer ticks.
+ */
+uint32_t dk_cpu_load_busy_max_get(void);
+
+/**
+ * @brief       Clear the longest busy period.
+ */
+void dk_cpu_load_busy_max_reset(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // DK_CPU_LOAD_H
@@ -0,0 +1,149 @@
+/**
+ * @file        dk_mpsc_queue.c
+ * @author      Danius Kalvaitis (danius.kalvaitis@gmail.com)
+ * @brief       Lock-free multi-producer, single-consumer queue.
+ * @version     0.1
+ * @date        2026-10-17
+ *
+ * @copyright   Copyright (c) Danius Kalvaitis 2026 All rights reserved
+ *
+ */
+
+#include "dk_lib_common.h"
+#if DK_MODULE_ENABLED(DK_MPSC_QUEUE)
+
+#include "dk_mpsc_queue.h"
+
+#include <string.h>
+
+#include "nrf_assert.h"
+
+// Slot sequence numbers follow the bounded queue design by Dmitry Vyukov. A slot at position pos is free for
+// a producer when its sequence equals pos and holds a published element when its sequence equals pos + 1. Atomic
+// builtins compile to LDREX/STREX on Cortex-M3/M4.
+
+static inline uint8_t *slot_get(dk_mpsc_queue_t const *p_queue, uint32_t pos)
+{
+    return &((uint8_t *)p_queue->p_buffer)[(pos & (p_queue->size - 1)) * p_queue->element_size];
+}
+
+static inline uint32_t seq_get(dk_mpsc_queue_t const *p_queue, uint32_t pos)
+{
+    return __atomic_load_n(&p_queue->p_seq[pos & (p_queue->size - 1)], __ATOMIC_ACQUIRE);
+}
+
+void dk_mpsc_queue_init(dk_mpsc_queue_t const *p_queue)
+{
+    ASSERT(p_queue != NULL);
+    ASSERT(IS_POWER_OF_TWO(p_queue->size));
+
+    for (uint32_t i = 0; i < p_queue->size; i++)
+    {
+        p_queue->p_seq[i] = i;
+    }
+
+    p_queue->p_cb->enqueue_pos = 0;
+    p_queue->p_cb->dequeue_pos = 0;
+
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+}
+
+ret_code_t dk_mpsc_queue_push(dk_mpsc_queue_t const *p_queue, void const *p_element)
+{
+    ASSERT(p_queue != NULL);
+    ASSERT(p_element != NULL);
+
+    uint32_t pos = __atomic_load_n(&p_queue->p_cb->enqueue_pos, __ATOMIC_RELAXED);
+
+    for (;;)
+    {
+        int32_t diff = (int32_t)(seq_get(p_queue, pos) - pos);
+
+        if (diff == 0)
+        {
+            // Slot is free, try to claim the position. On failure pos is updated to the current value.
+            if (__atomic_compare_exchange_n(
+                  &p_queue->p_cb->enqueue_pos, &pos, pos + 1, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+            {
+                break;
+            }
+        } else if (diff < 0)
+        {
+            // Slot still holds an element from the previous lap.
+            return NRF_ERROR_NO_MEM;
+        } else
+        {
+            // Another producer claimed this position in the meantime.
+            pos = __atomic_load_n(&p_queue->p_cb->enqueue_pos, __ATOMIC_RELAXED);
+        }
+    }
+
+    memcpy(slot_get(p_queue, pos), p_element, p_queue->element_size);
+
+    // Publish the element to the consumer.
+    __atomic_store_n(&p_queue->p_seq[pos & (p_queue->size - 1)], pos + 1, __ATOMIC_RELEASE);
+
+    return NRF_SUCCESS;
+}
+
+ret_code_t dk_mpsc_queue_pop(dk_mpsc_queue_t const *p_queue, void *p_element)
+{
+    ASSERT(p_queue != NULL);
+    ASSERT(p_element != NULL);
+
+    uint32_t pos = p_queue->p_cb->dequeue_pos;
+
+    if (seq_get(p_queue, pos) != (pos + 1))
+    {
+        return NRF_ERROR_NOT_FOUND;
+    }
+
+    // Take the slot out of the pending range before copying it, so in-place access does not race with the copy.
+    __atomic_store_n(&p_queue->p_cb->dequeue_pos, pos + 1, __ATOMIC_RELEASE);
+
+    memcpy(p_element, slot_get(p_queue, pos), p_queue->element_size);
+
+    // Hand the slot over to the producer of the next lap.
+    __atomic_store_n(&p_queue->p_seq[pos & (p_queue->size - 1)], pos + p_queue->size, __ATOMIC_RELEASE);
+
+    return NRF_SUCCESS;
+}
+
+bool dk_mpsc_queue_is_empty(dk_mpsc_queue_t const *p_queue)
+{
+    ASSERT(p_queue != NULL);
+
+    uint32_t pos = __atomic_load_n(&p_queue->p_cb->dequeue_pos, __ATOMIC_ACQUIRE);
+
+    return seq_get(p_queue, pos) != (pos + 1);
+}
+
+uint32_t dk_mpsc_queue_pending_count(dk_mpsc_queue_t const *p_queue)
+{
+    ASSERT(p_queue != NULL);
+
+    return __atomic_load_n(&p_queue->p_cb->enqueue_pos, __ATOMIC_ACQUIRE) -
+           __atomic_load_n(&p_queue->p_cb->dequeue_pos, __ATOMIC_ACQUIRE);
+}
+
+void *dk_mpsc_queue_pending_get(dk_mpsc_queue_t const *p_queue, uint32_t offset)
+{
+    ASSERT(p_queue != NULL);
+
+    if (offset >= dk_mpsc_queue_pending_count(p_queue))
+    {
+        return NULL;
+    }
+
+    uint32_t pos = p_queue->p_cb->dequeue_pos + offset;
+
+    if (seq_get(p_queue, pos) != (pos + 1))
+    {
+        // Position is claimed by a producer that was preempted before publishing the element.
+        return NULL;
+    }
+
+    return slot_get(p_queue, pos);
+}
+
+#endif // DK_MODULE_ENABLED(DK_MPSC_QUEUE)
@@ -0,0 +1,139 @@
+/**
+ * @file        dk_mpsc_queue.h
+ * @author      Danius Kalvaitis (danius.kalvaitis@gmail.com)
+ * @brief       Lock-free multi-producer, single-consumer queue.
+ * @version     0.1
+ * @date        2026-10-17
+ *
+ * @copyright   Copyright (c) Danius Kalvaitis 2026 All rights reserved
+ *
+ */
+
+#ifndef DK_MPSC_QUEUE_H
+#define DK_MPSC_QUEUE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "app_util.h"
+#include "sdk_errors.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Queue control block.
+ */
+typedef struct
+{
+    volatile uint32_t enqueue_pos; ///< Next position to be claimed by a producer.
+    volatile uint32_t dequeue_pos; ///< Next position to be read by the consumer.
+} dk_mpsc_queue_cb_t;
+
+/**
+ * @brief Queue instance.
+ *
+ * @details Every slot has a sequence number that tells whether the slot is free for the producer at a given position
+ *          or holds a published element for the consumer. Producers claim positions with a compare-and-swap, so
+ *          neither producers nor the consumer have to disable interrupts.
+ */
+typedef struct
+{
+    dk_mpsc_queue_cb_t *p_cb;         ///< Control block of the queue.
+    void               *p_buffer;     ///< Element storage.
+    volatile uint32_t  *p_seq;        ///< Sequence number of every slot.
+    size_t              element_size; ///< Size of a single element in bytes.
+    uint32_t            size;         ///< Amount of slots, power of two.
+} dk_mpsc_queue_t;
+
+/**
+ * @brief Macro for defining a queue instance.
+ *
+ * @param _type Type of the queue element.
+ * @param _name Name of the queue.
+ * @param _size Amount of elements the queue can hold, has to be a power of two.
+ */
+#define DK_MPSC_QUEUE_DEF(_type, _name, _size)                                                                         \
+    STATIC_ASSERT(IS_POWER_OF_TWO(_size));                                                                             \
+    static _type                 CONCAT_2(_name, _buffer)[(_size)];                                                    \
+    static volatile uint32_t     CONCAT_2(_name, _seq)[(_size)];                                                       \
+    static dk_mpsc_queue_cb_t    CONCAT_2(_name, _cb);                                                                 \
+    static const dk_mpsc_queue_t _name = {.p_cb         = &CONCAT_2(_name, _cb),                                       \
+                                          .p_buffer     = CONCAT_2(_name, _buffer),                                    \
+                                          .p_seq        = CONCAT_2(_name, _seq),                                       \
+                                          .element_size = sizeof(_type),                                               \
+                                          .size         = (_size)}
+
+/**
+ * @brief       Initialize the queue or drop all of its elements.
+ *
+ * @note        Must not be called while the queue is in use.
+ *
+ * @param[in]   p_queue Pointer to queue instance.
+ */
+void dk_mpsc_queue_init(dk_mpsc_queue_t const *p_queue);
+
+/**
+ * @brief       Add an element to the queue.
+ *
+ * @details     Safe to call from any context, including interrupts that preempt another producer or the consumer.
+ *
+ * @param[in]   p_queue             Pointer to queue instance.
+ * @param[in]   p_element           Pointer to element to be copied into the queue.
+ *
+ * @retval      NRF_SUCCESS         If the element was added.
+ * @retval      NRF_ERROR_NO_MEM    If the queue is full.
+ */
+ret_code_t dk_mpsc_queue_push(dk_mpsc_queue_t const *p_queue, void const *p_element);
+
+/**
+ * @brief       Take the oldest published element out of the queue.
+ *
+ * @note        Only one context at a time may act as the consumer.
+ *
+ * @param[in]   p_queue             Pointer to queue instance.
+ * @param[out]  p_element           Pointer to memory the element is copied to.
+ *
+ * @retval      NRF_SUCCESS         If an element was taken.
+ * @retval      NRF_ERROR_NOT_FOUND If no published element is available.
+ */
+ret_code_t dk_mpsc_queue_pop(dk_mpsc_queue_t const *p_queue, void *p_element);
+
+/**
+ * @brief       Check if the queue has no published element at its front.
+ *
+ * @param[in]   p_queue Pointer to queue instance.
+ *
+ * @return      True if the consumer would not get an element, false otherwise.
+ */
+bool dk_mpsc_queue_is_empty(dk_mpsc_queue_t const *p_queue);
+
+/**
+ * @brief       Get the amount of positions claimed by producers that were not taken by the consumer yet.
+ *
+ * @param[in]   p_queue Pointer to queue instance.
+ *
+ * @return      Amount of pending elements, including the ones that are still being written.
+ */
+uint32_t dk_mpsc_queue_pending_count(dk_mpsc_queue_t const *p_queue);
+
+/**
+ * @brief       Get a pending element for in-place access.
+ *
+ * @warning     The element may only be accessed while neither producers nor the consumer can run, e.g. from
+ *              a critical region.
+ *
+ * @param[in]   p_queue Pointer to queue instance.
+ * @param[in]   offset  Offset of the element from the front of the queue.
+ *
+ * @return      Pointer to element or NULL if the position is out of range or its element is still being written.
+ */
+void *dk_mpsc_queue_pending_get(dk_mpsc_queue_t const *p_queue, uint32_t offset);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // DK_MPSC_QUEUE_H
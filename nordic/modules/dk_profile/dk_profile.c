@@ -0,0 +1,103 @@
+/**
+ * @file        dk_profile.c
+ * @author      Danius Kalvaitis (danius.kalvaitis@gmail.com)
+ * @brief       Cycle counter profiling of named code regions.
+ * @version     0.1
+ * @date        2026-10-17
+ *
+ * @copyright   Copyright (c) Danius Kalvaitis 2026 All rights reserved
+ *
+ */
+
+#include "dk_lib_common.h"
+#if DK_MODULE_ENABLED(DK_PROFILE)
+
+#include "dk_profile.h"
+
+#include "app_util_platform.h"
+#include "nrf.h"
+#include "nrf_assert.h"
+
+#define NRF_LOG_MODULE_NAME DK_PROFILE
+#include "nrf_log.h"
+#include "nrf_log_ctrl.h"
+NRF_LOG_MODULE_REGISTER();
+
+static dk_profile_region_t *mp_regions; ///< Regions executed at least once.
+
+static void region_clear(dk_profile_region_t *p_region)
+{
+    p_region->count = 0;
+    p_region->min   = UINT32_MAX;
+    p_region->max   = 0;
+    p_region->total = 0;
+}
+
+void dk_profile_init(void)
+{
+#if DK_PROFILE_USE_DWT
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+
+    dk_profile_reset();
+}
+
+void dk_profile_region_update(dk_profile_region_t *p_region, uint32_t cycles)
+{
+    ASSERT(p_region != NULL);
+
+    CRITICAL_REGION_ENTER();
+    if (!p_region->registered)
+    {
+        p_region->registered = true;
+        p_region->p_next     = mp_regions;
+        mp_regions           = p_region;
+    }
+
+    p_region->count++;
+    p_region->total += cycles;
+    p_region->min = MIN(p_region->min, cycles);
+    p_region->max = MAX(p_region->max, cycles);
+    CRITICAL_REGION_EXIT();
+}
+
+void dk_profile_reset(void)
+{
+    CRITICAL_REGION_ENTER();
+    for (dk_profile_region_t *p_region = mp_regions; p_region != NULL; p_region = p_region->p_next)
+    {
+        region_clear(p_region);
+    }
+    CRITICAL_REGION_EXIT();
+}
+
+void dk_profile_dump(void)
+{
+    NRF_LOG_INFO("Region: count, min/max/avg cycles");
+
+    for (dk_profile_region_t *p_region = mp_regions; p_region != NULL; p_region = p_region->p_next)
+    {
+        dk_profile_region_t region;
+
+        // Take a consistent copy, the region may be updated from an interrupt while it is logged.
+        CRITICAL_REGION_ENTER();
+        region = *p_region;
+        CRITICAL_REGION_EXIT();
+
+        if (region.count == 0)
+        {
+            continue;
+        }
+
+        NRF_LOG_INFO("%s: %u, %u/%u/%u",
+                     region.p_name,
+                     region.count,
+                     region.min,
+                     region.max,
+                     (uint32_t)(region.total / region.count));
+    }
+}
+
+#endif // DK_MODULE_ENABLED(DK_PROFILE)
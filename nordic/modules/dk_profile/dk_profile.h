@@ -0,0 +1,112 @@
+/**
+ * @file        dk_profile.h
+ * @author      Danius Kalvaitis (danius.kalvaitis@gmail.com)
+ * @brief       Cycle counter profiling of named code regions.
+ * @version     0.1
+ * @date        2026-10-17
+ *
+ * @copyright   Copyright (c) Danius Kalvaitis 2026 All rights reserved
+ *
+ */
+
+#ifndef DK_PROFILE_H
+#define DK_PROFILE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "app_util.h"
+#include "dk_lib_common.h"
+#include "nrf.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Cycle source of the measurements, the DWT cycle counter by default.
+ *
+ * Define it in dk_config.h to measure with another free running 32-bit counter, for example a monotonic clock when
+ * the modules are compiled for the host. The DWT is only set up by @ref dk_profile_init when it is the source.
+ */
+#ifndef DK_PROFILE_CYCLES_GET
+#define DK_PROFILE_CYCLES_GET() (DWT->CYCCNT)
+#define DK_PROFILE_USE_DWT      1
+#else
+#define DK_PROFILE_USE_DWT 0
+#endif
+
+/**
+ * @brief Profiled code region.
+ */
+typedef struct dk_profile_region_s
+{
+    char const                 *p_name;     ///< Name shown by @ref dk_profile_dump.
+    struct dk_profile_region_s *p_next;     ///< Next region known to @ref dk_profile_dump.
+    bool                        registered; ///< Region was added to the list of @ref dk_profile_dump.
+    uint32_t                    count;      ///< Times the region was executed.
+    uint32_t                    min;        ///< Shortest execution in cycles.
+    uint32_t                    max;        ///< Longest execution in cycles.
+    uint64_t                    total;      ///< Sum of all executions in cycles.
+} dk_profile_region_t;
+
+#if DK_MODULE_ENABLED(DK_PROFILE)
+/**
+ * @brief Macro for defining a profiled region.
+ *
+ * @details The region becomes known to @ref dk_profile_dump when it is executed for the first time.
+ *
+ * @param _name Name of the region variable.
+ * @param _text Name shown by @ref dk_profile_dump.
+ */
+#define DK_PROFILE_REGION_DEF(_name, _text) static dk_profile_region_t _name = {.p_name = (_text), .min = UINT32_MAX}
+
+/**
+ * @brief Macro for entering a region. Declares the start time, so it must be placed where a declaration is allowed.
+ *
+ * @param _name Name of the region variable.
+ */
+#define DK_PROFILE_ENTER(_name) uint32_t const CONCAT_2(_name, _start) = DK_PROFILE_CYCLES_GET()
+
+/**
+ * @brief Macro for leaving a region entered in the same scope.
+ *
+ * @param _name Name of the region variable.
+ */
+#define DK_PROFILE_EXIT(_name) dk_profile_region_update(&(_name), DK_PROFILE_CYCLES_GET() - CONCAT_2(_name, _start))
+#else
+#define DK_PROFILE_REGION_DEF(_name, _text) extern dk_profile_region_t _name
+#define DK_PROFILE_ENTER(_name)
+#define DK_PROFILE_EXIT(_name)
+#endif
+
+/**
+ * @brief       Start the cycle counter and clear the results of all regions.
+ */
+void dk_profile_init(void);
+
+/**
+ * @brief       Add one execution to a region.
+ *
+ * @details     Safe to call from any context. Called by @ref DK_PROFILE_EXIT.
+ *
+ * @param[in]   p_region    Pointer to region.
+ * @param[in]   cycles      Execution time in cycles.
+ */
+void dk_profile_region_update(dk_profile_region_t *p_region, uint32_t cycles);
+
+/**
+ * @brief       Clear the results of all regions.
+ */
+void dk_profile_reset(void);
+
+/**
+ * @brief       Log count, minimum, maximum and average cycles of every executed region.
+ */
+void dk_profile_dump(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // DK_PROFILE_H
@@ -0,0 +1,337 @@
+/**
+ * @file        dk_spi_mngr.c
+ * @author      Danius Kalvaitis (danius.kalvaitis@gmail.com)
+ * @brief       SPI manager that queues transactions of several devices sharing one SPI bus.
+ * @version     0.1
+ * @date        2026-10-17
+ *
+ * @copyright   Copyright (c) Danius Kalvaitis 2026 All rights reserved
+ *
+ */
+
+#include "dk_lib_common.h"
+#if DK_MODULE_ENABLED(DK_SPI_MNGR)
+
+#include "dk_spi_mngr.h"
+
+#include "app_util_platform.h"
+#include "dk_cpu_load.h"
+#include "dk_wait_for_event.h"
+#include "nrf_assert.h"
+#include "nrf_gpio.h"
+#include "sdk_macros.h"
+
+#define NRF_LOG_MODULE_NAME DK_SPI_MNGR
+#include "nrf_log.h"
+#include "nrf_log_ctrl.h"
+NRF_LOG_MODULE_REGISTER();
+
+#if !DK_MODULE_ENABLED(DK_MPSC_QUEUE)
+#error "Enable DK_MPSC_QUEUE module in dk_config!"
+#endif
+
+// Driver functions of the selected backend.
+#if DK_SPI_MNGR_USE_SPIM
+#define DRV_INIT     nrfx_spim_init
+#define DRV_UNINIT   nrfx_spim_uninit
+#define DRV_XFER     nrfx_spim_xfer
+#define DRV_EVT_DONE NRFX_SPIM_EVENT_DONE
+#else
+#define DRV_INIT     nrfx_spi_init
+#define DRV_UNINIT   nrfx_spi_uninit
+#define DRV_XFER     nrfx_spi_xfer
+#define DRV_EVT_DONE NRFX_SPI_EVENT_DONE
+#endif
+
+typedef volatile struct
+{
+    bool       transaction_in_progress;
+    ret_code_t transaction_result;
+} dk_spi_mngr_cb_data_t;
+
+static size_t transaction_length_get(dk_spi_mngr_transaction_t const *p_transaction)
+{
+    return MAX(p_transaction->xfer_desc.tx_length, p_transaction->xfer_desc.rx_length);
+}
+
+static void pins_select(dk_spi_mngr_transaction_t const *p_transaction)
+{
+    if (p_transaction->dc_pin != DK_SPI_MNGR_PIN_NOT_USED)
+    {
+        nrf_gpio_pin_write(p_transaction->dc_pin, (uint32_t)p_transaction->dc_state);
+    }
+
+    if (p_transaction->cs_pin != DK_SPI_MNGR_PIN_NOT_USED)
+    {
+        nrf_gpio_pin_clear(p_transaction->cs_pin);
+    }
+}
+
+static void pins_release(dk_spi_mngr_transaction_t const *p_transaction)
+{
+    if (p_transaction->cs_pin != DK_SPI_MNGR_PIN_NOT_USED)
+    {
+        nrf_gpio_pin_set(p_transaction->cs_pin);
+    }
+}
+
+/**
+ * @brief       Start the next chunk of the current transaction.
+ *
+ * @details     Chip select stays low between the chunks, so the slave sees a single transfer.
+ *
+ * @param[in]   p_dk_spi_mngr   Pointer to SPI manager instance.
+ *
+ * @return      Error code returned by the driver.
+ */
+static ret_code_t start_transfer(dk_spi_mngr_t const *p_dk_spi_mngr)
+{
+    // Pointer for cleaner code.
+    dk_spi_mngr_cb_t *p_cb = p_dk_spi_mngr->p_dk_spi_mngr_cb;
+
+    // [use a local variable to avoid using two volatile variables in one
+    //  expression]
+    dk_spi_mngr_transaction_t transaction = p_cb->current_transaction;
+    dk_spi_mngr_xfer_desc_t   xfer        = transaction.xfer_desc;
+    size_t                    offset      = p_cb->offset;
+
+    xfer.p_tx_buffer = (xfer.tx_length > offset) ? &xfer.p_tx_buffer[offset] : NULL;
+    xfer.tx_length   = (xfer.tx_length > offset) ? MIN(xfer.tx_length - offset, DK_SPI_MNGR_MAX_CHUNK) : 0;
+    xfer.p_rx_buffer = (xfer.rx_length > offset) ? &xfer.p_rx_buffer[offset] : NULL;
+    xfer.rx_length   = (xfer.rx_length > offset) ? MIN(xfer.rx_length - offset, DK_SPI_MNGR_MAX_CHUNK) : 0;
+
+    return DRV_XFER(&p_dk_spi_mngr->spi, &xfer, 0);
+}
+
+static void transaction_end_signal(dk_spi_mngr_t const *p_dk_spi_mngr, ret_code_t result)
+{
+    // [use a local variable to avoid using two volatile variables in one
+    //  expression]
+    dk_spi_mngr_transaction_t transaction = p_dk_spi_mngr->p_dk_spi_mngr_cb->current_transaction;
+
+    pins_release(&transaction);
+
+    if (transaction.callback)
+    {
+        transaction.callback(result, transaction.p_user_data);
+    }
+}
+
+static void start_pending_transaction(dk_spi_mngr_t const *p_dk_spi_mngr, bool switch_transaction)
+{
+    ASSERT(p_dk_spi_mngr != NULL);
+
+    // Pointer for cleaner code.
+    dk_spi_mngr_cb_t *p_cb = p_dk_spi_mngr->p_dk_spi_mngr_cb;
+
+    for (;;)
+    {
+        if (!switch_transaction)
+        {
+            bool idle = false;
+
+            // Only the context that sets transaction_in_progress consumes the queue, the others leave the pending
+            // transactions to it.
+            if (!__atomic_compare_exchange_n(
+                  &p_cb->transaction_in_progress, &idle, true, false, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED))
+            {
+                return;
+            }
+        }
+
+        if (dk_mpsc_queue_pop(p_dk_spi_mngr->p_queue, (void *)(&p_cb->current_transaction)) != NRF_SUCCESS)
+        {
+            __atomic_store_n(&p_cb->transaction_in_progress, false, __ATOMIC_RELEASE);
+
+            // A producer may have published a transaction after the pop while the manager still looked busy.
+            if (dk_mpsc_queue_is_empty(p_dk_spi_mngr->p_queue))
+            {
+                return;
+            }
+
+            switch_transaction = false;
+            continue;
+        }
+
+        // [use a local variable to avoid using two volatile variables in one
+        //  expression]
+        dk_spi_mngr_transaction_t transaction = p_cb->current_transaction;
+
+        p_cb->offset = 0;
+        pins_select(&transaction);
+
+        ret_code_t result = start_transfer(p_dk_spi_mngr);
+
+        // If transaction started successfully there is nothing more to do here now.
+        if (result == NRF_SUCCESS)
+        {
+            return;
+        }
+
+        NRF_LOG_ERROR("Failed to start transaction 0x%x", result);
+
+        transaction_end_signal(p_dk_spi_mngr, result);
+
+        switch_transaction = true;
+    }
+}
+
+static void spi_event_handler(dk_spi_mngr_drv_evt_t const *p_event, void *p_context)
+{
+    ASSERT(p_event != NULL);
+    ASSERT(p_event->type == DRV_EVT_DONE);
+    UNUSED_PARAMETER(p_event);
+
+    DK_CPU_LOAD_WAKEUP();
+
+    dk_spi_mngr_t const *p_dk_spi_mngr = (dk_spi_mngr_t const *)p_context;
+    dk_spi_mngr_cb_t    *p_cb          = p_dk_spi_mngr->p_dk_spi_mngr_cb;
+
+    // [use a local variable to avoid using two volatile variables in one
+    //  expression]
+    dk_spi_mngr_transaction_t transaction = p_cb->current_transaction;
+    ret_code_t                result      = NRF_SUCCESS;
+
+    if (transaction_length_get(&transaction) - p_cb->offset > DK_SPI_MNGR_MAX_CHUNK)
+    {
+        p_cb->offset += DK_SPI_MNGR_MAX_CHUNK;
+
+        result = start_transfer(p_dk_spi_mngr);
+        if (result == NRF_SUCCESS)
+        {
+            return;
+        }
+
+        NRF_LOG_ERROR("Failed to continue transaction 0x%x", result);
+    }
+
+    transaction_end_signal(p_dk_spi_mngr, result);
+    start_pending_transaction(p_dk_spi_mngr, true);
+}
+
+ret_code_t dk_spi_mngr_init(dk_spi_mngr_t const *p_dk_spi_mngr, dk_spi_mngr_config_t const *p_default_spi_config)
+{
+    ASSERT(p_dk_spi_mngr != NULL);
+    ASSERT(p_dk_spi_mngr->p_queue != NULL);
+    ASSERT(p_default_spi_config != NULL);
+
+    // Chip select is driven per transaction.
+    if (p_default_spi_config->ss_pin != DK_SPI_MNGR_PIN_NOT_USED)
+    {
+        return NRF_ERROR_INVALID_PARAM;
+    }
+
+    dk_mpsc_queue_init(p_dk_spi_mngr->p_queue);
+
+    ret_code_t err_code =
+      DRV_INIT(&p_dk_spi_mngr->spi, p_default_spi_config, spi_event_handler, (void *)p_dk_spi_mngr);
+    VERIFY_SUCCESS(err_code);
+
+    p_dk_spi_mngr->p_dk_spi_mngr_cb->offset                  = 0;
+    p_dk_spi_mngr->p_dk_spi_mngr_cb->transaction_in_progress = false;
+
+    return NRF_SUCCESS;
+}
+
+void dk_spi_mngr_deinit(dk_spi_mngr_t const *p_dk_spi_mngr)
+{
+    ASSERT(p_dk_spi_mngr != NULL);
+
+    DRV_UNINIT(&p_dk_spi_mngr->spi);
+
+    p_dk_spi_mngr->p_dk_spi_mngr_cb->transaction_in_progress = false;
+}
+
+ret_code_t dk_spi_mngr_schedule(dk_spi_mngr_t const *p_dk_spi_mngr, dk_spi_mngr_transaction_t const *p_transaction)
+{
+    ASSERT(p_dk_spi_mngr != NULL);
+    ASSERT(p_transaction != NULL);
+
+    if (transaction_length_get(p_transaction) == 0)
+    {
+        return NRF_ERROR_INVALID_PARAM;
+    }
+
+    ret_code_t result = dk_mpsc_queue_push(p_dk_spi_mngr->p_queue, p_transaction);
+    if (result == NRF_SUCCESS)
+    {
+        // New transaction has been successfully added to queue,
+        // so if we are currently idle it's time to start the job.
+        start_pending_transaction(p_dk_spi_mngr, false);
+    }
+
+    return result;
+}
+
+ret_code_t dk_spi_mngr_schedule_multiple(dk_spi_mngr_t const             *p_dk_spi_mngr,
+                                         dk_spi_mngr_transaction_t const *p_transactions,
+                                         uint32_t                         count)
+{
+    ASSERT(p_dk_spi_mngr != NULL);
+    ASSERT(p_transactions != NULL);
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        if (transaction_length_get(&p_transactions[i]) == 0)
+        {
+            return NRF_ERROR_INVALID_PARAM;
+        }
+    }
+
+    ret_code_t result = NRF_SUCCESS;
+
+    // No other producer can claim a slot between the space check and the last push.
+    CRITICAL_REGION_ENTER();
+
+    if ((p_dk_spi_mngr->p_queue->size - dk_mpsc_queue_pending_count(p_dk_spi_mngr->p_queue)) < count)
+    {
+        result = NRF_ERROR_NO_MEM;
+    }
+
+    for (uint32_t i = 0; (i < count) && (result == NRF_SUCCESS); i++)
+    {
+        result = dk_mpsc_queue_push(p_dk_spi_mngr->p_queue, &p_transactions[i]);
+        ASSERT(result == NRF_SUCCESS);
+    }
+
+    CRITICAL_REGION_EXIT();
+
+    if ((result == NRF_SUCCESS) && (count > 0))
+    {
+        start_pending_transaction(p_dk_spi_mngr, false);
+    }
+
+    return result;
+}
+
+static void internal_transaction_cb(ret_code_t result, void *p_user_data)
+{
+    dk_spi_mngr_cb_data_t *p_cb_data = (dk_spi_mngr_cb_data_t *)p_user_data;
+
+    p_cb_data->transaction_result      = result;
+    p_cb_data->transaction_in_progress = false;
+}
+
+ret_code_t dk_spi_mngr_perform(dk_spi_mngr_t const *p_dk_spi_mngr, dk_spi_mngr_transaction_t const *p_transaction)
+{
+    ASSERT(p_dk_spi_mngr != NULL);
+    ASSERT(p_transaction != NULL);
+
+    dk_spi_mngr_cb_data_t     cb_data              = {.transaction_in_progress = true};
+    dk_spi_mngr_transaction_t internal_transaction = *p_transaction;
+
+    internal_transaction.callback    = internal_transaction_cb;
+    internal_transaction.p_user_data = (void *)&cb_data;
+
+    ret_code_t result = dk_spi_mngr_schedule(p_dk_spi_mngr, &internal_transaction);
+    VERIFY_SUCCESS(result);
+
+    while (cb_data.transaction_in_progress)
+    {
+        dk_wait_for_event();
+    }
+
+    return cb_data.transaction_result;
+}
+
+#endif // DK_MODULE_ENABLED(DK_SPI_MNGR)
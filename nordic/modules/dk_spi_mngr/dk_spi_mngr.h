@@ -0,0 +1,206 @@
+/**
+ * @file        dk_spi_mngr.h
+ * @author      Danius Kalvaitis (danius.kalvaitis@gmail.com)
+ * @brief       SPI manager that queues transactions of several devices sharing one SPI bus.
+ * @version     0.1
+ * @date        2026-10-17
+ *
+ * @copyright   Copyright (c) Danius Kalvaitis 2026 All rights reserved
+ *
+ */
+
+#ifndef DK_SPI_MNGR_H
+#define DK_SPI_MNGR_H
+
+#include "app_util.h"
+#include "dk_lib_common.h"
+#include "dk_mpsc_queue.h"
+
+/**
+ * @brief Use the SPIM peripheral (EasyDMA) instead of the legacy SPI peripheral.
+ *
+ * @note  EasyDMA can only access RAM, so transaction buffers must not be placed in flash.
+ */
+#ifndef DK_SPI_MNGR_USE_SPIM
+#define DK_SPI_MNGR_USE_SPIM 0
+#endif
+
+#if DK_SPI_MNGR_USE_SPIM
+#include "nrfx_spim.h"
+#else
+#include "nrfx_spi.h"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if DK_SPI_MNGR_USE_SPIM
+typedef nrfx_spim_t           dk_spi_mngr_drv_t;       ///< Driver instance.
+typedef nrfx_spim_config_t    dk_spi_mngr_config_t;    ///< Driver configuration.
+typedef nrfx_spim_xfer_desc_t dk_spi_mngr_xfer_desc_t; ///< Transfer description.
+typedef nrfx_spim_evt_t       dk_spi_mngr_drv_evt_t;   ///< Driver event.
+
+#define DK_SPI_MNGR_DRV_INSTANCE NRFX_SPIM_INSTANCE
+#define DK_SPI_MNGR_XFER_TRX     NRFX_SPIM_XFER_TRX
+#define DK_SPI_MNGR_XFER_TX      NRFX_SPIM_XFER_TX
+#define DK_SPI_MNGR_XFER_RX      NRFX_SPIM_XFER_RX
+#define DK_SPI_MNGR_PIN_NOT_USED NRFX_SPIM_PIN_NOT_USED
+
+/**
+ * @brief Maximum amount of bytes a single EasyDMA transfer can move. Longer transactions are split by the manager.
+ */
+#define DK_SPI_MNGR_MAX_CHUNK ((1UL << SPIM0_EASYDMA_MAXCNT_SIZE) - 1)
+#else
+typedef nrfx_spi_t           dk_spi_mngr_drv_t;       ///< Driver instance.
+typedef nrfx_spi_config_t    dk_spi_mngr_config_t;    ///< Driver configuration.
+typedef nrfx_spi_xfer_desc_t dk_spi_mngr_xfer_desc_t; ///< Transfer description.
+typedef nrfx_spi_evt_t       dk_spi_mngr_drv_evt_t;   ///< Driver event.
+
+#define DK_SPI_MNGR_DRV_INSTANCE NRFX_SPI_INSTANCE
+#define DK_SPI_MNGR_XFER_TRX     NRFX_SPI_XFER_TRX
+#define DK_SPI_MNGR_XFER_TX      NRFX_SPI_XFER_TX
+#define DK_SPI_MNGR_XFER_RX      NRFX_SPI_XFER_RX
+#define DK_SPI_MNGR_PIN_NOT_USED NRFX_SPI_PIN_NOT_USED
+
+/**
+ * @brief The legacy driver moves the data byte by byte, transactions are never split.
+ */
+#define DK_SPI_MNGR_MAX_CHUNK SIZE_MAX
+#endif
+
+typedef void (*dk_spi_mngr_callback_t)(ret_code_t result, void *p_user_data);
+
+/**
+ * @brief SPI manager transaction.
+ *
+ * @details The manager drives @p dc_pin to @p dc_state and @p cs_pin low before the transfer and releases @p cs_pin
+ *          after it, so devices with their own chip select and data/command line share one bus. Both pins have to
+ *          be configured as outputs (chip select idle high) by the device driver. The bus driver has to be
+ *          configured without a slave select pin.
+ *
+ * @note    Buffers are not copied, they must stay valid until the callback is called.
+ */
+typedef struct
+{
+    dk_spi_mngr_callback_t  callback;    ///< Function to be called after the transaction is finished (can be NULL).
+    void                   *p_user_data; ///< Pointer to user data to be passed to the callback.
+    dk_spi_mngr_xfer_desc_t xfer_desc;   ///< TX and RX buffers of the transaction.
+    uint8_t                 cs_pin;      ///< Chip select pin, @ref DK_SPI_MNGR_PIN_NOT_USED if not used.
+    uint8_t                 dc_pin;      ///< Data/command pin, @ref DK_SPI_MNGR_PIN_NOT_USED if not used.
+    bool                    dc_state;    ///< Level of @p dc_pin during the transaction.
+} dk_spi_mngr_transaction_t;
+
+typedef struct
+{
+    volatile dk_spi_mngr_transaction_t current_transaction;     ///< Currently realized transaction.
+    volatile bool                      transaction_in_progress; ///< Transaction is in progress.
+    volatile size_t                    offset;                  ///< Bytes of the transaction already transferred.
+} dk_spi_mngr_cb_t;
+
+typedef struct
+{
+    dk_spi_mngr_cb_t      *p_dk_spi_mngr_cb; ///< Control block of instance.
+    dk_mpsc_queue_t const *p_queue;          ///< Transaction queue.
+    dk_spi_mngr_drv_t      spi;              ///< SPI master driver instance.
+} dk_spi_mngr_t;
+
+/**
+ * @brief Macro for defining a SPI manager instance.
+ *
+ * @param _dk_spi_mngr_name Name of the instance.
+ * @param _queue_size       Size of the transaction queue, has to be a power of two.
+ * @param _spi_idx          Index of the SPI peripheral.
+ */
+#define DK_SPI_MNGR_DEF(_dk_spi_mngr_name, _queue_size, _spi_idx)                                                      \
+    DK_MPSC_QUEUE_DEF(dk_spi_mngr_transaction_t, _dk_spi_mngr_name##_queue, (_queue_size));                            \
+    static dk_spi_mngr_cb_t    CONCAT_2(_dk_spi_mngr_name, _cb);                                                       \
+    static const dk_spi_mngr_t _dk_spi_mngr_name = {.p_dk_spi_mngr_cb = &CONCAT_2(_dk_spi_mngr_name, _cb),             \
+                                                    .p_queue          = &_dk_spi_mngr_name##_queue,                    \
+                                                    .spi              = DK_SPI_MNGR_DRV_INSTANCE(_spi_idx)}
+
+/**
+ * @brief       Initialize the SPI manager and the SPI driver.
+ *
+ * @note        SPI instances share their IDs with TWI instances (SPI0 with TWI0, SPI1 with TWI1), so those TWI
+ *              instances can not be used at the same time.
+ *
+ * @param[in]   p_dk_spi_mngr           Pointer to SPI manager instance.
+ * @param[in]   p_default_spi_config    Driver configuration (pins, frequency, mode).
+ *
+ * @retval      NRF_SUCCESS             If the manager was initialized.
+ * @retval      NRF_ERROR_INVALID_PARAM If the configuration uses a slave select pin.
+ * @retval      Other                   Error codes returned by the driver.
+ */
+ret_code_t dk_spi_mngr_init(dk_spi_mngr_t const *p_dk_spi_mngr, dk_spi_mngr_config_t const *p_default_spi_config);
+
+/**
+ * @brief       Deinitialize the SPI manager and the SPI driver.
+ *
+ * @param[in]   p_dk_spi_mngr   Pointer to SPI manager instance.
+ */
+void dk_spi_mngr_deinit(dk_spi_mngr_t const *p_dk_spi_mngr);
+
+/**
+ * @brief       Schedule a transaction.
+ *
+ * @details     Safe to call from any context. The transaction is copied into the queue and started as soon as the
+ *              bus is free.
+ *
+ * @param[in]   p_dk_spi_mngr           Pointer to SPI manager instance.
+ * @param[in]   p_transaction           Pointer to transaction.
+ *
+ * @retval      NRF_SUCCESS             If the transaction was scheduled.
+ * @retval      NRF_ERROR_INVALID_PARAM If the transaction has no data.
+ * @retval      NRF_ERROR_NO_MEM        If the queue is full.
+ */
+ret_code_t dk_spi_mngr_schedule(dk_spi_mngr_t const *p_dk_spi_mngr, dk_spi_mngr_transaction_t const *p_transaction);
+
+/**
+ * @brief       Schedule several transactions as one unit.
+ *
+ * @details     Either all transactions are queued back to back or none is, so a full queue never leaves a partial
+ *              unit on the bus. Safe to call from any context.
+ *
+ * @param[in]   p_dk_spi_mngr           Pointer to SPI manager instance.
+ * @param[in]   p_transactions          Array of transactions, performed in the order of the array.
+ * @param[in]   count                   Amount of transactions in @p p_transactions.
+ *
+ * @retval      NRF_SUCCESS             If all transactions were scheduled.
+ * @retval      NRF_ERROR_INVALID_PARAM If any of the transactions has no data.
+ * @retval      NRF_ERROR_NO_MEM        If the queue has no room for all transactions, none was scheduled.
+ */
+ret_code_t dk_spi_mngr_schedule_multiple(dk_spi_mngr_t const             *p_dk_spi_mngr,
+                                         dk_spi_mngr_transaction_t const *p_transactions,
+                                         uint32_t                         count);
+
+/**
+ * @brief       Perform a transaction in a blocking manner.
+ *
+ * @details     The transaction is queued behind the already scheduled ones, the CPU sleeps until it is finished. SPI
+ *              transfers can not be stalled by a slave, so there is no timeout.
+ *
+ * @warning     Must not be called from an interrupt with priority equal to or higher than the SPI interrupt.
+ *
+ * @param[in]   p_dk_spi_mngr   Pointer to SPI manager instance.
+ * @param[in]   p_transaction   Pointer to transaction, its callback and user data are ignored.
+ *
+ * @retval      NRF_SUCCESS     If the transaction was performed.
+ * @retval      Other           Error codes returned by @ref dk_spi_mngr_schedule or the driver.
+ */
+ret_code_t dk_spi_mngr_perform(dk_spi_mngr_t const *p_dk_spi_mngr, dk_spi_mngr_transaction_t const *p_transaction);
+
+__STATIC_INLINE bool dk_spi_mngr_is_idle(dk_spi_mngr_t const *p_dk_spi_mngr);
+
+#ifndef SUPPRESS_INLINE_IMPLEMENTATION
+__STATIC_INLINE bool dk_spi_mngr_is_idle(dk_spi_mngr_t const *p_dk_spi_mngr)
+{
+    return (!p_dk_spi_mngr->p_dk_spi_mngr_cb->transaction_in_progress);
+}
+#endif // SUPPRESS_INLINE_IMPLEMENTATION
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // DK_SPI_MNGR_H
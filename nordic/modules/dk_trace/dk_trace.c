@@ -0,0 +1,78 @@
+/**
+ * @file        dk_trace.c
+ * @author      Danius Kalvaitis (danius.kalvaitis@gmail.com)
+ * @brief       Binary event tracer for hot paths where string logging is too heavy.
+ * @version     0.1
+ * @date        2026-10-17
+ *
+ * @copyright   Copyright (c) Danius Kalvaitis 2026 All rights reserved
+ *
+ */
+
+#include "dk_lib_common.h"
+#if DK_MODULE_ENABLED(DK_TRACE)
+
+#include "dk_trace.h"
+
+#include <string.h>
+
+#include "app_timer.h"
+#include "app_util.h"
+
+STATIC_ASSERT(IS_POWER_OF_TWO(DK_TRACE_BUFFER_SIZE));
+STATIC_ASSERT(DK_TRACE_BUFFER_SIZE <= UINT16_MAX);
+STATIC_ASSERT(sizeof(dk_trace_record_t) == 16);
+
+static dk_trace_buffer_t m_dk_trace;
+
+void dk_trace_init(void)
+{
+    dk_trace_enable(false);
+
+    memset(m_dk_trace.records, 0, sizeof(m_dk_trace.records));
+
+    // Position 0 must not look written, every record starts with a sequence number from the previous lap.
+    for (uint32_t i = 0; i < DK_TRACE_BUFFER_SIZE; i++)
+    {
+        m_dk_trace.records[i].seq = (uint16_t)(i - DK_TRACE_BUFFER_SIZE);
+    }
+
+    m_dk_trace.magic          = DK_TRACE_MAGIC;
+    m_dk_trace.size           = DK_TRACE_BUFFER_SIZE;
+    m_dk_trace.timestamp_hz   = DK_TRACE_TIMESTAMP_HZ;
+    m_dk_trace.timestamp_mask = DK_TRACE_TIMESTAMP_MASK;
+    m_dk_trace.write_pos      = 0;
+
+    dk_trace_enable(true);
+}
+
+void dk_trace_enable(bool enable)
+{
+    __atomic_store_n(&m_dk_trace.enabled, (uint32_t)enable, __ATOMIC_RELEASE);
+}
+
+void dk_trace_record(uint16_t id, uint32_t arg0, uint32_t arg1)
+{
+    if (!__atomic_load_n(&m_dk_trace.enabled, __ATOMIC_ACQUIRE))
+    {
+        return;
+    }
+
+    uint32_t           pos      = __atomic_fetch_add(&m_dk_trace.write_pos, 1, __ATOMIC_RELAXED);
+    dk_trace_record_t *p_record = &m_dk_trace.records[pos & (DK_TRACE_BUFFER_SIZE - 1)];
+
+    p_record->timestamp = DK_TRACE_TIMESTAMP_GET();
+    p_record->id        = id;
+    p_record->arg0      = arg0;
+    p_record->arg1      = arg1;
+
+    // Publish the record, until now it carries the sequence number of the previous lap.
+    __atomic_store_n(&p_record->seq, (uint16_t)pos, __ATOMIC_RELEASE);
+}
+
+dk_trace_buffer_t const *dk_trace_buffer_get(void)
+{
+    return &m_dk_trace;
+}
+
+#endif // DK_MODULE_ENABLED(DK_TRACE)
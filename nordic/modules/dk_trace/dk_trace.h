@@ -0,0 +1,164 @@
+/**
+ * @file        dk_trace.h
+ * @author      Danius Kalvaitis (danius.kalvaitis@gmail.com)
+ * @brief       Binary event tracer for hot paths where string logging is too heavy.
+ * @version     0.1
+ * @date        2026-10-17
+ *
+ * @copyright   Copyright (c) Danius Kalvaitis 2026 All rights reserved
+ *
+ */
+
+#ifndef DK_TRACE_H
+#define DK_TRACE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "dk_lib_common.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Amount of records the trace buffer holds, has to be a power of two. The oldest records are overwritten.
+ */
+#ifndef DK_TRACE_BUFFER_SIZE
+#define DK_TRACE_BUFFER_SIZE 256
+#endif
+
+/**
+ * @brief Timestamp source of the records, app_timer counter by default.
+ */
+#ifndef DK_TRACE_TIMESTAMP_GET
+#define DK_TRACE_TIMESTAMP_GET() app_timer_cnt_get()
+#endif
+
+/**
+ * @brief Frequency of @ref DK_TRACE_TIMESTAMP_GET in Hz.
+ */
+#ifndef DK_TRACE_TIMESTAMP_HZ
+#define DK_TRACE_TIMESTAMP_HZ (APP_TIMER_CLOCK_FREQ / (APP_TIMER_CONFIG_RTC_FREQUENCY + 1))
+#endif
+
+/**
+ * @brief Highest value of @ref DK_TRACE_TIMESTAMP_GET before it wraps around.
+ */
+#ifndef DK_TRACE_TIMESTAMP_MASK
+#define DK_TRACE_TIMESTAMP_MASK APP_TIMER_MAX_CNT_VAL
+#endif
+
+/**
+ * @brief Value of @ref dk_trace_buffer_t.magic.
+ */
+#define DK_TRACE_MAGIC 0x444B5452
+
+/**
+ * @brief Trace event IDs.
+ *
+ * @details The high byte groups the events of one module, every group is shown as its own track by the decoder.
+ *          Modules with several instances put the instance into arg0 with @ref DK_TRACE_INSTANCE_ARG, so every
+ *          instance gets its own track. Events ending with _BEGIN and _END delimit a span, the others are instant.
+ *          The decoder reads the names from this enum, keep one enumerator per line.
+ */
+typedef enum
+{
+    DK_TRACE_EVT_TWI_MNGR_SCHEDULE   = 0x0100, ///< Transaction queued, args: bus and slave address, priority.
+    DK_TRACE_EVT_TWI_MNGR_XFER_BEGIN = 0x0101, ///< Transaction put on the bus, args: bus and slave address, priority.
+    DK_TRACE_EVT_TWI_MNGR_XFER_END   = 0x0102, ///< Transaction finished, args: bus and slave address, result.
+    DK_TRACE_EVT_TWI_MNGR_IRQ        = 0x0103, ///< Driver event, args: bus and event type, transfer index.
+    DK_TRACE_EVT_LSM9DS1_READ_BEGIN  = 0x0200, ///< Register read started, args: slave address, register.
+    DK_TRACE_EVT_LSM9DS1_READ_END    = 0x0201, ///< Register read finished, args: slave address, success.
+    DK_TRACE_EVT_MLX90615_CALLBACK   = 0x0300, ///< Transaction callback, args: event type, result.
+    DK_TRACE_EVT_BLE_NOTIFY          = 0x0400, ///< Notification sent, args: value handle, result.
+    DK_TRACE_EVT_USER                = 0x8000, ///< First ID free for application events.
+} dk_trace_evt_id_t;
+
+/**
+ * @brief Macro for putting the module instance into the high byte of arg0.
+ *
+ * @param _instance Instance of the module, e.g. the driver instance index of a bus.
+ * @param _arg0     First event argument, 24 bits.
+ */
+#define DK_TRACE_INSTANCE_ARG(_instance, _arg0) ((((uint32_t)(_instance)) << 24) | (((uint32_t)(_arg0)) & 0xFFFFFF))
+
+/**
+ * @brief Trace record.
+ */
+typedef struct
+{
+    uint32_t          timestamp; ///< Timestamp taken with @ref DK_TRACE_TIMESTAMP_GET.
+    uint16_t          id;        ///< Event ID, see @ref dk_trace_evt_id_t.
+    volatile uint16_t seq;       ///< Lower bits of the record position, written last so torn records can be skipped.
+    uint32_t          arg0;      ///< First event argument.
+    uint32_t          arg1;      ///< Second event argument.
+} dk_trace_record_t;
+
+/**
+ * @brief Trace buffer.
+ *
+ * @details The whole structure is dumped as is (little endian) and decoded on the host by scripts/dk_trace_decode.py.
+ */
+typedef struct
+{
+    uint32_t          magic;                         ///< @ref DK_TRACE_MAGIC once initialized.
+    uint32_t          size;                          ///< Amount of records, @ref DK_TRACE_BUFFER_SIZE.
+    uint32_t          timestamp_hz;                  ///< @ref DK_TRACE_TIMESTAMP_HZ.
+    uint32_t          timestamp_mask;                ///< @ref DK_TRACE_TIMESTAMP_MASK.
+    volatile uint32_t write_pos;                     ///< Next position to be claimed by a writer.
+    volatile uint32_t enabled;                       ///< Records are written.
+    dk_trace_record_t records[DK_TRACE_BUFFER_SIZE]; ///< Ring of records.
+} dk_trace_buffer_t;
+
+#if DK_MODULE_ENABLED(DK_TRACE)
+/**
+ * @brief Macro for recording an event, compiled out when the module is disabled.
+ *
+ * @param _id   Event ID.
+ * @param _arg0 First event argument.
+ * @param _arg1 Second event argument.
+ */
+#define DK_TRACE(_id, _arg0, _arg1) dk_trace_record((_id), (uint32_t)(_arg0), (uint32_t)(_arg1))
+#else
+#define DK_TRACE(_id, _arg0, _arg1)
+#endif
+
+/**
+ * @brief       Clear the trace buffer and start recording.
+ */
+void dk_trace_init(void);
+
+/**
+ * @brief       Start or stop recording.
+ *
+ * @details     Stop recording before the buffer is dumped, so the dump is not overwritten while it is read.
+ *
+ * @param[in]   enable  True to record events, false to drop them.
+ */
+void dk_trace_enable(bool enable);
+
+/**
+ * @brief       Record an event.
+ *
+ * @details     Safe to call from any context. Writers claim their record with an atomic increment and never wait for
+ *              each other.
+ *
+ * @param[in]   id      Event ID.
+ * @param[in]   arg0    First event argument.
+ * @param[in]   arg1    Second event argument.
+ */
+void dk_trace_record(uint16_t id, uint32_t arg0, uint32_t arg1);
+
+/**
+ * @brief       Get the trace buffer to be dumped.
+ *
+ * @return      Pointer to trace buffer, sizeof(dk_trace_buffer_t) bytes long.
+ */
+dk_trace_buffer_t const *dk_trace_buffer_get(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // DK_TRACE_H
@@ -0,0 +1,144 @@
+/**
+ * @file        dk_twi_bus_group.c
+ * @author      Danius Kalvaitis (danius.kalvaitis@gmail.com)
+ * @brief       Group of TWI managers that schedules transactions to the bus of the addressed device.
+ * @version     0.1
+ * @date        2026-10-17
+ *
+ * @copyright   Copyright (c) Danius Kalvaitis 2026 All rights reserved
+ *
+ */
+
+#include "dk_lib_common.h"
+#if DK_MODULE_ENABLED(DK_TWI_BUS_GROUP)
+
+#include "dk_twi_bus_group.h"
+
+#include "nrf_assert.h"
+
+#if !DK_MODULE_ENABLED(DK_TWI_MNGR)
+#error "Enable DK_TWI_MNGR module in dk_config!"
+#endif
+
+ret_code_t dk_twi_bus_group_init(dk_twi_bus_group_t const *p_group, dk_twi_mngr_config_t const *p_configs)
+{
+    ASSERT(p_group != NULL);
+    ASSERT(p_group->pp_buses != NULL);
+    ASSERT(p_configs != NULL);
+
+    ret_code_t err_code;
+
+    for (uint8_t i = 0; i < p_group->device_count; i++)
+    {
+        if (p_group->p_device_bus[i] >= p_group->bus_count)
+        {
+            return NRF_ERROR_INVALID_PARAM;
+        }
+    }
+
+    for (uint8_t i = 0; i < p_group->bus_count; i++)
+    {
+        err_code = dk_twi_mngr_init(p_group->pp_buses[i], &p_configs[i]);
+
+        if (err_code != NRF_SUCCESS)
+        {
+            while (i-- > 0)
+            {
+                dk_twi_mngr_deinit(p_group->pp_buses[i]);
+            }
+
+            return err_code;
+        }
+    }
+
+    return NRF_SUCCESS;
+}
+
+void dk_twi_bus_group_deinit(dk_twi_bus_group_t const *p_group)
+{
+    ASSERT(p_group != NULL);
+
+    for (uint8_t i = 0; i < p_group->bus_count; i++)
+    {
+        dk_twi_mngr_deinit(p_group->pp_buses[i]);
+    }
+}
+
+dk_twi_mngr_t const *dk_twi_bus_group_mngr_get(dk_twi_bus_group_t const *p_group, uint8_t device)
+{
+    ASSERT(p_group != NULL);
+
+    if (device >= p_group->device_count)
+    {
+        return NULL;
+    }
+
+    return p_group->pp_buses[p_group->p_device_bus[device]];
+}
+
+ret_code_t dk_twi_bus_group_schedule(dk_twi_bus_group_t const        *p_group,
+                                     uint8_t                          device,
+                                     dk_twi_mngr_transaction_t const *p_transaction)
+{
+    dk_twi_mngr_t const *p_dk_twi_mngr = dk_twi_bus_group_mngr_get(p_group, device);
+
+    if (p_dk_twi_mngr == NULL)
+    {
+        return NRF_ERROR_INVALID_PARAM;
+    }
+
+    return dk_twi_mngr_schedule(p_dk_twi_mngr, p_transaction);
+}
+
+ret_code_t dk_twi_bus_group_perform(dk_twi_bus_group_t const     *p_group,
+                                    uint8_t                       device,
+                                    dk_twi_mngr_transfer_t const *p_transfer,
+                                    uint32_t                      timeout_ms)
+{
+    dk_twi_mngr_t const *p_dk_twi_mngr = dk_twi_bus_group_mngr_get(p_group, device);
+
+    if (p_dk_twi_mngr == NULL)
+    {
+        return NRF_ERROR_INVALID_PARAM;
+    }
+
+    return dk_twi_mngr_perform_timeout(p_dk_twi_mngr, p_transfer, timeout_ms);
+}
+
+void *dk_twi_bus_group_data_buffer_alloc(dk_twi_bus_group_t const *p_group, uint8_t device, uint32_t size)
+{
+    dk_twi_mngr_t const *p_dk_twi_mngr = dk_twi_bus_group_mngr_get(p_group, device);
+
+    if (p_dk_twi_mngr == NULL)
+    {
+        return NULL;
+    }
+
+    return dk_twi_mngr_data_buffer_alloc(p_dk_twi_mngr, size);
+}
+
+void dk_twi_bus_group_data_buffer_free(dk_twi_bus_group_t const *p_group, uint8_t device, void *p_buffer)
+{
+    dk_twi_mngr_t const *p_dk_twi_mngr = dk_twi_bus_group_mngr_get(p_group, device);
+
+    ASSERT(p_dk_twi_mngr != NULL);
+
+    dk_twi_mngr_data_buffer_free(p_dk_twi_mngr, p_buffer);
+}
+
+bool dk_twi_bus_group_is_idle(dk_twi_bus_group_t const *p_group)
+{
+    ASSERT(p_group != NULL);
+
+    for (uint8_t i = 0; i < p_group->bus_count; i++)
+    {
+        if (!dk_twi_mngr_is_idle(p_group->pp_buses[i]))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+#endif // DK_MODULE_ENABLED(DK_TWI_BUS_GROUP)
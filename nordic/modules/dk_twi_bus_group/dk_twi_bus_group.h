@@ -0,0 +1,170 @@
+/**
+ * @file        dk_twi_bus_group.h
+ * @author      Danius Kalvaitis (danius.kalvaitis@gmail.com)
+ * @brief       Group of TWI managers that schedules transactions to the bus of the addressed device.
+ * @version     0.1
+ * @date        2026-10-17
+ *
+ * @copyright   Copyright (c) Danius Kalvaitis 2026 All rights reserved
+ *
+ */
+
+#ifndef DK_TWI_BUS_GROUP_H
+#define DK_TWI_BUS_GROUP_H
+
+#include "dk_twi_mngr.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Maximum amount of buses in a group. nRF52 has two TWI instances.
+ */
+#ifndef DK_TWI_BUS_GROUP_MAX_BUSES
+#define DK_TWI_BUS_GROUP_MAX_BUSES 2
+#endif
+
+/**
+ * @brief TWI bus group instance.
+ *
+ * @details Every bus is driven by its own TWI manager, so transactions of devices on different buses are performed
+ *          in parallel. Devices are identified by an application defined index into @p p_device_bus, which holds
+ *          the bus index of every device.
+ */
+typedef struct
+{
+    dk_twi_mngr_t const *const *pp_buses;     ///< TWI managers of the buses.
+    uint8_t const              *p_device_bus; ///< Bus index of every device.
+    uint8_t                     bus_count;    ///< Amount of buses.
+    uint8_t                     device_count; ///< Amount of devices.
+} dk_twi_bus_group_t;
+
+/**
+ * @brief Macro for defining a TWI bus group instance.
+ *
+ * @details Bus affinity of the devices is fixed at compile time, e.g.:
+ * @code
+ * DK_TWI_MNGR_DEF(m_twi_bus_0, 8, 8, 8, 0, 4, 2);
+ * DK_TWI_MNGR_DEF(m_twi_bus_1, 8, 8, 8, 1, 4, 2);
+ *
+ * static dk_twi_mngr_t const *const m_buses[]      = {&m_twi_bus_0, &m_twi_bus_1};
+ * static uint8_t const              m_device_bus[] = {[APP_DEVICE_IMU] = 0, [APP_DEVICE_LED] = 1};
+ *
+ * DK_TWI_BUS_GROUP_DEF(m_twi_bus_group, m_buses, m_device_bus);
+ * @endcode
+ *
+ * @param _name         Name of the instance.
+ * @param _buses        Array of pointers to TWI manager instances, one per bus.
+ * @param _device_bus   Array with the bus index of every device.
+ */
+#define DK_TWI_BUS_GROUP_DEF(_name, _buses, _device_bus)                                                               \
+    STATIC_ASSERT(ARRAY_SIZE(_buses) <= DK_TWI_BUS_GROUP_MAX_BUSES);                                                   \
+    static const dk_twi_bus_group_t _name = {.pp_buses     = (_buses),                                                 \
+                                             .p_device_bus = (_device_bus),                                            \
+                                             .bus_count    = ARRAY_SIZE(_buses),                                       \
+                                             .device_count = ARRAY_SIZE(_device_bus)}
+
+/**
+ * @brief       Initialize all buses of the group.
+ *
+ * @note        TWI instances share their IDs with SPI instances (TWI0 with SPI0, TWI1 with SPI1), so those SPI
+ *              instances can not be used at the same time.
+ *
+ * @param[in]   p_group                 Pointer to bus group instance.
+ * @param[in]   p_configs               Array with the driver configuration of every bus (pins, frequency).
+ *
+ * @retval      NRF_SUCCESS             If all buses were initialized.
+ * @retval      NRF_ERROR_INVALID_PARAM If a device is mapped to a bus that is not in the group.
+ * @retval      Other                   Error codes returned by @ref dk_twi_mngr_init. Buses that were already
+ *                                      initialized are deinitialized again.
+ */
+ret_code_t dk_twi_bus_group_init(dk_twi_bus_group_t const *p_group, dk_twi_mngr_config_t const *p_configs);
+
+/**
+ * @brief       Deinitialize all buses of the group.
+ *
+ * @param[in]   p_group Pointer to bus group instance.
+ */
+void dk_twi_bus_group_deinit(dk_twi_bus_group_t const *p_group);
+
+/**
+ * @brief       Get the TWI manager of the bus a device is on.
+ *
+ * @details     Can be used to bind drivers that take a TWI manager instance to the bus of their device.
+ *
+ * @param[in]   p_group Pointer to bus group instance.
+ * @param[in]   device  Index of the device.
+ *
+ * @return      Pointer to TWI manager instance or NULL if the device is not in the group.
+ */
+dk_twi_mngr_t const *dk_twi_bus_group_mngr_get(dk_twi_bus_group_t const *p_group, uint8_t device);
+
+/**
+ * @brief       Schedule a transaction on the bus of a device.
+ *
+ * @param[in]   p_group                 Pointer to bus group instance.
+ * @param[in]   device                  Index of the device.
+ * @param[in]   p_transaction           Pointer to transaction.
+ *
+ * @retval      NRF_SUCCESS             If the transaction was scheduled.
+ * @retval      NRF_ERROR_INVALID_PARAM If the device is not in the group.
+ * @retval      Other                   Error codes returned by @ref dk_twi_mngr_schedule.
+ */
+ret_code_t dk_twi_bus_group_schedule(dk_twi_bus_group_t const        *p_group,
+                                     uint8_t                          device,
+                                     dk_twi_mngr_transaction_t const *p_transaction);
+
+/**
+ * @brief       Perform a transfer on the bus of a device in a blocking manner.
+ *
+ * @details     Only the bus of the device is waited for, the other buses keep running.
+ *
+ * @param[in]   p_group                 Pointer to bus group instance.
+ * @param[in]   device                  Index of the device.
+ * @param[in]   p_transfer              Pointer to transfer.
+ * @param[in]   timeout_ms              Time in milliseconds to wait for the transfer.
+ *
+ * @retval      NRF_SUCCESS             If the transfer was performed successfully.
+ * @retval      NRF_ERROR_INVALID_PARAM If the device is not in the group.
+ * @retval      Other                   Error codes returned by @ref dk_twi_mngr_perform_timeout.
+ */
+ret_code_t dk_twi_bus_group_perform(dk_twi_bus_group_t const     *p_group,
+                                    uint8_t                       device,
+                                    dk_twi_mngr_transfer_t const *p_transfer,
+                                    uint32_t                      timeout_ms);
+
+/**
+ * @brief       Allocate a data buffer from the pool of the bus a device is on.
+ *
+ * @param[in]   p_group Pointer to bus group instance.
+ * @param[in]   device  Index of the device.
+ * @param[in]   size    Size of the buffer in bytes.
+ *
+ * @return      Pointer to buffer or NULL if the device is not in the group or no buffer is available.
+ */
+void *dk_twi_bus_group_data_buffer_alloc(dk_twi_bus_group_t const *p_group, uint8_t device, uint32_t size);
+
+/**
+ * @brief       Return a data buffer to the pool of the bus a device is on.
+ *
+ * @param[in]   p_group     Pointer to bus group instance.
+ * @param[in]   device      Index of the device.
+ * @param[in]   p_buffer    Pointer to buffer allocated with @ref dk_twi_bus_group_data_buffer_alloc.
+ */
+void dk_twi_bus_group_data_buffer_free(dk_twi_bus_group_t const *p_group, uint8_t device, void *p_buffer);
+
+/**
+ * @brief       Check if all buses of the group are idle.
+ *
+ * @param[in]   p_group Pointer to bus group instance.
+ *
+ * @return      True if no bus has a transaction in progress, false otherwise.
+ */
+bool dk_twi_bus_group_is_idle(dk_twi_bus_group_t const *p_group);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // DK_TWI_BUS_GROUP_H
@@ -1,9 +1,9 @@
 /**
  * @file        dk_twi_mngr.c
  * @author      Danius Kalvaitis (danius.kalvaitis@gmail.com)
- * @brief       TWI manager that implements a FIFO buffer on top on nrf_twi_mngr.
- * @version     0.2
- * @date        2024-08-15
+ * @brief       TWI manager that queues prioritized transactions of devices sharing one TWI bus.
+ * @version     0.3
+ * @date        2026-10-17
  *
  * @copyright   Copyright (c) Danius Kalvaitis 2024 All rights reserved
  *
@@ -14,6 +14,18 @@
 
 #include "dk_twi_mngr.h"
 
+#include <string.h>
+
+#include "dk_cpu_load.h"
+#include "dk_profile.h"
+#include "dk_trace.h"
+#include "dk_twi.h"
+#include "dk_wait_for_event.h"
+
+#if DK_TWI_MNGR_DEFERRED_CB_ENABLED
+#include "app_scheduler.h"
+#endif
+
 #define NRF_LOG_MODULE_NAME DK_TWI_MNGR
 #include "nrf_log.h"
 #include "nrf_log_ctrl.h"
@@ -23,156 +35,2217 @@ NRF_LOG_MODULE_REGISTER();
 // #error "Enable NRF_TWI_MNGR module in sdk_config!"
 // #endif
 
-typedef volatile struct
-{
-    bool    transaction_in_progress;
-    uint8_t transaction_result;
-} dk_twi_mngr_cb_data_t;
+#if !DK_MODULE_ENABLED(DK_MPSC_QUEUE)
+#error "Enable DK_MPSC_QUEUE module in dk_config!"
+#endif
+
+// Driver functions of the selected backend.
+#if DK_TWI_MNGR_USE_TWIM
+#define DRV_INIT              nrfx_twim_init
+#define DRV_UNINIT            nrfx_twim_uninit
+#define DRV_ENABLE            nrfx_twim_enable
+#define DRV_XFER              nrfx_twim_xfer
+#define DRV_DISABLE           dk_twim_disable
+#define DRV_IRQ_NUMBER(p_drv) nrfx_get_irq_number((p_drv)->p_twim)
+#define DRV_XFER_TX           NRFX_TWIM_XFER_TX
+#define DRV_XFER_TXRX         NRFX_TWIM_XFER_TXRX
+#define DRV_EVT_DONE          NRFX_TWIM_EVT_DONE
+#else
+#define DRV_INIT              nrfx_twi_init
+#define DRV_UNINIT            nrfx_twi_uninit
+#define DRV_ENABLE            nrfx_twi_enable
+#define DRV_XFER              nrfx_twi_xfer
+#define DRV_DISABLE           dk_twi_disable
+#define DRV_IRQ_NUMBER(p_drv) nrfx_get_irq_number((p_drv)->p_twi)
+#define DRV_XFER_TX           NRFX_TWI_XFER_TX
+#define DRV_XFER_TXRX         NRFX_TWI_XFER_TXRX
+#define DRV_EVT_DONE          NRFX_TWI_EVT_DONE
+#endif
+
+typedef volatile struct
+{
+    bool       transaction_in_progress;
+    bool       timed_out;
+    ret_code_t transaction_result;
+} dk_twi_mngr_cb_data_t;
+
+/**
+ * @brief Free list index marking the end of the list, pools have at most UINT16_MAX blocks.
+ */
+#define BUFF_POOL_NIL UINT16_MAX
+
+/**
+ * @brief Free list head with the given first block and the tag of the previous head incremented.
+ *
+ * @details The tag changes on every push and pop, so a head that was popped and pushed back in between is not
+ *          mistaken for an unchanged one (ABA problem).
+ */
+#define BUFF_POOL_HEAD(_prev_head, _block) ((((_prev_head) + (1UL << 16)) & ~(uint32_t)UINT16_MAX) | (_block))
+
+static void buff_pools_init(dk_twi_mngr_t const *p_dk_twi_mngr)
+{
+    for (uint8_t i = 0; i < DK_TWI_MNGR_BUFF_CLASS_COUNT; i++)
+    {
+        dk_twi_mngr_buff_pool_t const       *p_pool    = &p_dk_twi_mngr->buff_pool[i];
+        volatile dk_twi_mngr_buff_pool_cb_t *p_pool_cb = &p_dk_twi_mngr->p_dk_twi_mngr_cb->buff_pool_cb[i];
+
+        for (uint16_t block = 0; block < p_pool->block_count; block++)
+        {
+            p_pool->p_next_free[block] = block + 1;
+        }
+
+        p_pool->p_next_free[p_pool->block_count - 1] = BUFF_POOL_NIL;
+
+        p_pool_cb->free_head       = 0;
+        p_pool_cb->free_count      = p_pool->block_count;
+        p_pool_cb->max_utilization = 0;
+    }
+}
+
+/**
+ * @brief Order in which the priority queues are drained.
+ */
+static const dk_twi_mngr_priority_t m_priority_order[DK_TWI_MNGR_PRIORITY_COUNT] = {
+  DK_TWI_MNGR_PRIORITY_HIGH,
+  DK_TWI_MNGR_PRIORITY_NORMAL,
+  DK_TWI_MNGR_PRIORITY_LOW,
+};
+
+static bool mux_switch_required(dk_twi_mngr_cb_t const *p_cb, dk_twi_mngr_transaction_t const *p_transaction)
+{
+    return (p_cb->mux_address != 0) && (p_transaction->mux_channels != 0) &&
+           (!p_cb->mux_valid || (p_transaction->mux_channels != p_cb->mux_channels));
+}
+
+/**
+ * @brief       Move a queued transaction to the front of its queue. The passed transactions keep their order.
+ *
+ * @details     Must be called from a critical region.
+ *
+ * @param[in]   p_queue Queue of the transaction.
+ * @param[in]   offset  Offset of the transaction from the front of the queue.
+ */
+static void pending_to_front(dk_mpsc_queue_t const *p_queue, uint32_t offset)
+{
+    dk_twi_mngr_transaction_t moved = *(dk_twi_mngr_transaction_t *)dk_mpsc_queue_pending_get(p_queue, offset);
+
+    for (uint32_t i = offset; i > 0; i--)
+    {
+        dk_twi_mngr_transaction_t *p_dst = dk_mpsc_queue_pending_get(p_queue, i);
+
+        *p_dst = *(dk_twi_mngr_transaction_t *)dk_mpsc_queue_pending_get(p_queue, i - 1);
+    }
+
+    *(dk_twi_mngr_transaction_t *)dk_mpsc_queue_pending_get(p_queue, 0) = moved;
+}
+
+/**
+ * @brief       Move a queued transaction on the active mux channels to the front of the queue.
+ *
+ * @details     If the transaction at the front of the queue needs a channel switch, the next
+ *              @ref DK_TWI_MNGR_MUX_BATCH_WINDOW transactions are searched for one that does not. The search stops at
+ *              a transaction of a slave that is not behind the mux, so writes to the mux itself are never passed.
+ *              The passed transactions keep their order. Must only be called by the context that owns the manager.
+ *
+ * @param[in]   p_dk_twi_mngr   Pointer to TWI manager instance.
+ * @param[in]   p_queue         Queue the next transaction is taken from.
+ */
+static void mux_batch_reorder(dk_twi_mngr_t const *p_dk_twi_mngr, dk_mpsc_queue_t const *p_queue)
+{
+    // Pointer for cleaner code.
+    dk_twi_mngr_cb_t *p_cb = p_dk_twi_mngr->p_dk_twi_mngr_cb;
+
+    bool reordered = false;
+
+    if (p_cb->mux_address == 0)
+    {
+        return;
+    }
+
+    CRITICAL_REGION_ENTER();
+    dk_twi_mngr_transaction_t *p_front = dk_mpsc_queue_pending_get(p_queue, 0);
+
+    if ((p_front != NULL) && mux_switch_required(p_cb, p_front) &&
+        (p_cb->mux_batch_count < DK_TWI_MNGR_MUX_BATCH_WINDOW))
+    {
+        for (uint32_t offset = 1; offset <= DK_TWI_MNGR_MUX_BATCH_WINDOW; offset++)
+        {
+            dk_twi_mngr_transaction_t *p_pending = dk_mpsc_queue_pending_get(p_queue, offset);
+
+            if ((p_pending == NULL) || (p_pending->mux_channels == 0))
+            {
+                // End of the queue, an element that is still being written or a slave that is not behind the mux.
+                break;
+            }
+
+            if (!mux_switch_required(p_cb, p_pending))
+            {
+                pending_to_front(p_queue, offset);
+                reordered = true;
+                break;
+            }
+        }
+    }
+
+    // Bound the amount of times the same transaction is passed over.
+    p_cb->mux_batch_count = reordered ? (p_cb->mux_batch_count + 1) : 0;
+    CRITICAL_REGION_EXIT();
+}
+
+#if DK_TWI_MNGR_EDF_ENABLED
+static dk_twi_mngr_transfer_t const *transfer_get(dk_twi_mngr_transaction_t const *p_transaction, uint8_t idx);
+
+/**
+ * @brief       Get the time left until the deadline of a transaction.
+ *
+ * @param[in]   p_transaction   Pointer to transaction with @ref DK_TWI_MNGR_FLAG_DEADLINE.
+ * @param[in]   now             Current app_timer tick.
+ *
+ * @return      Ticks left, negative if the deadline has passed.
+ */
+static int32_t deadline_slack_get(dk_twi_mngr_transaction_t const *p_transaction, uint32_t now)
+{
+    uint32_t ticks = app_timer_cnt_diff_compute(p_transaction->deadline, now);
+
+    // Deadlines are less than half of the counter period ahead, a larger distance means the deadline is behind.
+    return (ticks > (APP_TIMER_MAX_CNT_VAL / 2)) ? ((int32_t)ticks - (int32_t)APP_TIMER_MAX_CNT_VAL - 1)
+                                                 : (int32_t)ticks;
+}
+
+static bool has_deadline(dk_twi_mngr_transaction_t const *p_transaction)
+{
+    return (p_transaction->flags & DK_TWI_MNGR_FLAG_DEADLINE) &&
+           !(p_transaction->flags & (DK_TWI_MNGR_FLAG_COMPLETED | DK_TWI_MNGR_FLAG_CANCELLED));
+}
+
+/**
+ * @brief       Move the queued transaction with the earliest deadline to the front of its queue.
+ *
+ * @details     A transaction that has an older transaction to the same slave queued before it is not a candidate.
+ *              The search of a queue stops at an element that is still being written and after
+ *              @ref DK_TWI_MNGR_EDF_WINDOW elements, so the critical region is bounded. Ties go to the higher priority
+ *              class and the older transaction. Must only be called by the context that owns the manager.
+ *
+ * @param[in]   p_dk_twi_mngr   Pointer to TWI manager instance.
+ * @param[in]   p_starving      Queue that has to be served next, NULL to search all queues.
+ *
+ * @return      Queue of the transaction or NULL if no queued transaction has a deadline.
+ */
+static dk_mpsc_queue_t const *edf_reorder(dk_twi_mngr_t const *p_dk_twi_mngr, dk_mpsc_queue_t const *p_starving)
+{
+    dk_mpsc_queue_t const *p_earliest      = NULL;
+    uint32_t               earliest_offset = 0;
+    int32_t                earliest_slack  = INT32_MAX;
+    uint32_t               now             = app_timer_cnt_get();
+
+    CRITICAL_REGION_ENTER();
+    for (uint8_t i = 0; i < DK_TWI_MNGR_PRIORITY_COUNT; i++)
+    {
+        dk_mpsc_queue_t const *p_queue = p_dk_twi_mngr->p_queues[m_priority_order[i]];
+
+        if ((p_starving != NULL) && (p_queue != p_starving))
+        {
+            continue;
+        }
+
+        // Slave addresses of the transactions passed so far, one bit per 7-bit address.
+        uint32_t seen[128 / 32] = {0};
+
+        for (uint32_t offset = 0; offset < DK_TWI_MNGR_EDF_WINDOW; offset++)
+        {
+            dk_twi_mngr_transaction_t const *p_pending = dk_mpsc_queue_pending_get(p_queue, offset);
+
+            if (p_pending == NULL)
+            {
+                // End of the queue or an element that is still being written.
+                break;
+            }
+
+            if (p_pending->flags & DK_TWI_MNGR_FLAG_COMPLETED)
+            {
+                continue;
+            }
+
+            uint8_t  address = transfer_get(p_pending, 0)->transfer_description.address & 0x7F;
+            uint32_t bit     = 1UL << (address % 32);
+            bool     behind  = (seen[address / 32] & bit) != 0;
+
+            seen[address / 32] |= bit;
+
+            if (!has_deadline(p_pending) || behind)
+            {
+                continue;
+            }
+
+            int32_t slack = deadline_slack_get(p_pending, now);
+
+            if (slack < earliest_slack)
+            {
+                p_earliest      = p_queue;
+                earliest_offset = offset;
+                earliest_slack  = slack;
+            }
+        }
+    }
+
+    if ((p_earliest != NULL) && (earliest_offset != 0))
+    {
+        pending_to_front(p_earliest, earliest_offset);
+    }
+    CRITICAL_REGION_EXIT();
+
+    return p_earliest;
+}
+
+static bool deadline_missed(dk_twi_mngr_t const *p_dk_twi_mngr)
+{
+    // [use a local variable to avoid using two volatile variables in one
+    //  expression]
+    dk_twi_mngr_transaction_t transaction = p_dk_twi_mngr->p_dk_twi_mngr_cb->current_transaction;
+
+    return has_deadline(&transaction) && (deadline_slack_get(&transaction, app_timer_cnt_get()) < 0);
+}
+#else
+#define edf_reorder(p_dk_twi_mngr, p_starving) NULL
+#define deadline_missed(p_dk_twi_mngr)         false
+#endif // DK_TWI_MNGR_EDF_ENABLED
+
+/**
+ * @brief       Pop the next transaction into the control block.
+ *
+ * @details     Queues are drained in priority order. A queue that was passed over @ref DK_TWI_MNGR_STARVATION_LIMIT
+ *              times while having pending transactions is served first. Otherwise a transaction with a deadline (see
+ *              @ref DK_TWI_MNGR_FLAG_DEADLINE) selects the queue. Within the selected queue a transaction on the
+ *              active mux channels may be taken ahead of the front one, unless it was selected by its deadline. Must
+ *              only be called by the context that owns the manager (set transaction_in_progress).
+ *
+ * @param[in]   p_dk_twi_mngr       Pointer to TWI manager instance.
+ *
+ * @retval      NRF_SUCCESS         If a transaction was popped.
+ * @retval      NRF_ERROR_NOT_FOUND If all queues are empty.
+ */
+static ret_code_t transaction_pop(dk_twi_mngr_t const *p_dk_twi_mngr)
+{
+    // Pointer for cleaner code.
+    dk_twi_mngr_cb_t *p_cb = p_dk_twi_mngr->p_dk_twi_mngr_cb;
+
+    dk_mpsc_queue_t const *p_selected = NULL;
+
+    for (uint8_t i = 0; i < DK_TWI_MNGR_PRIORITY_COUNT; i++)
+    {
+        dk_twi_mngr_priority_t priority = m_priority_order[i];
+
+        if ((p_cb->skip_count[priority] >= DK_TWI_MNGR_STARVATION_LIMIT) &&
+            !dk_mpsc_queue_is_empty(p_dk_twi_mngr->p_queues[priority]))
+        {
+            p_selected = p_dk_twi_mngr->p_queues[priority];
+            break;
+        }
+    }
+
+    dk_mpsc_queue_t const *p_edf = edf_reorder(p_dk_twi_mngr, p_selected);
+
+    if (p_edf != NULL)
+    {
+        p_selected = p_edf;
+    }
+
+    for (uint8_t i = 0; i < DK_TWI_MNGR_PRIORITY_COUNT; i++)
+    {
+        dk_twi_mngr_priority_t priority = m_priority_order[i];
+        dk_mpsc_queue_t const *p_queue  = p_dk_twi_mngr->p_queues[priority];
+
+        if (dk_mpsc_queue_is_empty(p_queue))
+        {
+            p_cb->skip_count[priority] = 0;
+            continue;
+        }
+
+        if (p_selected == NULL)
+        {
+            p_selected = p_queue;
+        }
+
+        if (p_queue == p_selected)
+        {
+            p_cb->skip_count[priority] = 0;
+        } else
+        {
+            p_cb->skip_count[priority]++;
+        }
+    }
+
+    if (p_selected == NULL)
+    {
+        return NRF_ERROR_NOT_FOUND;
+    }
+
+    if (p_edf == NULL)
+    {
+        mux_batch_reorder(p_dk_twi_mngr, p_selected);
+    }
+
+    return dk_mpsc_queue_pop(p_selected, (void *)(&p_cb->current_transaction));
+}
+
+static bool is_supersedable(dk_twi_mngr_transaction_t const *p_transaction)
+{
+    dk_twi_mngr_xfer_desc_t const *p_xfer = &p_transaction->transfer.transfer_description;
+
+    return ((p_transaction->flags & (DK_TWI_MNGR_FLAG_SUPERSEDE | DK_TWI_MNGR_FLAG_CANCELLED)) ==
+            DK_TWI_MNGR_FLAG_SUPERSEDE) &&
+           (p_transaction->buff_ownership == DK_TWI_MNGR_BUFF_POOL) && (p_transaction->p_transfers == NULL) &&
+           (p_transaction->p_group == NULL) &&
+           (p_xfer->type == DRV_XFER_TX) && (p_xfer->primary_length > 0);
+}
+
+/**
+ * @brief       Check if two register writes (register byte followed by data) touch a common register.
+ */
+static bool register_ranges_overlap(dk_twi_mngr_xfer_desc_t const *p_xfer_a, dk_twi_mngr_xfer_desc_t const *p_xfer_b)
+{
+    uint32_t first_a = p_xfer_a->p_primary_buf[0];
+    uint32_t first_b = p_xfer_b->p_primary_buf[0];
+
+    // A write without data only sets the register pointer, it is treated as touching that register.
+    uint32_t last_a = first_a + MAX(p_xfer_a->primary_length, 2) - 2;
+    uint32_t last_b = first_b + MAX(p_xfer_b->primary_length, 2) - 2;
+
+    return (first_a <= last_b) && (first_b <= last_a);
+}
+
+/**
+ * @brief       Replace a pending supersedable write to the same slave, register and length.
+ *
+ * @details     Only the newest matching write is replaced, and only if no other transaction to the same slave is
+ *              queued after it that is not supersedable or writes registers overlapping the new write (ie a block write
+ *              covering the register), so the order of writes as seen by the slave is preserved.
+ *
+ * @note        Must be called from a critical region.
+ *
+ * @param[in]   p_queue         Queue to search.
+ * @param[in]   p_transaction   New supersedable transaction.
+ *
+ * @return      Primary buffer of the replaced transaction or NULL if no pending transaction was replaced.
+ */
+static uint8_t *pending_write_supersede(dk_mpsc_queue_t const           *p_queue,
+                                        dk_twi_mngr_transaction_t const *p_transaction)
+{
+    dk_twi_mngr_transaction_t     *p_match = NULL;
+    dk_twi_mngr_xfer_desc_t const *p_xfer  = &p_transaction->transfer.transfer_description;
+    uint32_t                       count   = dk_mpsc_queue_pending_count(p_queue);
+
+    for (uint32_t offset = 0; offset < count; offset++)
+    {
+        dk_twi_mngr_transaction_t *p_pending = dk_mpsc_queue_pending_get(p_queue, offset);
+
+        if (p_pending == NULL)
+        {
+            // Element is still being written by a preempted producer, its content is unknown.
+            p_match = NULL;
+            continue;
+        }
+
+        dk_twi_mngr_xfer_desc_t const *p_pending_xfer = &p_pending->transfer.transfer_description;
+
+        if (is_supersedable(p_pending) && (p_pending_xfer->address == p_xfer->address) &&
+            (p_pending->mux_channels == p_transaction->mux_channels) &&
+            (p_pending_xfer->primary_length == p_xfer->primary_length) &&
+            (p_pending_xfer->p_primary_buf[0] == p_xfer->p_primary_buf[0]))
+        {
+            p_match = p_pending;
+        } else if ((p_pending->p_transfers != NULL) ||
+                   ((p_pending_xfer->address == p_xfer->address) &&
+                    (!is_supersedable(p_pending) || register_ranges_overlap(p_pending_xfer, p_xfer))))
+        {
+            // Any other traffic to the slave (sequences may address it too) acts as a barrier, so does a supersedable
+            // write of other registers that includes the register, replacing the earlier write would reorder them.
+            p_match = NULL;
+        }
+    }
+
+    if (p_match == NULL)
+    {
+        return NULL;
+    }
+
+    uint8_t *p_superseded_buf = p_match->transfer.transfer_description.p_primary_buf;
+
+    *p_match = *p_transaction;
+
+    return p_superseded_buf;
+}
+
+/**
+ * @brief       Take a buffer from the smallest size class that fits and has a free buffer.
+ *
+ * @details     The free blocks of a pool form a lock-free stack, so buffers can be taken and freed from any interrupt
+ *              priority without disabling interrupts.
+ *
+ * @param[in]   p_dk_twi_mngr   Pointer to TWI manager instance.
+ * @param[in]   size            Buffer size.
+ *
+ * @return      Pointer to the buffer or NULL if none is available.
+ */
+static void *buffer_alloc(dk_twi_mngr_t const *p_dk_twi_mngr, uint32_t size)
+{
+    for (uint8_t i = 0; i < DK_TWI_MNGR_BUFF_CLASS_COUNT; i++)
+    {
+        dk_twi_mngr_buff_pool_t const       *p_pool    = &p_dk_twi_mngr->buff_pool[i];
+        volatile dk_twi_mngr_buff_pool_cb_t *p_pool_cb = &p_dk_twi_mngr->p_dk_twi_mngr_cb->buff_pool_cb[i];
+
+        if (size > p_pool->block_size)
+        {
+            // Buffer does not fit, try the next size class.
+            continue;
+        }
+
+        // Pop the first free block. The next index of a block that another context pops meanwhile may be stale,
+        // but then the head (and its tag) has changed as well and the exchange is retried.
+        uint32_t head = __atomic_load_n(&p_pool_cb->free_head, __ATOMIC_ACQUIRE);
+        uint16_t block;
+
+        do
+        {
+            block = (uint16_t)(head & UINT16_MAX);
+            if (block == BUFF_POOL_NIL)
+            {
+                break;
+            }
+        } while (!__atomic_compare_exchange_n(&p_pool_cb->free_head,
+                                              &head,
+                                              BUFF_POOL_HEAD(head, p_pool->p_next_free[block]),
+                                              true,
+                                              __ATOMIC_ACQUIRE,
+                                              __ATOMIC_ACQUIRE));
+
+        if (block == BUFF_POOL_NIL)
+        {
+            // The pool is exhausted, try the next size class.
+            continue;
+        }
+
+        uint16_t utilization =
+          p_pool->block_count - __atomic_sub_fetch(&p_pool_cb->free_count, 1, __ATOMIC_RELAXED);
+        uint16_t max_utilization = __atomic_load_n(&p_pool_cb->max_utilization, __ATOMIC_RELAXED);
+
+        while ((utilization > max_utilization) &&
+               !__atomic_compare_exchange_n(
+                 &p_pool_cb->max_utilization, &max_utilization, utilization, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+        {
+        }
+
+        return &p_pool->p_mem[block * p_pool->block_size];
+    }
+
+    return NULL;
+}
+
+static bool is_coalescable(dk_twi_mngr_transaction_t const *p_transaction)
+{
+    dk_twi_mngr_xfer_desc_t const *p_xfer = &p_transaction->transfer.transfer_description;
+
+    return ((p_transaction->flags & (DK_TWI_MNGR_FLAG_COALESCE | DK_TWI_MNGR_FLAG_CANCELLED)) ==
+            DK_TWI_MNGR_FLAG_COALESCE) &&
+           (p_transaction->buff_ownership == DK_TWI_MNGR_BUFF_POOL) && (p_transaction->p_transfers == NULL) &&
+           (p_transaction->p_group == NULL) &&
+           (p_xfer->type == DRV_XFER_TX) && (p_xfer->primary_length > 0);
+}
+
+/**
+ * @brief       Merge a write to the next register into the last queued write to the same slave.
+ *
+ * @note        Must be called from a critical region.
+ *
+ * @param[in]   p_dk_twi_mngr   Pointer to TWI manager instance.
+ * @param[in]   p_queue         Queue the transaction is scheduled to.
+ * @param[in]   p_transaction   New coalescable transaction.
+ * @param[out]  pp_released_buf Primary buffer of the queued transaction that was replaced by the merged buffer.
+ *
+ * @retval      true            If the transaction was merged into the queued one.
+ * @retval      false           If the transaction has to be queued on its own.
+ */
+static bool pending_write_coalesce(dk_twi_mngr_t const             *p_dk_twi_mngr,
+                                   dk_mpsc_queue_t const           *p_queue,
+                                   dk_twi_mngr_transaction_t const *p_transaction,
+                                   uint8_t                        **pp_released_buf)
+{
+    uint32_t count = dk_mpsc_queue_pending_count(p_queue);
+
+    if (count == 0)
+    {
+        return false;
+    }
+
+    dk_twi_mngr_transaction_t *p_tail = dk_mpsc_queue_pending_get(p_queue, count - 1);
+
+    if (p_tail == NULL)
+    {
+        // Last element is still being written by a preempted producer.
+        return false;
+    }
+
+    dk_twi_mngr_xfer_desc_t       *p_tail_xfer = &p_tail->transfer.transfer_description;
+    dk_twi_mngr_xfer_desc_t const *p_xfer      = &p_transaction->transfer.transfer_description;
+
+    if (!is_coalescable(p_tail) || (p_tail->callback != p_transaction->callback) ||
+        (p_tail->p_user_data != p_transaction->p_user_data) || (p_tail->event_type != p_transaction->event_type) ||
+        (p_tail_xfer->address != p_xfer->address) || (p_tail->mux_channels != p_transaction->mux_channels) ||
+        ((p_tail_xfer->p_primary_buf[0] + p_tail_xfer->primary_length - 1) != p_xfer->p_primary_buf[0]))
+    {
+        return false;
+    }
+
+    size_t merged_length = p_tail_xfer->primary_length + p_xfer->primary_length - 1;
+
+    // A burst that does not fit the largest size class is queued as separate writes, that is not an error.
+    if (merged_length > p_dk_twi_mngr->buff_pool[DK_TWI_MNGR_BUFF_CLASS_COUNT - 1].block_size)
+    {
+        return false;
+    }
+
+    // Allocate without the failure warning, an exhausted pool only means the writes are not merged.
+    uint8_t *p_merged_buf = buffer_alloc(p_dk_twi_mngr, merged_length);
+
+    if (p_merged_buf == NULL)
+    {
+        return false;
+    }
+
+    memcpy(p_merged_buf, p_tail_xfer->p_primary_buf, p_tail_xfer->primary_length);
+    memcpy(&p_merged_buf[p_tail_xfer->primary_length], &p_xfer->p_primary_buf[1], p_xfer->primary_length - 1);
+
+    *pp_released_buf             = p_tail_xfer->p_primary_buf;
+    p_tail_xfer->p_primary_buf   = p_merged_buf;
+    p_tail_xfer->primary_length  = merged_length;
+    p_tail->flags               &= p_transaction->flags;
+
+    return true;
+}
+
+static uint8_t transfer_count_get(dk_twi_mngr_transaction_t const *p_transaction)
+{
+    return (p_transaction->p_transfers != NULL) ? p_transaction->number_of_transfers : 1;
+}
+
+static dk_twi_mngr_transfer_t const *transfer_get(dk_twi_mngr_transaction_t const *p_transaction, uint8_t idx)
+{
+    return (p_transaction->p_transfers != NULL) ? &p_transaction->p_transfers[idx] : &p_transaction->transfer;
+}
+
+#if DK_TWI_MNGR_STATS_ENABLED
+/**
+ * @brief       Get the log2 histogram bin of a time.
+ *
+ * @param[in]   ticks   Time in app_timer ticks.
+ *
+ * @return      Bin index.
+ */
+static uint8_t stats_hist_bin(uint32_t ticks)
+{
+    // CLZ of 0 is 32, so 0 ticks end up in bin 0.
+    uint8_t bin = 32 - __CLZ(ticks);
+
+    return MIN(bin, DK_TWI_MNGR_STATS_HIST_BINS - 1);
+}
+
+/**
+ * @brief       Get the counters of a slave address, claiming a free entry for a new address.
+ *
+ * @param[in]   p_stats Pointer to statistics.
+ * @param[in]   address Slave address.
+ *
+ * @return      Pointer to slave counters or NULL if all entries are used by other addresses.
+ */
+static dk_twi_mngr_slave_stats_t *stats_slave_get(dk_twi_mngr_stats_t *p_stats, uint8_t address)
+{
+    for (uint8_t i = 0; i < p_stats->slave_count; i++)
+    {
+        if (p_stats->slaves[i].address == address)
+        {
+            return &p_stats->slaves[i];
+        }
+    }
+
+    if (p_stats->slave_count >= DK_TWI_MNGR_STATS_SLAVE_COUNT)
+    {
+        return NULL;
+    }
+
+    dk_twi_mngr_slave_stats_t *p_slave = &p_stats->slaves[p_stats->slave_count++];
+
+    memset(p_slave, 0, sizeof(*p_slave));
+    p_slave->address = address;
+
+    return p_slave;
+}
+
+static void stats_scheduled(dk_twi_mngr_t const *p_dk_twi_mngr, dk_twi_mngr_transaction_t const *p_transaction)
+{
+    dk_twi_mngr_stats_t   *p_stats = &p_dk_twi_mngr->p_dk_twi_mngr_cb->stats;
+    dk_mpsc_queue_t const *p_queue = p_dk_twi_mngr->p_queues[p_transaction->priority];
+
+    CRITICAL_REGION_ENTER();
+    dk_twi_mngr_slave_stats_t *p_slave =
+      stats_slave_get(p_stats, transfer_get(p_transaction, 0)->transfer_description.address);
+
+    p_stats->scheduled++;
+    if (p_slave != NULL)
+    {
+        p_slave->scheduled++;
+    }
+
+    p_stats->queue_max_depth[p_transaction->priority] =
+      MAX(p_stats->queue_max_depth[p_transaction->priority], dk_mpsc_queue_pending_count(p_queue));
+    CRITICAL_REGION_EXIT();
+}
+
+static void stats_merged(dk_twi_mngr_t const *p_dk_twi_mngr)
+{
+    CRITICAL_REGION_ENTER();
+    p_dk_twi_mngr->p_dk_twi_mngr_cb->stats.merged++;
+    CRITICAL_REGION_EXIT();
+}
+
+static void stats_deadline_missed(dk_twi_mngr_t const *p_dk_twi_mngr)
+{
+    CRITICAL_REGION_ENTER();
+    p_dk_twi_mngr->p_dk_twi_mngr_cb->stats.deadline_missed++;
+    CRITICAL_REGION_EXIT();
+}
+
+static void stats_transaction_start(dk_twi_mngr_t const *p_dk_twi_mngr)
+{
+    // Pointer for cleaner code.
+    dk_twi_mngr_cb_t *p_cb = p_dk_twi_mngr->p_dk_twi_mngr_cb;
+
+    uint32_t now  = app_timer_cnt_get();
+    uint32_t wait = app_timer_cnt_diff_compute(now, p_cb->current_transaction.schedule_tick);
+
+    CRITICAL_REGION_ENTER();
+    p_cb->stats.queue_wait_hist[stats_hist_bin(wait)]++;
+    CRITICAL_REGION_EXIT();
+
+    p_cb->stats_wire_start = now;
+    p_cb->stats_on_wire    = true;
+}
+
+static void stats_transfer_done(dk_twi_mngr_t const *p_dk_twi_mngr, dk_twi_mngr_transfer_t const *p_transfer)
+{
+    dk_twi_mngr_xfer_desc_t const *p_xfer = &p_transfer->transfer_description;
+
+    CRITICAL_REGION_ENTER();
+    p_dk_twi_mngr->p_dk_twi_mngr_cb->stats.bytes += p_xfer->primary_length + p_xfer->secondary_length;
+    CRITICAL_REGION_EXIT();
+}
+
+static void stats_transaction_end(dk_twi_mngr_t const             *p_dk_twi_mngr,
+                                  dk_twi_mngr_transaction_t const *p_transaction,
+                                  ret_code_t                       result)
+{
+    // Pointer for cleaner code.
+    dk_twi_mngr_cb_t *p_cb = p_dk_twi_mngr->p_dk_twi_mngr_cb;
+
+    uint32_t on_wire = app_timer_cnt_diff_compute(app_timer_cnt_get(), p_cb->stats_wire_start);
+
+    CRITICAL_REGION_ENTER();
+    dk_twi_mngr_slave_stats_t *p_slave =
+      stats_slave_get(&p_cb->stats, transfer_get(p_transaction, 0)->transfer_description.address);
+
+    if (result == NRF_SUCCESS)
+    {
+        p_cb->stats.completed++;
+        if (p_slave != NULL)
+        {
+            p_slave->completed++;
+        }
+    } else
+    {
+        p_cb->stats.failed++;
+        if (p_slave != NULL)
+        {
+            p_slave->failed++;
+        }
+    }
+
+    if (p_cb->stats_on_wire)
+    {
+        p_cb->stats.on_wire_hist[stats_hist_bin(on_wire)]++;
+    }
+
+#if DK_TWI_MNGR_EDF_ENABLED
+    if (p_cb->stats_on_wire && has_deadline(p_transaction) &&
+        (deadline_slack_get(p_transaction, app_timer_cnt_get()) < 0))
+    {
+        // Started in time, but the result is late.
+        p_cb->stats.deadline_late++;
+    }
+#endif
+    CRITICAL_REGION_EXIT();
+
+    p_cb->stats_on_wire = false;
+}
+
+static void stats_start_failed(dk_twi_mngr_t const *p_dk_twi_mngr)
+{
+    // Nothing was put on the bus, keep the transaction out of the on-wire histogram.
+    p_dk_twi_mngr->p_dk_twi_mngr_cb->stats_on_wire = false;
+}
+#else
+#define stats_scheduled(p_dk_twi_mngr, p_transaction)
+#define stats_merged(p_dk_twi_mngr)
+#define stats_deadline_missed(p_dk_twi_mngr)
+#define stats_transaction_start(p_dk_twi_mngr)
+#define stats_start_failed(p_dk_twi_mngr)
+#define stats_transfer_done(p_dk_twi_mngr, p_transfer)
+#define stats_transaction_end(p_dk_twi_mngr, p_transaction, result)
+#endif // DK_TWI_MNGR_STATS_ENABLED
+
+static ret_code_t start_transfer(dk_twi_mngr_t const *p_dk_twi_mngr)
+{
+    ASSERT(p_dk_twi_mngr != NULL);
+
+    // Pointer for cleaner code.
+    dk_twi_mngr_cb_t *p_cb = p_dk_twi_mngr->p_dk_twi_mngr_cb;
+
+    // [use a local variable to avoid using two volatile variables in one
+    //  expression]
+    dk_twi_mngr_transaction_t     transaction = p_cb->current_transaction;
+    dk_twi_mngr_transfer_t const *p_transfer  = transfer_get(&transaction, p_cb->current_transfer_idx);
+
+    return DRV_XFER(&p_dk_twi_mngr->twi, &p_transfer->transfer_description, p_transfer->flags);
+}
+
+#if DK_TWI_MNGR_IDLE_TIMEOUT_MS
+static void twi_event_handler(dk_twi_mngr_drv_evt_t const *p_event, void *p_context);
+
+/**
+ * @brief       Add the time since the last update to the powered time. Must be called from a critical region.
+ *
+ * @param[in]   p_cb    Pointer to TWI manager control block.
+ */
+static void powered_time_update(dk_twi_mngr_cb_t *p_cb)
+{
+    if (p_cb->powered)
+    {
+        uint32_t now = app_timer_cnt_get();
+
+        p_cb->powered_ticks += app_timer_cnt_diff_compute(now, p_cb->powered_start);
+        p_cb->powered_start = now;
+    }
+}
+
+static void idle_timer_start(dk_twi_mngr_t const *p_dk_twi_mngr, uint32_t ticks)
+{
+    ticks = MAX(ticks, APP_TIMER_MIN_TIMEOUT_TICKS);
+
+    if (app_timer_start(*p_dk_twi_mngr->p_idle_timer_id, ticks, (void *)p_dk_twi_mngr) != NRF_SUCCESS)
+    {
+        NRF_LOG_ERROR("Failed to start idle timer");
+    }
+}
+
+/**
+ * @brief       Power the peripheral up again if it was powered down on an idle bus.
+ *
+ * @details     Must be called by the context that owns the bus. The idle timer runs for as long as the peripheral is
+ *              powered, so the powered time is accumulated before the app_timer counter wraps around.
+ *
+ * @param[in]   p_dk_twi_mngr   Pointer to TWI manager instance.
+ *
+ * @retval      NRF_SUCCESS     If the peripheral is powered.
+ * @retval      Other           Error codes returned by the driver.
+ */
+static ret_code_t bus_power_up(dk_twi_mngr_t const *p_dk_twi_mngr)
+{
+    // Pointer for cleaner code.
+    dk_twi_mngr_cb_t *p_cb = p_dk_twi_mngr->p_dk_twi_mngr_cb;
+
+    if (p_cb->powered)
+    {
+        return NRF_SUCCESS;
+    }
+
+    ret_code_t err_code = DRV_INIT(&p_dk_twi_mngr->twi, &p_cb->twi_config, twi_event_handler, (void *)p_dk_twi_mngr);
+    VERIFY_SUCCESS(err_code);
+
+    DRV_ENABLE(&p_dk_twi_mngr->twi);
+
+    CRITICAL_REGION_ENTER();
+    p_cb->powered       = true;
+    p_cb->powered_start = app_timer_cnt_get();
+    CRITICAL_REGION_EXIT();
+
+    idle_timer_start(p_dk_twi_mngr, APP_TIMER_TICKS(DK_TWI_MNGR_IDLE_TIMEOUT_MS));
+
+    return NRF_SUCCESS;
+}
+
+static void bus_idle_mark(dk_twi_mngr_t const *p_dk_twi_mngr)
+{
+    p_dk_twi_mngr->p_dk_twi_mngr_cb->idle_start = app_timer_cnt_get();
+}
+#else
+#define bus_power_up(p_dk_twi_mngr) NRF_SUCCESS
+#define bus_idle_mark(p_dk_twi_mngr)
+#endif // DK_TWI_MNGR_IDLE_TIMEOUT_MS
+
+/**
+ * @brief       Put the current transaction on the bus, preceded by a mux channel select if needed.
+ *
+ * @details     A peripheral that was powered down on an idle bus is powered up first.
+ *
+ * @param[in]   p_dk_twi_mngr   Pointer to TWI manager instance.
+ *
+ * @return      Error code returned by the driver.
+ */
+static ret_code_t transaction_start(dk_twi_mngr_t const *p_dk_twi_mngr)
+{
+    // Pointer for cleaner code.
+    dk_twi_mngr_cb_t *p_cb = p_dk_twi_mngr->p_dk_twi_mngr_cb;
+
+    // [use a local variable to avoid using two volatile variables in one
+    //  expression]
+    dk_twi_mngr_transaction_t transaction = p_cb->current_transaction;
+
+    DK_TRACE(DK_TRACE_EVT_TWI_MNGR_XFER_BEGIN,
+             DK_TRACE_INSTANCE_ARG(p_dk_twi_mngr->twi.drv_inst_idx,
+                                   transfer_get(&transaction, 0)->transfer_description.address),
+             transaction.priority);
+
+    ret_code_t err_code = bus_power_up(p_dk_twi_mngr);
+    VERIFY_SUCCESS(err_code);
+
+    if (mux_switch_required(p_cb, &transaction))
+    {
+        // The transaction is started from the TWI event of the channel select.
+        dk_twi_mngr_xfer_desc_t xfer = DK_TWI_MNGR_XFER_DESC_TX(p_cb->mux_address, &p_cb->mux_channels, 1);
+        ret_code_t              result;
+
+        p_cb->mux_channels  = transaction.mux_channels;
+        p_cb->mux_valid     = false;
+        p_cb->mux_switching = true;
+
+        result = DRV_XFER(&p_dk_twi_mngr->twi, &xfer, 0);
+        if (result != NRF_SUCCESS)
+        {
+            p_cb->mux_switching = false;
+        }
+
+        return result;
+    }
+
+    for (uint8_t i = 0; (i < transfer_count_get(&transaction)) && (p_cb->mux_address != 0); i++)
+    {
+        if (transfer_get(&transaction, i)->transfer_description.address == p_cb->mux_address)
+        {
+            // The mux is written directly, the active channels are unknown from now on.
+            p_cb->mux_valid = false;
+        }
+    }
+
+    return start_transfer(p_dk_twi_mngr);
+}
+
+/**
+ * @brief       Release the buffer of a finished transaction according to its ownership.
+ *
+ * @param[in]   p_dk_twi_mngr   Pointer to TWI manager instance.
+ * @param[in]   p_buffer        Transaction buffer.
+ * @param[in]   buff_ownership  Ownership of the buffer.
+ * @param[in]   release         Function releasing an owned buffer.
+ * @param[in]   p_user_data     User data of the transaction.
+ */
+static void buffer_release(dk_twi_mngr_t const         *p_dk_twi_mngr,
+                           void                        *p_buffer,
+                           dk_twi_mngr_buff_ownership_t buff_ownership,
+                           dk_twi_mngr_release_t        release,
+                           void                        *p_user_data)
+{
+    switch (buff_ownership)
+    {
+        case DK_TWI_MNGR_BUFF_POOL:
+            dk_twi_mngr_data_buffer_free(p_dk_twi_mngr, p_buffer);
+            break;
+
+        case DK_TWI_MNGR_BUFF_OWNED:
+            if (release)
+            {
+                release(p_buffer, p_user_data);
+            }
+            break;
+
+        default:
+            // Borrowed buffers stay with the caller.
+            break;
+    }
+}
+
+/**
+ * @brief       Count a finished transaction of a group and call the group callback after the last one.
+ *
+ * @param[in]   p_group Pointer to group, NULL if the transaction is not in a group.
+ * @param[in]   result  Transaction result.
+ */
+static void group_member_done(dk_twi_mngr_group_t *p_group, ret_code_t result)
+{
+    if (p_group == NULL)
+    {
+        return;
+    }
+
+    ret_code_t no_error = NRF_SUCCESS;
+
+    if (result != NRF_SUCCESS)
+    {
+        // Only the first failure is reported.
+        (void)__atomic_compare_exchange_n(
+          &p_group->result, &no_error, result, false, __ATOMIC_RELAXED, __ATOMIC_RELAXED);
+    }
+
+    if ((__atomic_sub_fetch(&p_group->pending, 1, __ATOMIC_ACQ_REL) == 0) && (p_group->callback != NULL))
+    {
+        p_group->callback(p_group->result, p_group->p_user_data);
+    }
+}
+
+#if DK_TWI_MNGR_DEFERRED_CB_ENABLED
+static void deferred_callback_handler(void *p_event_data, uint16_t event_size)
+{
+    dk_twi_mngr_deferred_cb_t *p_deferred_cb = (dk_twi_mngr_deferred_cb_t *)p_event_data;
+
+    ASSERT(event_size == sizeof(dk_twi_mngr_deferred_cb_t));
+    UNUSED_PARAMETER(event_size);
+
+    p_deferred_cb->callback(
+      p_deferred_cb->result, p_deferred_cb->event_type, &p_deferred_cb->transfer, p_deferred_cb->p_user_data);
+
+    buffer_release(p_deferred_cb->p_dk_twi_mngr,
+                   p_deferred_cb->p_buffer,
+                   p_deferred_cb->buff_ownership,
+                   p_deferred_cb->release,
+                   p_deferred_cb->p_user_data);
+
+    group_member_done(p_deferred_cb->p_group, p_deferred_cb->result);
+}
+
+/**
+ * @brief       Post the callback of a finished transaction to app_scheduler.
+ *
+ * @param[in]   p_dk_twi_mngr   Pointer to TWI manager instance.
+ * @param[in]   p_transaction   Finished transaction.
+ * @param[in]   p_transfer      Last performed transfer.
+ * @param[in]   result          Transaction result.
+ *
+ * @retval      true            If the callback was posted, it also releases the transaction buffer.
+ * @retval      false           If the callback has to be called right away.
+ */
+static bool deferred_callback_post(dk_twi_mngr_t const             *p_dk_twi_mngr,
+                                   dk_twi_mngr_transaction_t const *p_transaction,
+                                   dk_twi_mngr_transfer_t const    *p_transfer,
+                                   ret_code_t                       result)
+{
+    dk_twi_mngr_deferred_cb_t deferred_cb = {
+      .p_dk_twi_mngr  = p_dk_twi_mngr,
+      .callback       = p_transaction->callback,
+      .p_user_data    = p_transaction->p_user_data,
+      .transfer       = *p_transfer,
+      .p_buffer       = transfer_get(p_transaction, 0)->transfer_description.p_primary_buf,
+      .buff_ownership = p_transaction->buff_ownership,
+      .release        = p_transaction->release,
+      .p_group        = p_transaction->p_group,
+      .result         = result,
+      .event_type     = p_transaction->event_type};
+
+    ret_code_t err_code = app_sched_event_put(&deferred_cb, sizeof(deferred_cb), deferred_callback_handler);
+    if (err_code != NRF_SUCCESS)
+    {
+        NRF_LOG_WARNING("Failed to defer callback 0x%x", err_code);
+        return false;
+    }
+
+    return true;
+}
+#endif // DK_TWI_MNGR_DEFERRED_CB_ENABLED
+
+/**
+ * @brief       Call the callback of a finished transaction and release the transaction buffer.
+ *
+ * @param[in]   p_dk_twi_mngr   Pointer to TWI manager instance.
+ * @param[in]   p_transaction   Finished transaction.
+ * @param[in]   transfer_idx    Index of the transfer reported to the callback.
+ * @param[in]   result          Transaction result.
+ */
+static void transaction_complete(dk_twi_mngr_t const             *p_dk_twi_mngr,
+                                 dk_twi_mngr_transaction_t const *p_transaction,
+                                 uint8_t                          transfer_idx,
+                                 ret_code_t                       result)
+{
+    if (p_transaction->callback)
+    {
+        dk_twi_mngr_transfer_t transfer = *transfer_get(p_transaction, transfer_idx);
+
+#if DK_TWI_MNGR_DEFERRED_CB_ENABLED
+        if ((p_transaction->flags & DK_TWI_MNGR_FLAG_DEFERRED_CB) &&
+            deferred_callback_post(p_dk_twi_mngr, p_transaction, &transfer, result))
+        {
+            return;
+        }
+#endif
+
+        p_transaction->callback(result, p_transaction->event_type, &transfer, p_transaction->p_user_data);
+    }
+
+    // The secondary buffer will always follow right after the primary buffer, so
+    // in order to free the memory allocated for both buffers only the address of primary
+    // buffer has to be released. For sequences the whole allocation starts at the primary
+    // buffer of the first transfer.
+    buffer_release(p_dk_twi_mngr,
+                   transfer_get(p_transaction, 0)->transfer_description.p_primary_buf,
+                   p_transaction->buff_ownership,
+                   p_transaction->release,
+                   p_transaction->p_user_data);
+
+    group_member_done(p_transaction->p_group, result);
+}
+
+/**
+ * @brief       Take a queued transaction out of its queue to complete it right away.
+ *
+ * @details     The transaction stays in its queue marked as completed, so it is dropped silently when it reaches the
+ *              front. Its buffer is now released by the caller. Must be called from a critical region.
+ *
+ * @param[in]   p_pending       Queued transaction.
+ * @param[out]  p_transaction   Copy of the transaction.
+ */
+static void queued_transaction_take(dk_twi_mngr_transaction_t *p_pending, dk_twi_mngr_transaction_t *p_transaction)
+{
+    *p_transaction = *p_pending;
+
+    // The owner may release the transfer array as soon as the transaction is completed.
+    p_pending->transfer        = *transfer_get(p_pending, 0);
+    p_pending->p_transfers     = NULL;
+    p_pending->callback        = NULL;
+    p_pending->p_group         = NULL;
+    p_pending->buff_ownership  = DK_TWI_MNGR_BUFF_BORROWED;
+    p_pending->flags          |= DK_TWI_MNGR_FLAG_CANCELLED | DK_TWI_MNGR_FLAG_COMPLETED;
+}
+
+static bool is_shared_read(dk_twi_mngr_transaction_t const *p_transaction)
+{
+    return ((p_transaction->flags & (DK_TWI_MNGR_FLAG_SHARED_READ | DK_TWI_MNGR_FLAG_CANCELLED)) ==
+            DK_TWI_MNGR_FLAG_SHARED_READ) &&
+           (p_transaction->p_transfers == NULL) && (p_transaction->transfer.transfer_description.type == DRV_XFER_TXRX);
+}
+
+static bool is_same_read(dk_twi_mngr_transaction_t const *p_a, dk_twi_mngr_transaction_t const *p_b)
+{
+    dk_twi_mngr_xfer_desc_t const *p_xfer_a = &p_a->transfer.transfer_description;
+    dk_twi_mngr_xfer_desc_t const *p_xfer_b = &p_b->transfer.transfer_description;
+
+    return (p_xfer_a->address == p_xfer_b->address) && (p_a->mux_channels == p_b->mux_channels) &&
+           (p_xfer_a->primary_length == p_xfer_b->primary_length) &&
+           (p_xfer_a->secondary_length == p_xfer_b->secondary_length) &&
+           (memcmp(p_xfer_a->p_primary_buf, p_xfer_b->p_primary_buf, p_xfer_a->primary_length) == 0);
+}
+
+/**
+ * @brief       Check if a transaction that may change the state of the slave of a shared read is queued.
+ *
+ * @details     All queues are checked, as transactions of other queues may get to the bus before a queued read.
+ *              Must be called from a critical region.
+ *
+ * @param[in]   p_dk_twi_mngr   Pointer to TWI manager instance.
+ * @param[in]   p_read          Finished shared read.
+ *
+ * @retval      true            If such a transaction is queued or a queued transaction is not known yet.
+ * @retval      false           If only shared reads are queued for the slave.
+ */
+static bool shared_read_barrier_queued(dk_twi_mngr_t const *p_dk_twi_mngr, dk_twi_mngr_transaction_t const *p_read)
+{
+    for (uint8_t i = 0; i < DK_TWI_MNGR_PRIORITY_COUNT; i++)
+    {
+        dk_mpsc_queue_t const *p_queue = p_dk_twi_mngr->p_queues[i];
+        uint32_t               count   = dk_mpsc_queue_pending_count(p_queue);
+
+        for (uint32_t offset = 0; offset < count; offset++)
+        {
+            dk_twi_mngr_transaction_t const *p_pending = dk_mpsc_queue_pending_get(p_queue, offset);
+
+            if (p_pending == NULL)
+            {
+                // Element is still being written by a preempted producer, it may be a write to the slave.
+                return true;
+            }
+
+            if ((p_pending->flags & DK_TWI_MNGR_FLAG_CANCELLED) || is_shared_read(p_pending))
+            {
+                // Other shared reads do not change the slave state.
+                continue;
+            }
+
+            if ((p_pending->p_transfers != NULL) ||
+                (p_pending->transfer.transfer_description.address == p_read->transfer.transfer_description.address))
+            {
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+/**
+ * @brief       Take a queued read that is identical to a finished shared read.
+ *
+ * @details     No read is taken while a transaction that may change the slave state is queued in any queue, so a
+ *              shared read never returns data older than what the bus order would give.
+ *
+ * @param[in]   p_dk_twi_mngr   Pointer to TWI manager instance.
+ * @param[in]   p_read          Finished shared read.
+ * @param[out]  p_follower      Copy of the identical read.
+ *
+ * @retval      true            If an identical read was taken.
+ * @retval      false           If no identical read can be taken.
+ */
+static bool shared_read_follower_take(dk_twi_mngr_t const             *p_dk_twi_mngr,
+                                      dk_twi_mngr_transaction_t const *p_read,
+                                      dk_twi_mngr_transaction_t       *p_follower)
+{
+    bool found = false;
+
+    CRITICAL_REGION_ENTER();
+    bool barrier = shared_read_barrier_queued(p_dk_twi_mngr, p_read);
+
+    for (uint8_t i = 0; (i < DK_TWI_MNGR_PRIORITY_COUNT) && !barrier && !found; i++)
+    {
+        dk_mpsc_queue_t const *p_queue = p_dk_twi_mngr->p_queues[i];
+        uint32_t               count   = dk_mpsc_queue_pending_count(p_queue);
+
+        for (uint32_t offset = 0; offset < count; offset++)
+        {
+            dk_twi_mngr_transaction_t *p_pending = dk_mpsc_queue_pending_get(p_queue, offset);
+
+            if ((p_pending != NULL) && is_shared_read(p_pending) && is_same_read(p_pending, p_read))
+            {
+                queued_transaction_take(p_pending, p_follower);
+
+                found = true;
+                break;
+            }
+        }
+    }
+    CRITICAL_REGION_EXIT();
+
+    return found;
+}
+
+/**
+ * @brief       Complete every queued read that is identical to a finished shared read with its data.
+ *
+ * @param[in]   p_dk_twi_mngr   Pointer to TWI manager instance.
+ * @param[in]   p_read          Finished shared read.
+ */
+static void shared_read_fan_out(dk_twi_mngr_t const *p_dk_twi_mngr, dk_twi_mngr_transaction_t const *p_read)
+{
+    dk_twi_mngr_xfer_desc_t const *p_xfer = &p_read->transfer.transfer_description;
+    dk_twi_mngr_transaction_t      follower;
+
+    while (shared_read_follower_take(p_dk_twi_mngr, p_read, &follower))
+    {
+        memcpy(
+          follower.transfer.transfer_description.p_secondary_buf, p_xfer->p_secondary_buf, p_xfer->secondary_length);
+
+        stats_merged(p_dk_twi_mngr);
+        transaction_complete(p_dk_twi_mngr, &follower, 0, NRF_SUCCESS);
+    }
+}
+
+static void transaction_end_signal(dk_twi_mngr_t const *p_dk_twi_mngr, ret_code_t result)
+{
+    ASSERT(p_dk_twi_mngr != NULL);
+
+    // Pointer for cleaner code.
+    dk_twi_mngr_cb_t *p_cb = p_dk_twi_mngr->p_dk_twi_mngr_cb;
+
+    // [use a local variable to avoid using two volatile variables in one
+    //  expression]
+    dk_twi_mngr_transaction_t transaction = p_cb->current_transaction;
+
+    DK_TRACE(DK_TRACE_EVT_TWI_MNGR_XFER_END,
+             DK_TRACE_INSTANCE_ARG(p_dk_twi_mngr->twi.drv_inst_idx,
+                                   transfer_get(&transaction, 0)->transfer_description.address),
+             result);
+
+    // Report the last performed transfer (the failed one in case of an error).
+    uint8_t transfer_idx = MIN(p_cb->current_transfer_idx, transfer_count_get(&transaction) - 1);
+
+    // Nothing is on the bus anymore, stop supervising it.
+    p_cb->watchdog_ticks = 0;
+#if DK_TWI_MNGR_USE_TWIM
+    p_cb->triggered = false;
+#endif
+
+    stats_transaction_end(p_dk_twi_mngr, &transaction, result);
+
+    if ((result == NRF_SUCCESS) && is_shared_read(&transaction))
+    {
+        // Identical reads are completed before the read buffer is released with this transaction.
+        shared_read_fan_out(p_dk_twi_mngr, &transaction);
+    }
+
+    transaction_complete(p_dk_twi_mngr, &transaction, transfer_idx, result);
+}
+
+/**
+ * @brief       Start supervising the current transaction.
+ *
+ * @details     The watchdog timer is started only if it is not running already. When it expires before the deadline
+ *              of the current transaction it is restarted for the remaining time, so the timer is not restarted for
+ *              every transaction.
+ *
+ * @param[in]   p_dk_twi_mngr   Pointer to TWI manager instance.
+ * @param[in]   timeout_ms      Timeout of the transaction, 0 for the default timeout.
+ */
+static void watchdog_arm(dk_twi_mngr_t const *p_dk_twi_mngr, uint16_t timeout_ms)
+{
+    // Pointer for cleaner code.
+    dk_twi_mngr_cb_t *p_cb = p_dk_twi_mngr->p_dk_twi_mngr_cb;
+
+    uint32_t ticks = APP_TIMER_TICKS((timeout_ms != 0) ? timeout_ms : DK_TWI_MNGR_TRANSACTION_TIMEOUT_MS);
+
+    ticks = MAX(ticks, APP_TIMER_MIN_TIMEOUT_TICKS);
+
+    // The timeout handler reads the start tick and the timeout atomically. Clearing the timeout first makes it see
+    // either no timeout or both new values, it then stops or keeps the timer and the exchange below decides whether
+    // the timer is started here.
+    __atomic_store_n(&p_cb->watchdog_ticks, 0, __ATOMIC_RELAXED);
+    __atomic_store_n(&p_cb->watchdog_start, app_timer_cnt_get(), __ATOMIC_RELAXED);
+    __atomic_store_n(&p_cb->watchdog_ticks, ticks, __ATOMIC_SEQ_CST);
+
+    bool running = false;
+    bool start_timer =
+      __atomic_compare_exchange_n(&p_cb->watchdog_running, &running, true, false, __ATOMIC_SEQ_CST, __ATOMIC_RELAXED);
+
+    if (start_timer && (app_timer_start(*p_dk_twi_mngr->p_watchdog_timer_id, ticks, (void *)p_dk_twi_mngr) !=
+                        NRF_SUCCESS))
+    {
+        NRF_LOG_ERROR("Failed to start watchdog");
+        p_cb->watchdog_running = false;
+    }
+}
+
+static bool queues_are_empty(dk_twi_mngr_t const *p_dk_twi_mngr)
+{
+    for (uint8_t i = 0; i < DK_TWI_MNGR_PRIORITY_COUNT; i++)
+    {
+        if (!dk_mpsc_queue_is_empty(p_dk_twi_mngr->p_queues[i]))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+static void start_pending_transaction(dk_twi_mngr_t const *p_dk_twi_mngr, bool switch_transaction)
+{
+    ASSERT(p_dk_twi_mngr != NULL);
+
+    // Pointer for cleaner code.
+    dk_twi_mngr_cb_t *p_cb = p_dk_twi_mngr->p_dk_twi_mngr_cb;
+
+    for (;;)
+    {
+        if (!switch_transaction)
+        {
+            bool idle = false;
+
+            // Only the context that sets transaction_in_progress consumes the queues, the others leave the pending
+            // transactions to it.
+            if (!__atomic_compare_exchange_n(
+                  &p_cb->transaction_in_progress, &idle, true, false, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED))
+            {
+                return;
+            }
+        }
+
+        if (transaction_pop(p_dk_twi_mngr) != NRF_SUCCESS)
+        {
+            bus_idle_mark(p_dk_twi_mngr);
+            __atomic_store_n(&p_cb->transaction_in_progress, false, __ATOMIC_RELEASE);
+
+            // A producer may have published a transaction after the pop while the manager still looked busy.
+            if (queues_are_empty(p_dk_twi_mngr))
+            {
+                return;
+            }
+
+            switch_transaction = false;
+            continue;
+        }
+
+        p_cb->current_transfer_idx = 0;
+
+        if (p_cb->current_transaction.flags & DK_TWI_MNGR_FLAG_COMPLETED)
+        {
+            // Already completed outside of the queue.
+            switch_transaction = true;
+            continue;
+        }
+
+        if (p_cb->current_transaction.flags & DK_TWI_MNGR_FLAG_CANCELLED)
+        {
+            // Cancelled while queued, drop it without touching the bus.
+            transaction_end_signal(p_dk_twi_mngr, DK_TWI_MNGR_ERROR_ABORTED);
+            switch_transaction = true;
+            continue;
+        }
+
+        if (deadline_missed(p_dk_twi_mngr))
+        {
+            // Too late to be of use, leave the bus to transactions that can still make their deadline.
+            stats_deadline_missed(p_dk_twi_mngr);
+            transaction_end_signal(p_dk_twi_mngr, DK_TWI_MNGR_ERROR_DEADLINE_MISSED);
+            switch_transaction = true;
+            continue;
+        }
+
+        ret_code_t result;
+
+        watchdog_arm(p_dk_twi_mngr, p_cb->current_transaction.timeout_ms);
+        stats_transaction_start(p_dk_twi_mngr);
+
+        // Try to start first transfer for this new transaction.
+        result = transaction_start(p_dk_twi_mngr);
+
+        // If transaction started successfully there is nothing more to do here now.
+        if (result == NRF_SUCCESS)
+        {
+            return;
+        }
+
+        NRF_LOG_ERROR("Failed to start transaction 0x%x", result);
+        stats_start_failed(p_dk_twi_mngr);
+
+        // Transfer failed to start - notify user that this transaction
+        // cannot be started and try with next one (in next iteration of
+        // the loop).
+        transaction_end_signal(p_dk_twi_mngr, result);
+
+        switch_transaction = true;
+    }
+}
+
+#if DK_TWI_MNGR_USE_TWIM
+static void triggered_xfer_event_handle(dk_twi_mngr_t const *p_dk_twi_mngr, dk_twi_mngr_drv_evt_t const *p_event)
+{
+    // Pointer for cleaner code.
+    dk_twi_mngr_cb_t *p_cb = p_dk_twi_mngr->p_dk_twi_mngr_cb;
+
+    // [use a local variable to avoid using two volatile variables in one
+    //  expression]
+    dk_twi_mngr_transaction_t transaction = p_cb->current_transaction;
+
+    if (p_event->type != DRV_EVT_DONE)
+    {
+        NRF_LOG_ERROR("Triggered transfer 0x%x", p_event->type);
+        transaction_end_signal(p_dk_twi_mngr, NRF_ERROR_INTERNAL);
+    } else if (transaction.transfer.flags & NRFX_TWIM_FLAG_REPEATED_XFER)
+    {
+        // Transfer stays armed for the next trigger.
+        if (transaction.callback)
+        {
+            transaction.callback(NRF_SUCCESS, transaction.event_type, &transaction.transfer, transaction.p_user_data);
+        }
+        return;
+    } else
+    {
+        transaction_end_signal(p_dk_twi_mngr, NRF_SUCCESS);
+    }
+
+    start_pending_transaction(p_dk_twi_mngr, true);
+}
+#endif // DK_TWI_MNGR_USE_TWIM
+
+static void transfer_event_handle(dk_twi_mngr_t const *p_dk_twi_mngr, dk_twi_mngr_drv_evt_t const *p_event)
+{
+    // Pointer for cleaner code.
+    dk_twi_mngr_cb_t *p_cb = p_dk_twi_mngr->p_dk_twi_mngr_cb;
+
+    ret_code_t result;
+
+    // This callback should be called only during transaction.
+    ASSERT(p_cb->transaction_in_progress);
+
+    DK_TRACE(DK_TRACE_EVT_TWI_MNGR_IRQ,
+             DK_TRACE_INSTANCE_ARG(p_dk_twi_mngr->twi.drv_inst_idx, p_event->type),
+             p_cb->current_transfer_idx);
+
+#if DK_TWI_MNGR_USE_TWIM
+    if (p_cb->triggered)
+    {
+        triggered_xfer_event_handle(p_dk_twi_mngr, p_event);
+        return;
+    }
+#endif
+
+    if (p_cb->mux_switching)
+    {
+        // Channel select has finished, put the transaction itself on the bus.
+        p_cb->mux_switching = false;
+        p_cb->mux_valid     = (p_event->type == DRV_EVT_DONE);
+
+        result = p_cb->mux_valid ? start_transfer(p_dk_twi_mngr) : NRF_ERROR_INTERNAL;
+        if (result == NRF_SUCCESS)
+        {
+            return;
+        }
+
+        NRF_LOG_ERROR("Failed to select mux channels 0x%x", result);
+    } else if (p_event->type == DRV_EVT_DONE)
+    {
+        // [use a local variable to avoid using two volatile variables in one
+        //  expression]
+        dk_twi_mngr_transaction_t transaction = p_cb->current_transaction;
+
+        stats_transfer_done(p_dk_twi_mngr, transfer_get(&transaction, p_cb->current_transfer_idx));
+
+        p_cb->current_transfer_idx++;
+
+        if (p_cb->current_transfer_idx < transfer_count_get(&transaction))
+        {
+            // Chain the next transfer of the sequence without returning to the queue.
+            result = start_transfer(p_dk_twi_mngr);
+            if (result == NRF_SUCCESS)
+            {
+                return;
+            }
+
+            NRF_LOG_ERROR("Failed to start transfer 0x%x", result);
+        } else
+        {
+            result = NRF_SUCCESS;
+        }
+    } else
+    {
+        NRF_LOG_ERROR("0x%x", p_event->type);
+        result = NRF_ERROR_INTERNAL;
+    }
+
+    // The current transaction has been completed or interrupted by some error.
+    // Notify the user and start next one (if there is any).
+    transaction_end_signal(p_dk_twi_mngr, result);
+    start_pending_transaction(p_dk_twi_mngr, true);
+}
+
+/**
+ * @brief       Handle a TWI event, unless the transfer it belongs to is being aborted.
+ *
+ * @details     The bus watchdog interrupt may preempt the TWI interrupt. The interrupt claims the current transaction
+ *              first, so the watchdog does not abort a transfer whose event is being handled, and an event that was
+ *              already raised for an aborted transfer is dropped. Either way the transaction is completed only once.
+ *
+ * @param[in]   p_event     Driver event.
+ * @param[in]   p_context   Pointer to TWI manager instance.
+ */
+static void twi_event_handle(dk_twi_mngr_drv_evt_t const *p_event, void *p_context)
+{
+    ASSERT(p_event != NULL);
+
+    dk_twi_mngr_t const *p_dk_twi_mngr = (dk_twi_mngr_t const *)p_context;
+    dk_twi_mngr_cb_t    *p_cb          = p_dk_twi_mngr->p_dk_twi_mngr_cb;
+
+    bool aborting;
+
+    CRITICAL_REGION_ENTER();
+    aborting             = p_cb->aborting;
+    p_cb->handling_event = !aborting;
+    CRITICAL_REGION_EXIT();
+
+    if (aborting)
+    {
+        // The abort finishes the transaction.
+        return;
+    }
+
+    transfer_event_handle(p_dk_twi_mngr, p_event);
+
+    p_cb->handling_event = false;
+}
+
+DK_PROFILE_REGION_DEF(m_twi_event_profile, "twi_event_handler");
+
+static void twi_event_handler(dk_twi_mngr_drv_evt_t const *p_event, void *p_context)
+{
+    DK_CPU_LOAD_WAKEUP();
+
+    DK_PROFILE_ENTER(m_twi_event_profile);
+    twi_event_handle(p_event, p_context);
+    DK_PROFILE_EXIT(m_twi_event_profile);
+}
+
+/**
+ * @brief       Stop the transfer that is on the bus.
+ *
+ * @details     Neither driver has an abort, so the peripheral is deinitialized (with the ERRATA 89 workaround). The
+ *              manager is marked as aborting so no other context aborts the same transaction, the bus is recovered
+ *              with @ref transfer_abort_finish outside of the critical region. Must be called from a critical region.
+ *
+ * @param[in]   p_dk_twi_mngr   Pointer to TWI manager instance.
+ *
+ * @retval      true            If the transfer was stopped.
+ * @retval      false           If another context is already aborting it or the TWI interrupt is finishing it.
+ */
+static bool transfer_abort_begin(dk_twi_mngr_t const *p_dk_twi_mngr)
+{
+    // Pointer for cleaner code.
+    dk_twi_mngr_cb_t *p_cb = p_dk_twi_mngr->p_dk_twi_mngr_cb;
+
+    if (p_cb->aborting || p_cb->handling_event)
+    {
+        return false;
+    }
+
+    p_cb->aborting = true;
+
+    // The aborted transfer may have been a channel select or addressed to the mux.
+    p_cb->mux_switching = false;
+    p_cb->mux_valid     = false;
+
+    DRV_DISABLE(&p_dk_twi_mngr->twi);
+
+    // Drop an event of the aborted transfer that may be already pending.
+    NRFX_IRQ_PENDING_CLEAR(DRV_IRQ_NUMBER(&p_dk_twi_mngr->twi));
+
+    return true;
+}
+
+/**
+ * @brief       Recover the bus after @ref transfer_abort_begin and carry on with the queue.
+ *
+ * @details     The bus is cleared in case a slave holds SDA low and the peripheral is initialized again, which also
+ *              clears the busy state of the driver. Clearing the bus takes about 100 us, so it is done with interrupts
+ *              enabled. The manager stays busy meanwhile, so no other transaction is started.
+ *
+ * @param[in]   p_dk_twi_mngr   Pointer to TWI manager instance.
+ * @param[in]   result          Result reported for the aborted transaction.
+ */
+static void transfer_abort_finish(dk_twi_mngr_t const *p_dk_twi_mngr, ret_code_t result)
+{
+    // Pointer for cleaner code.
+    dk_twi_mngr_cb_t *p_cb = p_dk_twi_mngr->p_dk_twi_mngr_cb;
+
+    dk_twi_mngr_config_t const *p_twi_config = &p_cb->twi_config;
+
+    if (dk_twi_bus_clear(p_twi_config->scl, p_twi_config->sda) != NRF_SUCCESS)
+    {
+        NRF_LOG_ERROR("SDA is still held low");
+    }
+
+    ret_code_t err_code = DRV_INIT(&p_dk_twi_mngr->twi, p_twi_config, twi_event_handler, (void *)p_dk_twi_mngr);
+    ASSERT(err_code == NRF_SUCCESS);
+    UNUSED_VARIABLE(err_code);
+
+    DRV_ENABLE(&p_dk_twi_mngr->twi);
+
+    // The aborted transfer will not generate a TWI event, finish the transaction here and carry on with the queue.
+    transaction_end_signal(p_dk_twi_mngr, result);
+    p_cb->aborting = false;
+
+    start_pending_transaction(p_dk_twi_mngr, true);
+}
+
+static bool is_own_transaction(dk_twi_mngr_transaction_t const *p_transaction,
+                               dk_twi_mngr_callback_t           callback,
+                               void const                      *p_user_data)
+{
+    return (p_transaction->callback == callback) && (p_transaction->p_user_data == p_user_data);
+}
+
+/**
+ * @brief       Cancel a transaction that is queued or in progress.
+ *
+ * @param[in]   p_dk_twi_mngr   Pointer to TWI manager instance.
+ * @param[in]   callback        Callback of the transaction.
+ * @param[in]   p_user_data     User data of the transaction.
+ * @param[in]   result          Result reported for a transaction that had to be aborted on the bus.
+ *
+ * @retval      true            If the transaction was cancelled.
+ * @retval      false           If the transaction was not found, i.e. it has already finished.
+ */
+static bool transaction_cancel(dk_twi_mngr_t const   *p_dk_twi_mngr,
+                               dk_twi_mngr_callback_t callback,
+                               void const            *p_user_data,
+                               ret_code_t             result)
+{
+    // Pointer for cleaner code.
+    dk_twi_mngr_cb_t *p_cb = p_dk_twi_mngr->p_dk_twi_mngr_cb;
+
+    bool cancelled = false;
+    bool aborted   = false;
+
+    CRITICAL_REGION_ENTER();
+    for (uint8_t i = 0; (i < DK_TWI_MNGR_PRIORITY_COUNT) && !cancelled; i++)
+    {
+        dk_mpsc_queue_t const *p_queue = p_dk_twi_mngr->p_queues[i];
+        uint32_t               count   = dk_mpsc_queue_pending_count(p_queue);
+
+        for (uint32_t offset = 0; offset < count; offset++)
+        {
+            dk_twi_mngr_transaction_t *p_pending = dk_mpsc_queue_pending_get(p_queue, offset);
+
+            if ((p_pending != NULL) && !(p_pending->flags & DK_TWI_MNGR_FLAG_CANCELLED) &&
+                is_own_transaction(p_pending, callback, p_user_data))
+            {
+                // The owner may release the transfer array as soon as this returns, keep only the first transfer
+                // so its buffer can still be freed when the transaction is dropped.
+                p_pending->transfer     = *transfer_get(p_pending, 0);
+                p_pending->p_transfers  = NULL;
+                p_pending->callback     = NULL;
+                p_pending->flags       |= DK_TWI_MNGR_FLAG_CANCELLED;
+
+                cancelled = true;
+                break;
+            }
+        }
+    }
+
+    if (!cancelled && p_cb->transaction_in_progress)
+    {
+        // [use a local variable to avoid using two volatile variables in one
+        //  expression]
+        dk_twi_mngr_transaction_t transaction = p_cb->current_transaction;
+
+        if (is_own_transaction(&transaction, callback, p_user_data))
+        {
+            aborted = transfer_abort_begin(p_dk_twi_mngr);
+        }
+    }
+    CRITICAL_REGION_EXIT();
+
+    if (aborted)
+    {
+        transfer_abort_finish(p_dk_twi_mngr, result);
+    }
+
+    return cancelled || aborted;
+}
+
+/**
+ * @brief       Take the first queued transaction of an owner.
+ *
+ * @param[in]   p_dk_twi_mngr   Pointer to TWI manager instance.
+ * @param[in]   p_user_data     User data of the owner.
+ * @param[out]  p_transaction   Copy of the transaction.
+ *
+ * @retval      true            If a transaction was taken.
+ * @retval      false           If the owner has no queued transaction.
+ */
+static bool owner_transaction_take(dk_twi_mngr_t const       *p_dk_twi_mngr,
+                                   void const                *p_user_data,
+                                   dk_twi_mngr_transaction_t *p_transaction)
+{
+    bool found = false;
+
+    CRITICAL_REGION_ENTER();
+    for (uint8_t i = 0; (i < DK_TWI_MNGR_PRIORITY_COUNT) && !found; i++)
+    {
+        dk_mpsc_queue_t const *p_queue = p_dk_twi_mngr->p_queues[i];
+        uint32_t               count   = dk_mpsc_queue_pending_count(p_queue);
+
+        for (uint32_t offset = 0; offset < count; offset++)
+        {
+            dk_twi_mngr_transaction_t *p_pending = dk_mpsc_queue_pending_get(p_queue, offset);
+
+            if ((p_pending != NULL) && !(p_pending->flags & DK_TWI_MNGR_FLAG_CANCELLED) &&
+                (p_pending->p_user_data == p_user_data))
+            {
+                queued_transaction_take(p_pending, p_transaction);
+
+                found = true;
+                break;
+            }
+        }
+    }
+    CRITICAL_REGION_EXIT();
+
+    return found;
+}
+
+static void watchdog_timeout_handler(void *p_context)
+{
+    dk_twi_mngr_t const *p_dk_twi_mngr = (dk_twi_mngr_t const *)p_context;
+    dk_twi_mngr_cb_t    *p_cb          = p_dk_twi_mngr->p_dk_twi_mngr_cb;
+
+    bool     expired   = false;
+    uint32_t remaining = 0;
+
+    CRITICAL_REGION_ENTER();
+    if (p_cb->transaction_in_progress && (p_cb->watchdog_ticks != 0))
+    {
+        uint32_t elapsed = app_timer_cnt_diff_compute(app_timer_cnt_get(), p_cb->watchdog_start);
+
+        if (p_cb->handling_event)
+        {
+            // The TWI interrupt was preempted while handling the transfer, check again once it is done.
+            remaining = APP_TIMER_MIN_TIMEOUT_TICKS;
+        } else if (elapsed >= p_cb->watchdog_ticks)
+        {
+            p_cb->watchdog_ticks = 0;
+            expired              = transfer_abort_begin(p_dk_twi_mngr);
+        } else
+        {
+            remaining = p_cb->watchdog_ticks - elapsed;
+        }
+    }
+
+    // The timer only keeps running while a transaction is supervised, it is started again by the next one.
+    p_cb->watchdog_running = (remaining != 0);
+    CRITICAL_REGION_EXIT();
+
+    if ((remaining != 0) && (app_timer_start(*p_dk_twi_mngr->p_watchdog_timer_id,
+                                             MAX(remaining, APP_TIMER_MIN_TIMEOUT_TICKS),
+                                             p_context) != NRF_SUCCESS))
+    {
+        NRF_LOG_ERROR("Failed to restart watchdog");
+        p_cb->watchdog_running = false;
+    }
+
+    if (expired)
+    {
+        NRF_LOG_WARNING("Transaction timed out, recovering bus");
+
+        transfer_abort_finish(p_dk_twi_mngr, NRF_ERROR_TIMEOUT);
+    }
+}
+
+#if DK_TWI_MNGR_IDLE_TIMEOUT_MS
+static void idle_timeout_handler(void *p_context)
+{
+    dk_twi_mngr_t const *p_dk_twi_mngr = (dk_twi_mngr_t const *)p_context;
+    dk_twi_mngr_cb_t    *p_cb          = p_dk_twi_mngr->p_dk_twi_mngr_cb;
+
+    uint32_t timeout   = APP_TIMER_TICKS(DK_TWI_MNGR_IDLE_TIMEOUT_MS);
+    uint32_t remaining = timeout;
+    bool     idle      = false;
+
+    // The peripheral is powered down by the owner of the bus. A busy bus is checked again after a full timeout.
+    if (__atomic_compare_exchange_n(
+          &p_cb->transaction_in_progress, &idle, true, false, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED))
+    {
+        uint32_t elapsed = app_timer_cnt_diff_compute(app_timer_cnt_get(), p_cb->idle_start);
+
+        if (elapsed < timeout)
+        {
+            remaining = timeout - elapsed;
+        } else if (queues_are_empty(p_dk_twi_mngr))
+        {
+            CRITICAL_REGION_ENTER();
+            powered_time_update(p_cb);
+            p_cb->powered = false;
+            CRITICAL_REGION_EXIT();
+
+            // Disabling applies the ERRATA 89 workaround, which cuts the power of the peripheral.
+            DRV_DISABLE(&p_dk_twi_mngr->twi);
+            remaining = 0;
+        }
+
+        __atomic_store_n(&p_cb->transaction_in_progress, false, __ATOMIC_RELEASE);
+
+        if (!queues_are_empty(p_dk_twi_mngr))
+        {
+            start_pending_transaction(p_dk_twi_mngr, false);
+        }
+    }
+
+    if (remaining != 0)
+    {
+        CRITICAL_REGION_ENTER();
+        powered_time_update(p_cb);
+        CRITICAL_REGION_EXIT();
+
+        idle_timer_start(p_dk_twi_mngr, remaining);
+    }
+}
+#endif
+
+static void perform_timeout_handler(void *p_context)
+{
+    // Pointer for cleaner code.
+    dk_twi_mngr_cb_t *p_cb = ((dk_twi_mngr_t const *)p_context)->p_dk_twi_mngr_cb;
+
+    // Waking up the CPU is done by the timer interrupt itself. The waiting call may already have finished and given
+    // the timer up, in that case there is nobody to notify.
+    CRITICAL_REGION_ENTER();
+    dk_twi_mngr_cb_data_t *p_cb_data = (dk_twi_mngr_cb_data_t *)p_cb->p_perform_waiter;
+    if (p_cb_data != NULL)
+    {
+        p_cb_data->timed_out = true;
+    }
+    CRITICAL_REGION_EXIT();
+}
+
+ret_code_t dk_twi_mngr_init(dk_twi_mngr_t const *p_dk_twi_mngr, dk_twi_mngr_config_t const *p_default_twi_config)
+{
+    ASSERT(p_dk_twi_mngr != NULL);
+    for (uint8_t i = 0; i < DK_TWI_MNGR_PRIORITY_COUNT; i++)
+    {
+        ASSERT(p_dk_twi_mngr->p_queues[i] != NULL);
+        ASSERT(p_dk_twi_mngr->p_queues[i]->size > 0);
+    }
+    ASSERT(p_default_twi_config != NULL);
+
+    ret_code_t err_code;
+
+    err_code = app_timer_create(p_dk_twi_mngr->p_perform_timer_id, APP_TIMER_MODE_SINGLE_SHOT, perform_timeout_handler);
+    VERIFY_SUCCESS(err_code);
+
+    err_code =
+      app_timer_create(p_dk_twi_mngr->p_watchdog_timer_id, APP_TIMER_MODE_SINGLE_SHOT, watchdog_timeout_handler);
+    VERIFY_SUCCESS(err_code);
+
+#if DK_TWI_MNGR_IDLE_TIMEOUT_MS
+    err_code = app_timer_create(p_dk_twi_mngr->p_idle_timer_id, APP_TIMER_MODE_SINGLE_SHOT, idle_timeout_handler);
+    VERIFY_SUCCESS(err_code);
+#endif
+
+    p_dk_twi_mngr->p_dk_twi_mngr_cb->p_perform_waiter = NULL;
+    p_dk_twi_mngr->p_dk_twi_mngr_cb->aborting         = false;
+    p_dk_twi_mngr->p_dk_twi_mngr_cb->handling_event   = false;
+    p_dk_twi_mngr->p_dk_twi_mngr_cb->watchdog_running = false;
+    p_dk_twi_mngr->p_dk_twi_mngr_cb->watchdog_ticks   = 0;
+    p_dk_twi_mngr->p_dk_twi_mngr_cb->mux_address      = 0;
+    p_dk_twi_mngr->p_dk_twi_mngr_cb->mux_valid        = false;
+    p_dk_twi_mngr->p_dk_twi_mngr_cb->mux_switching    = false;
+    p_dk_twi_mngr->p_dk_twi_mngr_cb->mux_batch_count  = 0;
+#if DK_TWI_MNGR_USE_TWIM
+    p_dk_twi_mngr->p_dk_twi_mngr_cb->triggered = false;
+#endif
+
+    for (uint8_t i = 0; i < DK_TWI_MNGR_PRIORITY_COUNT; i++)
+    {
+        dk_mpsc_queue_init(p_dk_twi_mngr->p_queues[i]);
+    }
+
+    buff_pools_init(p_dk_twi_mngr);
+    memset((void *)p_dk_twi_mngr->p_dk_twi_mngr_cb->skip_count, 0, sizeof(p_dk_twi_mngr->p_dk_twi_mngr_cb->skip_count));
+
+#if DK_TWI_MNGR_STATS_ENABLED
+    memset(&p_dk_twi_mngr->p_dk_twi_mngr_cb->stats, 0, sizeof(p_dk_twi_mngr->p_dk_twi_mngr_cb->stats));
+    p_dk_twi_mngr->p_dk_twi_mngr_cb->stats_on_wire = false;
+#endif
+
+    // Configuration is kept so the peripheral can be re-initialized when a transfer has to be aborted.
+    p_dk_twi_mngr->p_dk_twi_mngr_cb->twi_config = *p_default_twi_config;
+
+    err_code = DRV_INIT(
+      &p_dk_twi_mngr->twi, &p_dk_twi_mngr->p_dk_twi_mngr_cb->twi_config, twi_event_handler, (void *)p_dk_twi_mngr);
+    VERIFY_SUCCESS(err_code);
+
+    DRV_ENABLE(&p_dk_twi_mngr->twi);
+
+#if DK_TWI_MNGR_IDLE_TIMEOUT_MS
+    p_dk_twi_mngr->p_dk_twi_mngr_cb->powered       = true;
+    p_dk_twi_mngr->p_dk_twi_mngr_cb->powered_ticks = 0;
+    p_dk_twi_mngr->p_dk_twi_mngr_cb->powered_start = app_timer_cnt_get();
+    p_dk_twi_mngr->p_dk_twi_mngr_cb->idle_start    = p_dk_twi_mngr->p_dk_twi_mngr_cb->powered_start;
+
+    idle_timer_start(p_dk_twi_mngr, APP_TIMER_TICKS(DK_TWI_MNGR_IDLE_TIMEOUT_MS));
+#endif
+
+    p_dk_twi_mngr->p_dk_twi_mngr_cb->transaction_in_progress = false;
 
-static ret_code_t start_transfer(dk_twi_mngr_t const *p_dk_twi_mngr)
+    return NRF_SUCCESS;
+}
+
+void dk_twi_mngr_deinit(dk_twi_mngr_t const *p_dk_twi_mngr)
 {
     ASSERT(p_dk_twi_mngr != NULL);
 
-    // Pointer for cleaner code.
-    dk_twi_mngr_cb_t *p_cb = p_dk_twi_mngr->p_dk_twi_mngr_cb;
+    (void)app_timer_stop(*p_dk_twi_mngr->p_perform_timer_id);
+    (void)app_timer_stop(*p_dk_twi_mngr->p_watchdog_timer_id);
 
-    // [use a local variable to avoid using two volatile variables in one
-    //  expression]
-    dk_twi_mngr_transfer_t transfer = p_cb->current_transaction.transfer;
+    p_dk_twi_mngr->p_dk_twi_mngr_cb->watchdog_running = false;
+
+#if DK_TWI_MNGR_IDLE_TIMEOUT_MS
+    (void)app_timer_stop(*p_dk_twi_mngr->p_idle_timer_id);
+
+    // The peripheral may be powered down already.
+    if (p_dk_twi_mngr->p_dk_twi_mngr_cb->powered)
+    {
+        p_dk_twi_mngr->p_dk_twi_mngr_cb->powered = false;
+        DRV_UNINIT(&p_dk_twi_mngr->twi);
+    }
+#else
+    DRV_UNINIT(&p_dk_twi_mngr->twi);
+#endif
 
-    return nrfx_twi_xfer(&p_dk_twi_mngr->twi, &transfer.transfer_description, transfer.flags);
+    p_dk_twi_mngr->p_dk_twi_mngr_cb->transaction_in_progress = false;
 }
 
-static void transaction_end_signal(dk_twi_mngr_t const *p_dk_twi_mngr, ret_code_t result)
+void *dk_twi_mngr_data_buffer_alloc(dk_twi_mngr_t const *p_dk_twi_mngr, uint32_t size)
 {
     ASSERT(p_dk_twi_mngr != NULL);
 
-    if (p_dk_twi_mngr->p_dk_twi_mngr_cb->current_transaction.callback)
-    {
-        // [use a local variable to avoid using two volatile variables in one
-        //  expression]
-        dk_twi_mngr_transaction_t transaction = p_dk_twi_mngr->p_dk_twi_mngr_cb->current_transaction;
+    void *p_buffer = buffer_alloc(p_dk_twi_mngr, size);
 
-        p_dk_twi_mngr->p_dk_twi_mngr_cb->current_transaction.callback(result,
-                                                                      transaction.event_type,
-                                                                      &transaction.transfer,
-                                                                      transaction.p_user_data);
+    if (p_buffer == NULL)
+    {
+        NRF_LOG_WARNING("Failed to allocate %u byte buffer", size);
     }
 
-    // The secondary buffer will always follow right after the primary buffer, so
-    // in order to free the memory allocated for both buffers only the address of primary
-    // buffer has to be passed to nrf_free function.
-    nrf_free(p_dk_twi_mngr->p_dk_twi_mngr_cb->current_transaction.transfer.transfer_description.p_primary_buf);
+    return p_buffer;
 }
 
-static void start_pending_transaction(dk_twi_mngr_t const *p_dk_twi_mngr, bool switch_transaction)
+void dk_twi_mngr_data_buffer_free(dk_twi_mngr_t const *p_dk_twi_mngr, void *p_buffer)
 {
     ASSERT(p_dk_twi_mngr != NULL);
 
-    // Pointer for cleaner code.
-    dk_twi_mngr_cb_t *p_cb = p_dk_twi_mngr->p_dk_twi_mngr_cb;
+    uint8_t *p_block = (uint8_t *)p_buffer;
 
-    for (;;)
+    for (uint8_t i = 0; i < DK_TWI_MNGR_BUFF_CLASS_COUNT; i++)
     {
-        bool start_transaction = false;
+        dk_twi_mngr_buff_pool_t const       *p_pool    = &p_dk_twi_mngr->buff_pool[i];
+        volatile dk_twi_mngr_buff_pool_cb_t *p_pool_cb = &p_dk_twi_mngr->p_dk_twi_mngr_cb->buff_pool_cb[i];
 
-        CRITICAL_REGION_ENTER();
-        if (switch_transaction || dk_twi_mngr_is_idle(p_dk_twi_mngr))
+        if ((p_block < p_pool->p_mem) || (p_block >= &p_pool->p_mem[p_pool->block_count * p_pool->block_size]))
         {
-            if (nrf_queue_pop(p_dk_twi_mngr->p_queue, (void *)(&p_cb->current_transaction)) == NRF_SUCCESS)
-            {
-                start_transaction             = true;
-                p_cb->transaction_in_progress = true;
-            } else
-            {
-                p_cb->transaction_in_progress = false;
-            }
+            continue;
         }
-        CRITICAL_REGION_EXIT();
 
-        if (!start_transaction)
-        {
-            return;
-        } else
+        ASSERT(p_pool_cb->free_count < p_pool->block_count);
+
+        uint16_t block = (p_block - p_pool->p_mem) / p_pool->block_size;
+        uint32_t head  = __atomic_load_n(&p_pool_cb->free_head, __ATOMIC_RELAXED);
+
+        do
         {
-            ret_code_t result;
+            p_pool->p_next_free[block] = (uint16_t)(head & UINT16_MAX);
+        } while (!__atomic_compare_exchange_n(
+          &p_pool_cb->free_head, &head, BUFF_POOL_HEAD(head, block), true, __ATOMIC_RELEASE, __ATOMIC_RELAXED));
 
-            // Try to start first transfer for this new transaction.
-            result = start_transfer(p_dk_twi_mngr);
+        __atomic_add_fetch(&p_pool_cb->free_count, 1, __ATOMIC_RELAXED);
 
-            // If transaction started successfully there is nothing more to do here now.
-            if (result == NRF_SUCCESS)
-            {
-                return;
-            }
+        return;
+    }
+}
+
+uint16_t dk_twi_mngr_buff_max_utilization_get(dk_twi_mngr_t const *p_dk_twi_mngr, dk_twi_mngr_buff_class_t buff_class)
+{
+    ASSERT(p_dk_twi_mngr != NULL);
+    ASSERT(buff_class < DK_TWI_MNGR_BUFF_CLASS_COUNT);
+
+    return p_dk_twi_mngr->p_dk_twi_mngr_cb->buff_pool_cb[buff_class].max_utilization;
+}
+
+void dk_twi_mngr_buff_max_utilization_reset(dk_twi_mngr_t const *p_dk_twi_mngr, dk_twi_mngr_buff_class_t buff_class)
+{
+    ASSERT(p_dk_twi_mngr != NULL);
+    ASSERT(buff_class < DK_TWI_MNGR_BUFF_CLASS_COUNT);
 
-            NRF_LOG_ERROR("Failed to start transaction 0x%x", result);
+    dk_twi_mngr_buff_pool_t const       *p_pool    = &p_dk_twi_mngr->buff_pool[buff_class];
+    volatile dk_twi_mngr_buff_pool_cb_t *p_pool_cb = &p_dk_twi_mngr->p_dk_twi_mngr_cb->buff_pool_cb[buff_class];
 
-            // Transfer failed to start - notify user that this transaction
-            // cannot be started and try with next one (in next iteration of
-            // the loop).
-            transaction_end_signal(p_dk_twi_mngr, result);
+    CRITICAL_REGION_ENTER();
+    p_pool_cb->max_utilization = p_pool->block_count - p_pool_cb->free_count;
+    CRITICAL_REGION_EXIT();
+}
 
-            switch_transaction = true;
+uint32_t dk_twi_mngr_cancel(dk_twi_mngr_t const *p_dk_twi_mngr, void const *p_user_data, bool notify)
+{
+    ASSERT(p_dk_twi_mngr != NULL);
+
+    dk_twi_mngr_transaction_t transaction;
+    uint32_t                  count = 0;
+
+    while (owner_transaction_take(p_dk_twi_mngr, p_user_data, &transaction))
+    {
+        if (!notify)
+        {
+            transaction.callback = NULL;
         }
+
+        transaction_complete(p_dk_twi_mngr, &transaction, 0, DK_TWI_MNGR_ERROR_ABORTED);
+        count++;
+    }
+
+    return count;
+}
+
+void dk_twi_mngr_group_open(dk_twi_mngr_group_t *p_group, dk_twi_mngr_group_callback_t callback, void *p_user_data)
+{
+    ASSERT(p_group != NULL);
+
+    p_group->callback    = callback;
+    p_group->p_user_data = p_user_data;
+    p_group->result      = NRF_SUCCESS;
+
+    // The open group holds one reference, so members finishing early do not end it.
+    __atomic_store_n(&p_group->pending, 1, __ATOMIC_RELEASE);
+}
+
+ret_code_t dk_twi_mngr_group_schedule(dk_twi_mngr_t const             *p_dk_twi_mngr,
+                                      dk_twi_mngr_group_t             *p_group,
+                                      dk_twi_mngr_transaction_t const *p_transaction)
+{
+    ASSERT(p_group != NULL);
+    ASSERT(p_transaction != NULL);
+
+    dk_twi_mngr_transaction_t member = *p_transaction;
+
+    member.p_group = p_group;
+
+    // Counted before it is queued, it may finish before dk_twi_mngr_schedule returns.
+    (void)__atomic_add_fetch(&p_group->pending, 1, __ATOMIC_ACQ_REL);
+
+    ret_code_t err_code = dk_twi_mngr_schedule(p_dk_twi_mngr, &member);
+    if (err_code != NRF_SUCCESS)
+    {
+        // Never queued, the open reference keeps the group from finishing here.
+        (void)__atomic_sub_fetch(&p_group->pending, 1, __ATOMIC_ACQ_REL);
     }
+
+    return err_code;
 }
 
-static void twi_event_handler(nrfx_twi_evt_t const *p_event, void *p_context)
+void dk_twi_mngr_group_close(dk_twi_mngr_group_t *p_group)
 {
-    ASSERT(p_event != NULL);
+    ASSERT(p_group != NULL);
 
-    dk_twi_mngr_t *p_dk_twi_mngr = (dk_twi_mngr_t *)p_context;
-    ret_code_t     result;
+    group_member_done(p_group, NRF_SUCCESS);
+}
 
-    // This callback should be called only during transaction.
-    ASSERT(p_dk_twi_mngr->p_dk_twi_mngr_cb->transaction_in_progress);
+void dk_twi_mngr_mux_set(dk_twi_mngr_t const *p_dk_twi_mngr, uint8_t mux_address)
+{
+    ASSERT(p_dk_twi_mngr != NULL);
+
+    // Pointer for cleaner code.
+    dk_twi_mngr_cb_t *p_cb = p_dk_twi_mngr->p_dk_twi_mngr_cb;
+
+    CRITICAL_REGION_ENTER();
+    p_cb->mux_address     = mux_address;
+    p_cb->mux_valid       = false;
+    p_cb->mux_batch_count = 0;
+    CRITICAL_REGION_EXIT();
+}
+
+#if DK_TWI_MNGR_USE_TWIM
+ret_code_t dk_twi_mngr_triggered_xfer_arm(dk_twi_mngr_t const             *p_dk_twi_mngr,
+                                          dk_twi_mngr_transaction_t const *p_transaction,
+                                          uint32_t                        *p_start_task)
+{
+    ASSERT(p_dk_twi_mngr != NULL);
+    ASSERT(p_transaction != NULL);
+    ASSERT(p_start_task != NULL);
+
+    // Pointer for cleaner code.
+    dk_twi_mngr_cb_t *p_cb = p_dk_twi_mngr->p_dk_twi_mngr_cb;
+
+    dk_twi_mngr_transfer_t const *p_transfer = &p_transaction->transfer;
+    bool                          idle       = false;
 
-    if (p_event->type == NRFX_TWI_EVT_DONE)
+    if (p_transaction->p_transfers != NULL)
     {
-        result = NRF_SUCCESS;
-    } else
+        return NRF_ERROR_INVALID_PARAM;
+    }
+
+    // Take the bus the same way the queue consumer does.
+    if (!__atomic_compare_exchange_n(
+          &p_cb->transaction_in_progress, &idle, true, false, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED))
     {
-        NRF_LOG_ERROR("0x%x", p_event->type);
-        result = NRF_ERROR_INTERNAL;
+        return NRF_ERROR_BUSY;
     }
 
-    // The current transaction has been completed or interrupted by some error.
-    // Notify the user and start next one (if there is any).
-    transaction_end_signal(p_dk_twi_mngr, result);
-    start_pending_transaction(p_dk_twi_mngr, true);
+    memcpy((void *)&p_cb->current_transaction, p_transaction, sizeof(dk_twi_mngr_transaction_t));
+    p_cb->current_transfer_idx = 0;
+    p_cb->triggered            = true;
+
+    ret_code_t result = bus_power_up(p_dk_twi_mngr);
+    if (result == NRF_SUCCESS)
+    {
+        result = DRV_XFER(
+          &p_dk_twi_mngr->twi, &p_transfer->transfer_description, p_transfer->flags | NRFX_TWIM_FLAG_HOLD_XFER);
+    }
+
+    if (result != NRF_SUCCESS)
+    {
+        // Nothing was armed, the buffers stay with the caller. Hand the bus back to the queue.
+        p_cb->triggered = false;
+        __atomic_store_n(&p_cb->transaction_in_progress, false, __ATOMIC_RELEASE);
+        start_pending_transaction(p_dk_twi_mngr, false);
+        return result;
+    }
+
+    *p_start_task = nrfx_twim_start_task_get(&p_dk_twi_mngr->twi, p_transfer->transfer_description.type);
+
+    return NRF_SUCCESS;
 }
 
-ret_code_t dk_twi_mngr_init(dk_twi_mngr_t const *p_dk_twi_mngr, nrfx_twi_config_t const *p_default_twi_config)
+ret_code_t dk_twi_mngr_triggered_xfer_disarm(dk_twi_mngr_t const *p_dk_twi_mngr)
 {
     ASSERT(p_dk_twi_mngr != NULL);
-    ASSERT(p_dk_twi_mngr->p_queue != NULL);
-    ASSERT(p_dk_twi_mngr->p_queue->size > 0);
-    ASSERT(p_default_twi_config != NULL);
-
-    ret_code_t err_code;
 
-    err_code = nrf_mem_init();
-    VERIFY_SUCCESS(err_code);
+    bool armed;
 
-    err_code = nrfx_twi_init(&p_dk_twi_mngr->twi, p_default_twi_config, twi_event_handler, (void *)p_dk_twi_mngr);
-    VERIFY_SUCCESS(err_code);
+    CRITICAL_REGION_ENTER();
+    armed = p_dk_twi_mngr->p_dk_twi_mngr_cb->triggered && transfer_abort_begin(p_dk_twi_mngr);
+    CRITICAL_REGION_EXIT();
 
-    nrfx_twi_enable(&p_dk_twi_mngr->twi);
+    if (!armed)
+    {
+        return NRF_ERROR_INVALID_STATE;
+    }
 
-    p_dk_twi_mngr->p_dk_twi_mngr_cb->transaction_in_progress = false;
+    transfer_abort_finish(p_dk_twi_mngr, DK_TWI_MNGR_ERROR_ABORTED);
 
     return NRF_SUCCESS;
 }
+#endif // DK_TWI_MNGR_USE_TWIM
 
-void dk_twi_mngr_deinit(dk_twi_mngr_t const *p_dk_twi_mngr)
+#if DK_TWI_MNGR_IDLE_TIMEOUT_MS
+uint64_t dk_twi_mngr_powered_ticks_get(dk_twi_mngr_t const *p_dk_twi_mngr)
 {
     ASSERT(p_dk_twi_mngr != NULL);
 
-    nrfx_twi_uninit(&p_dk_twi_mngr->twi);
+    uint64_t powered_ticks;
 
-    p_dk_twi_mngr->p_dk_twi_mngr_cb->transaction_in_progress = false;
+    CRITICAL_REGION_ENTER();
+    powered_time_update(p_dk_twi_mngr->p_dk_twi_mngr_cb);
+    powered_ticks = p_dk_twi_mngr->p_dk_twi_mngr_cb->powered_ticks;
+    CRITICAL_REGION_EXIT();
+
+    return powered_ticks;
+}
+#endif // DK_TWI_MNGR_IDLE_TIMEOUT_MS
+
+#if DK_TWI_MNGR_STATS_ENABLED
+void dk_twi_mngr_stats_get(dk_twi_mngr_t const *p_dk_twi_mngr, dk_twi_mngr_stats_t *p_stats)
+{
+    ASSERT(p_dk_twi_mngr != NULL);
+    ASSERT(p_stats != NULL);
+
+    CRITICAL_REGION_ENTER();
+    *p_stats = p_dk_twi_mngr->p_dk_twi_mngr_cb->stats;
+    CRITICAL_REGION_EXIT();
+}
+
+void dk_twi_mngr_stats_reset(dk_twi_mngr_t const *p_dk_twi_mngr)
+{
+    ASSERT(p_dk_twi_mngr != NULL);
+
+    dk_twi_mngr_stats_t *p_stats = &p_dk_twi_mngr->p_dk_twi_mngr_cb->stats;
+
+    CRITICAL_REGION_ENTER();
+    memset(p_stats, 0, sizeof(*p_stats));
+
+    for (uint8_t i = 0; i < DK_TWI_MNGR_PRIORITY_COUNT; i++)
+    {
+        p_stats->queue_max_depth[i] = dk_mpsc_queue_pending_count(p_dk_twi_mngr->p_queues[i]);
+    }
+    CRITICAL_REGION_EXIT();
 }
+#endif // DK_TWI_MNGR_STATS_ENABLED
 
 ret_code_t dk_twi_mngr_schedule(dk_twi_mngr_t const *p_dk_twi_mngr, dk_twi_mngr_transaction_t const *p_transaction)
 {
@@ -181,9 +2254,71 @@ ret_code_t dk_twi_mngr_schedule(dk_twi_mngr_t const *p_dk_twi_mngr, dk_twi_mngr_
 
     ret_code_t result = NRF_SUCCESS;
 
-    result = nrf_queue_push(p_dk_twi_mngr->p_queue, (void *)p_transaction);
+    if (((p_transaction->p_transfers != NULL) && (p_transaction->number_of_transfers == 0)) ||
+        (p_transaction->priority >= DK_TWI_MNGR_PRIORITY_COUNT))
+    {
+        return NRF_ERROR_INVALID_PARAM;
+    }
+
+#if DK_TWI_MNGR_STATS_ENABLED
+    // The queue stores a copy, which may also replace a pending write in place. Stamp it before either, so queue wait
+    // can be measured when it is popped.
+    dk_twi_mngr_transaction_t transaction = *p_transaction;
+
+    transaction.schedule_tick = app_timer_cnt_get();
+    p_transaction             = &transaction;
+#endif
+
+    // Superseding and coalescing rewrite a transaction that is already in the queue. They stay in a critical region,
+    // as the consumer must not pop the transaction while it is being rewritten. The queue push itself is lock-free.
+    if (is_supersedable(p_transaction))
+    {
+        uint8_t *p_superseded_buf;
+
+        CRITICAL_REGION_ENTER();
+        p_superseded_buf = pending_write_supersede(p_dk_twi_mngr->p_queues[p_transaction->priority], p_transaction);
+        CRITICAL_REGION_EXIT();
+
+        if (p_superseded_buf != NULL)
+        {
+            // Pending write was replaced in place, the manager is busy so there is nothing to start.
+            dk_twi_mngr_data_buffer_free(p_dk_twi_mngr, p_superseded_buf);
+            stats_merged(p_dk_twi_mngr);
+            return NRF_SUCCESS;
+        }
+    }
+
+    if (is_coalescable(p_transaction))
+    {
+        bool     coalesced;
+        uint8_t *p_released_buf = NULL;
+
+        CRITICAL_REGION_ENTER();
+        coalesced = pending_write_coalesce(p_dk_twi_mngr,
+                                           p_dk_twi_mngr->p_queues[p_transaction->priority],
+                                           p_transaction,
+                                           &p_released_buf);
+        CRITICAL_REGION_EXIT();
+
+        if (coalesced)
+        {
+            // Both writes now live in the merged buffer.
+            dk_twi_mngr_data_buffer_free(p_dk_twi_mngr, p_released_buf);
+            dk_twi_mngr_data_buffer_free(p_dk_twi_mngr, p_transaction->transfer.transfer_description.p_primary_buf);
+            stats_merged(p_dk_twi_mngr);
+            return NRF_SUCCESS;
+        }
+    }
+
+    result = dk_mpsc_queue_push(p_dk_twi_mngr->p_queues[p_transaction->priority], p_transaction);
     if (result == NRF_SUCCESS)
     {
+        stats_scheduled(p_dk_twi_mngr, p_transaction);
+        DK_TRACE(DK_TRACE_EVT_TWI_MNGR_SCHEDULE,
+                 DK_TRACE_INSTANCE_ARG(p_dk_twi_mngr->twi.drv_inst_idx,
+                                       transfer_get(p_transaction, 0)->transfer_description.address),
+                 p_transaction->priority);
+
         // New transaction has been successfully added to queue,
         // so if we are currently idle it's time to start the job.
         start_pending_transaction(p_dk_twi_mngr, false);
@@ -197,26 +2332,25 @@ static void internal_transaction_cb(ret_code_t              result,
                                     dk_twi_mngr_transfer_t *p_transfer,
                                     void                   *p_user_data)
 {
+    UNUSED_PARAMETER(evt);
+    UNUSED_PARAMETER(p_transfer);
+
     dk_twi_mngr_cb_data_t *p_cb_data = (dk_twi_mngr_cb_data_t *)p_user_data;
 
     p_cb_data->transaction_result      = result;
     p_cb_data->transaction_in_progress = false;
 }
 
-ret_code_t dk_twi_mngr_perform(dk_twi_mngr_t const          *p_dk_twi_mngr,
-                               dk_twi_mngr_transfer_t const *p_transfer,
-                               void (*user_function)(void))
+static ret_code_t perform(dk_twi_mngr_t const       *p_dk_twi_mngr,
+                          dk_twi_mngr_transaction_t *p_internal_transaction,
+                          void (*user_function)(void))
 {
-    ASSERT(p_dk_twi_mngr != NULL);
-    ASSERT(p_transfer != NULL);
-
     dk_twi_mngr_cb_data_t cb_data = {.transaction_in_progress = true};
 
-    dk_twi_mngr_transaction_t internal_transaction = {.callback    = internal_transaction_cb,
-                                                      .p_user_data = (void *)&cb_data,
-                                                      .transfer    = *p_transfer};
+    p_internal_transaction->callback    = internal_transaction_cb;
+    p_internal_transaction->p_user_data = (void *)&cb_data;
 
-    ret_code_t result = dk_twi_mngr_schedule(p_dk_twi_mngr, &internal_transaction);
+    ret_code_t result = dk_twi_mngr_schedule(p_dk_twi_mngr, p_internal_transaction);
     VERIFY_SUCCESS(result);
 
     while (cb_data.transaction_in_progress)
@@ -230,4 +2364,156 @@ ret_code_t dk_twi_mngr_perform(dk_twi_mngr_t const          *p_dk_twi_mngr,
     return cb_data.transaction_result;
 }
 
+static ret_code_t perform_wait(dk_twi_mngr_t const       *p_dk_twi_mngr,
+                               dk_twi_mngr_transaction_t *p_internal_transaction,
+                               uint32_t                   timeout_ms)
+{
+    // Pointer for cleaner code.
+    dk_twi_mngr_cb_t *p_cb = p_dk_twi_mngr->p_dk_twi_mngr_cb;
+
+    dk_twi_mngr_cb_data_t cb_data = {.transaction_in_progress = true};
+
+    p_internal_transaction->callback    = internal_transaction_cb;
+    p_internal_transaction->p_user_data = (void *)&cb_data;
+
+    uint32_t const timeout_ticks = MAX(APP_TIMER_TICKS(timeout_ms), APP_TIMER_MIN_TIMEOUT_TICKS);
+    uint32_t const start         = app_timer_cnt_get();
+
+    // The timeout state lives in this call. The timer only wakes the CPU up and has one owner at a time, a call nested
+    // in an interrupt while another one sleeps polls the tick counter for its own deadline instead.
+    bool timer_owner = false;
+    CRITICAL_REGION_ENTER();
+    if (p_cb->p_perform_waiter == NULL)
+    {
+        p_cb->p_perform_waiter = &cb_data;
+        timer_owner            = true;
+    }
+    CRITICAL_REGION_EXIT();
+
+    ret_code_t result = NRF_SUCCESS;
+    if (timer_owner)
+    {
+        result = app_timer_start(*p_dk_twi_mngr->p_perform_timer_id, timeout_ticks, (void *)p_dk_twi_mngr);
+    }
+
+    if (result == NRF_SUCCESS)
+    {
+        result = dk_twi_mngr_schedule(p_dk_twi_mngr, p_internal_transaction);
+    }
+
+    while ((result == NRF_SUCCESS) && cb_data.transaction_in_progress && !cb_data.timed_out)
+    {
+        if (timer_owner)
+        {
+            dk_wait_for_event();
+        }
+        else if (app_timer_cnt_diff_compute(app_timer_cnt_get(), start) >= timeout_ticks)
+        {
+            cb_data.timed_out = true;
+        }
+    }
+
+    if (timer_owner)
+    {
+        (void)app_timer_stop(*p_dk_twi_mngr->p_perform_timer_id);
+
+        CRITICAL_REGION_ENTER();
+        p_cb->p_perform_waiter = NULL;
+        CRITICAL_REGION_EXIT();
+    }
+
+    VERIFY_SUCCESS(result);
+
+    // The transaction refers to this stack frame, it must not stay in the manager after returning.
+    if (cb_data.transaction_in_progress &&
+        transaction_cancel(p_dk_twi_mngr, internal_transaction_cb, (void *)&cb_data, NRF_ERROR_TIMEOUT))
+    {
+        NRF_LOG_WARNING("Transaction timed out");
+        return NRF_ERROR_TIMEOUT;
+    }
+
+    // The transaction could not be cancelled because another context is finishing it, e.g. the bus watchdog is
+    // aborting it. Its callback is the last access to this stack frame and it provides the result.
+    while (cb_data.transaction_in_progress)
+    {
+        if (timer_owner)
+        {
+            dk_wait_for_event();
+        }
+    }
+
+    return cb_data.transaction_result;
+}
+
+ret_code_t dk_twi_mngr_perform(dk_twi_mngr_t const          *p_dk_twi_mngr,
+                               dk_twi_mngr_transfer_t const *p_transfer,
+                               void (*user_function)(void))
+{
+    ASSERT(p_dk_twi_mngr != NULL);
+    ASSERT(p_transfer != NULL);
+
+    dk_twi_mngr_transaction_t internal_transaction = {.transfer       = *p_transfer,
+                                                      .buff_ownership = DK_TWI_MNGR_BUFF_BORROWED};
+
+    return perform(p_dk_twi_mngr, &internal_transaction, user_function);
+}
+
+ret_code_t dk_twi_mngr_perform_sequence(dk_twi_mngr_t const          *p_dk_twi_mngr,
+                                        dk_twi_mngr_transfer_t const *p_transfers,
+                                        uint8_t                       number_of_transfers,
+                                        void (*user_function)(void))
+{
+    ASSERT(p_dk_twi_mngr != NULL);
+    ASSERT(p_transfers != NULL);
+
+    dk_twi_mngr_transaction_t internal_transaction = {.p_transfers         = p_transfers,
+                                                      .number_of_transfers = number_of_transfers,
+                                                      .buff_ownership      = DK_TWI_MNGR_BUFF_BORROWED};
+
+    return perform(p_dk_twi_mngr, &internal_transaction, user_function);
+}
+
+ret_code_t dk_twi_mngr_perform_timeout(dk_twi_mngr_t const          *p_dk_twi_mngr,
+                                       dk_twi_mngr_transfer_t const *p_transfer,
+                                       uint32_t                      timeout_ms)
+{
+    ASSERT(p_dk_twi_mngr != NULL);
+    ASSERT(p_transfer != NULL);
+
+    dk_twi_mngr_transaction_t internal_transaction = {.transfer       = *p_transfer,
+                                                      .buff_ownership = DK_TWI_MNGR_BUFF_BORROWED};
+
+    return perform_wait(p_dk_twi_mngr, &internal_transaction, timeout_ms);
+}
+
+ret_code_t dk_twi_mngr_mux_perform_timeout(dk_twi_mngr_t const          *p_dk_twi_mngr,
+                                           uint8_t                       mux_channels,
+                                           dk_twi_mngr_transfer_t const *p_transfer,
+                                           uint32_t                      timeout_ms)
+{
+    ASSERT(p_dk_twi_mngr != NULL);
+    ASSERT(p_transfer != NULL);
+
+    dk_twi_mngr_transaction_t internal_transaction = {.transfer       = *p_transfer,
+                                                      .mux_channels   = mux_channels,
+                                                      .buff_ownership = DK_TWI_MNGR_BUFF_BORROWED};
+
+    return perform_wait(p_dk_twi_mngr, &internal_transaction, timeout_ms);
+}
+
+ret_code_t dk_twi_mngr_perform_sequence_timeout(dk_twi_mngr_t const          *p_dk_twi_mngr,
+                                                dk_twi_mngr_transfer_t const *p_transfers,
+                                                uint8_t                       number_of_transfers,
+                                                uint32_t                      timeout_ms)
+{
+    ASSERT(p_dk_twi_mngr != NULL);
+    ASSERT(p_transfers != NULL);
+
+    dk_twi_mngr_transaction_t internal_transaction = {.p_transfers         = p_transfers,
+                                                      .number_of_transfers = number_of_transfers,
+                                                      .buff_ownership      = DK_TWI_MNGR_BUFF_BORROWED};
+
+    return perform_wait(p_dk_twi_mngr, &internal_transaction, timeout_ms);
+}
+
 #endif // DK_MODULE_ENABLED(DK_TWI_MNGR)
@@ -1,9 +1,9 @@
 /**
  * @file        dk_twi_mngr.h
  * @author      Danius Kalvaitis (danius.kalvaitis@gmail.com)
- * @brief       TWI manager that implements a queue buffer on top of nrf_twi_mngr.
- * @version     0.2
- * @date        2024-08-15
+ * @brief       TWI manager that queues prioritized transactions of devices sharing one TWI bus.
+ * @version     0.3
+ * @date        2026-10-17
  *
  * @copyright   Copyright (c) Danius Kalvaitis 2024 All rights reserved
  *
@@ -12,22 +12,65 @@
 #ifndef DK_TWI_MNGR_H
 #define DK_TWI_MNGR_H
 
-#include "mem_manager.h"
-#include "nrf_queue.h"
+#include "app_timer.h"
+#include "app_util.h"
+#include "dk_lib_common.h"
+#include "dk_mpsc_queue.h"
+
+/**
+ * @brief Use the TWIM peripheral (EasyDMA) instead of the legacy TWI peripheral.
+ */
+#ifndef DK_TWI_MNGR_USE_TWIM
+#define DK_TWI_MNGR_USE_TWIM 0
+#endif
+
+#if DK_TWI_MNGR_USE_TWIM
+#include "nrfx_twim.h"
+#else
 #include "nrfx_twi.h"
+#endif
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+#if DK_TWI_MNGR_USE_TWIM
+typedef nrfx_twim_t           dk_twi_mngr_drv_t;       ///< Driver instance.
+typedef nrfx_twim_config_t    dk_twi_mngr_config_t;    ///< Driver configuration.
+typedef nrfx_twim_xfer_desc_t dk_twi_mngr_xfer_desc_t; ///< Transfer description.
+typedef nrfx_twim_evt_t       dk_twi_mngr_drv_evt_t;   ///< Driver event.
+
+#define DK_TWI_MNGR_DRV_INSTANCE         NRFX_TWIM_INSTANCE
+#define DK_TWI_MNGR_XFER_DESC_TX         NRFX_TWIM_XFER_DESC_TX
+#define DK_TWI_MNGR_XFER_DESC_RX         NRFX_TWIM_XFER_DESC_RX
+#define DK_TWI_MNGR_XFER_DESC_TXRX       NRFX_TWIM_XFER_DESC_TXRX
+#define DK_TWI_MNGR_XFER_DESC_TXTX       NRFX_TWIM_XFER_DESC_TXTX
+#define DK_TWI_MNGR_XFER_FLAG_TX_NO_STOP NRFX_TWIM_FLAG_TX_NO_STOP
+#else
+typedef nrfx_twi_t           dk_twi_mngr_drv_t;       ///< Driver instance.
+typedef nrfx_twi_config_t    dk_twi_mngr_config_t;    ///< Driver configuration.
+typedef nrfx_twi_xfer_desc_t dk_twi_mngr_xfer_desc_t; ///< Transfer description.
+typedef nrfx_twi_evt_t       dk_twi_mngr_drv_evt_t;   ///< Driver event.
+
+#define DK_TWI_MNGR_DRV_INSTANCE         NRFX_TWI_INSTANCE
+#define DK_TWI_MNGR_XFER_DESC_TX         NRFX_TWI_XFER_DESC_TX
+#define DK_TWI_MNGR_XFER_DESC_RX         NRFX_TWI_XFER_DESC_RX
+#define DK_TWI_MNGR_XFER_DESC_TXRX       NRFX_TWI_XFER_DESC_TXRX
+#define DK_TWI_MNGR_XFER_DESC_TXTX       NRFX_TWI_XFER_DESC_TXTX
+#define DK_TWI_MNGR_XFER_FLAG_TX_NO_STOP NRFX_TWI_FLAG_TX_NO_STOP
+#endif
+
 // If TWIM is present buffers can only be in RAM
-/*lint -save -e491*/
 
 /**
  * @brief Macro checking if buffers should be stored in RAM.
  */
 #ifndef DK_TWI_MNGR_BUFFERS_IN_RAM
-#define DK_TWI_MNGR_BUFFERS_IN_RAM defined(TWIM_PRESENT)
+#ifdef TWIM_PRESENT
+#define DK_TWI_MNGR_BUFFERS_IN_RAM 1
+#else
+#define DK_TWI_MNGR_BUFFERS_IN_RAM 0
+#endif
 #endif
 
 #if DK_TWI_MNGR_BUFFERS_IN_RAM
@@ -36,39 +79,228 @@ extern "C" {
 #define DK_TWI_MNGR_BUFFER_LOC_IND const
 #endif
 
+/**
+ * @brief Size of a small transaction buffer in bytes.
+ */
+#ifndef DK_TWI_MNGR_SMALL_BUFF_SIZE
+#define DK_TWI_MNGR_SMALL_BUFF_SIZE 8
+#endif
+
+/**
+ * @brief Size of a large transaction buffer in bytes.
+ */
+#ifndef DK_TWI_MNGR_LARGE_BUFF_SIZE
+#define DK_TWI_MNGR_LARGE_BUFF_SIZE 32
+#endif
+
+/**
+ * @brief Amount of transactions that can be taken from higher priority queues while a lower priority queue has
+ *        pending transactions, before one transaction of the lower priority queue is forced through.
+ */
+#ifndef DK_TWI_MNGR_STARVATION_LIMIT
+#define DK_TWI_MNGR_STARVATION_LIMIT 8
+#endif
+
+/**
+ * @brief Amount of queued transactions the manager looks ahead for a transaction on the active mux channel, and
+ *        amount of times the transaction at the front of a queue can be passed over for one. 0 disables reordering.
+ */
+#ifndef DK_TWI_MNGR_MUX_BATCH_WINDOW
+#define DK_TWI_MNGR_MUX_BATCH_WINDOW 4
+#endif
+
+/**
+ * @brief Enable earliest-deadline-first scheduling of transactions with @ref DK_TWI_MNGR_FLAG_DEADLINE.
+ */
+#ifndef DK_TWI_MNGR_EDF_ENABLED
+#define DK_TWI_MNGR_EDF_ENABLED 0
+#endif
+
+/**
+ * @brief Amount of queued transactions per queue searched for the earliest deadline. Bounds the time the search
+ *        spends in a critical region, transactions further back are considered once they move up.
+ */
+#ifndef DK_TWI_MNGR_EDF_WINDOW
+#define DK_TWI_MNGR_EDF_WINDOW 8
+#endif
+
+/**
+ * @brief Default timeout in milliseconds for blocking transactions performed with
+ *        @ref dk_twi_mngr_perform_timeout.
+ */
+#ifndef DK_TWI_MNGR_PERFORM_TIMEOUT_MS
+#define DK_TWI_MNGR_PERFORM_TIMEOUT_MS 20
+#endif
+
+/** @brief Base value for TWI manager error codes. */
+#define DK_TWI_MNGR_ERROR_BASE (DK_ERROR_BASE_NUM + 0x0100)
+
+/**
+ * @brief Error code passed to callbacks of transactions that were cancelled or aborted before completion.
+ */
+#define DK_TWI_MNGR_ERROR_ABORTED (DK_TWI_MNGR_ERROR_BASE + 0x0000)
+
+/**
+ * @brief Error code passed to callbacks of transactions that were dropped because their deadline had passed before
+ *        they got to the bus (see @ref DK_TWI_MNGR_FLAG_DEADLINE).
+ */
+#define DK_TWI_MNGR_ERROR_DEADLINE_MISSED (DK_TWI_MNGR_ERROR_BASE + 0x0001)
+
+/**
+ * @brief Default time in milliseconds a transaction may occupy the bus before it is aborted and the bus is recovered.
+ */
+#ifndef DK_TWI_MNGR_TRANSACTION_TIMEOUT_MS
+#define DK_TWI_MNGR_TRANSACTION_TIMEOUT_MS 50
+#endif
+
+/**
+ * @brief Time in milliseconds the bus has to be idle before the TWI peripheral is powered down, 0 to keep it powered.
+ *
+ * @details The peripheral is powered up again by the next transaction. Has to be shorter than the app_timer counter
+ *          period.
+ */
+#ifndef DK_TWI_MNGR_IDLE_TIMEOUT_MS
+#define DK_TWI_MNGR_IDLE_TIMEOUT_MS 0
+#endif
+
+/**
+ * @brief Enable deferring transaction callbacks to app_scheduler (see @ref DK_TWI_MNGR_FLAG_DEFERRED_CB).
+ */
+#ifndef DK_TWI_MNGR_DEFERRED_CB_ENABLED
+#define DK_TWI_MNGR_DEFERRED_CB_ENABLED 0
+#endif
+
+/**
+ * @brief Enable bus statistics (transaction counters, queue high-water marks and latency histograms).
+ */
+#ifndef DK_TWI_MNGR_STATS_ENABLED
+#define DK_TWI_MNGR_STATS_ENABLED 0
+#endif
+
+/**
+ * @brief Amount of slave addresses that have their own statistics counters.
+ */
+#ifndef DK_TWI_MNGR_STATS_SLAVE_COUNT
+#define DK_TWI_MNGR_STATS_SLAVE_COUNT 8
+#endif
+
+/**
+ * @brief Amount of log2 bins in the latency histograms.
+ */
+#ifndef DK_TWI_MNGR_STATS_HIST_BINS
+#define DK_TWI_MNGR_STATS_HIST_BINS 16
+#endif
+
 #define DK_TWI_MNGR_BUFF_CHECK(_buff_name)                                                                             \
     if (_buff_name == NULL)                                                                                            \
     return NRF_ERROR_NO_MEM
 
-#define DK_TWI_MNGR_BUFF_ALLOC(_type, _name, _data_size)                                                               \
+#define DK_TWI_MNGR_BUFF_ALLOC(_p_dk_twi_mngr, _type, _name, _data_size)                                               \
     const uint32_t CONCAT_2(_name, _size) = _data_size + 1;                                                            \
-    _type         *_name                  = (_type *)dk_twi_mngr_data_buffer_alloc(CONCAT_2(_name, _size));            \
+    _type *_name = (_type *)dk_twi_mngr_data_buffer_alloc(_p_dk_twi_mngr, CONCAT_2(_name, _size));                     \
     DK_TWI_MNGR_BUFF_CHECK(_name)
 
 #define DK_TWI_MNGR_TX(address, p_data, length, _flags)                                                                \
     {                                                                                                                  \
-        .transfer_description = NRFX_TWI_XFER_DESC_TX(address, (uint8_t *)p_data, length), .flags = (_flags)           \
+        .transfer_description = DK_TWI_MNGR_XFER_DESC_TX(address, (uint8_t *)p_data, length), .flags = (_flags)        \
     }
 
 #define DK_TWI_MNGR_RX(address, p_data, length, _flags)                                                                \
     {                                                                                                                  \
-        .transfer_description = NRFX_TWI_XFER_DESC_RX(address, p_data, length), .flags = (_flags)                      \
+        .transfer_description = DK_TWI_MNGR_XFER_DESC_RX(address, p_data, length), .flags = (_flags)                   \
     }
 
 #define DK_TWI_MNGR_TX_RX(address, p_tx, tx_len, p_rx, rx_len, _flags)                                                 \
     {                                                                                                                  \
-        .transfer_description = NRFX_TWI_XFER_DESC_TXRX(address, p_tx, tx_len, p_rx, rx_len), .flags = (_flags)        \
+        .transfer_description = DK_TWI_MNGR_XFER_DESC_TXRX(address, p_tx, tx_len, p_rx, rx_len), .flags = (_flags)     \
     }
 
 #define DK_TWI_MNGR_TX_TX(address, p_tx, tx_len, p_tx2, tx_len2, _flags)                                               \
     {                                                                                                                  \
-        .transfer_description = NRFX_TWI_XFER_DESC_TXTX(address, p_tx, tx_len, p_tx2, tx_len2), .flags = (_flags)      \
+        .transfer_description = DK_TWI_MNGR_XFER_DESC_TXTX(address, p_tx, tx_len, p_tx2, tx_len2), .flags = (_flags)   \
     }
 
+/**
+ * @brief Transaction flag marking a single register write as supersedable.
+ *
+ * @details If a supersedable TX transaction to the same slave address, register address (first byte of the primary
+ *          buffer) and length is still pending in the queue, the new transaction replaces it in place instead of
+ *          being appended. The replaced transaction is dropped without calling its callback and its buffer is
+ *          released. Any other queued transaction to the same slave acts as a barrier, writes queued before it are
+ *          never replaced. So does a supersedable write of other registers that overlap the new write (ie a block
+ *          write covering the register), the new write is appended after it.
+ */
+#define DK_TWI_MNGR_FLAG_SUPERSEDE (1UL << 0)
+
+/**
+ * @brief Transaction flag allowing a register write to be merged with the previously queued write.
+ *
+ * @details Set this flag only for slaves that auto-increment the register address. If the last transaction in the
+ *          queue is a coalescable TX to the same slave with the same callback, user data and event type, and the new
+ *          write starts at the register right after its last written register, both writes are merged into one
+ *          burst. The merged transaction calls the callback once.
+ */
+#define DK_TWI_MNGR_FLAG_COALESCE  (1UL << 1)
+
+/**
+ * @brief Transaction flag moving the callback out of the TWI interrupt.
+ *
+ * @details The next transaction is started first and the callback is posted to app_scheduler, so a heavy callback
+ *          does not stall the bus. The transaction buffer is released after the callback returns, so it is held
+ *          until the scheduler runs. If the event cannot be posted the callback is called from the interrupt as
+ *          usual. The flag is ignored unless @ref DK_TWI_MNGR_DEFERRED_CB_ENABLED is set.
+ *
+ * @note    APP_SCHED_EVENT_DATA_MAX_SIZE has to be at least @ref DK_TWI_MNGR_SCHED_EVENT_DATA_SIZE.
+ */
+#define DK_TWI_MNGR_FLAG_DEFERRED_CB (1UL << 2)
+
+/**
+ * @brief Transaction flag allowing a register read to be shared with identical queued reads.
+ *
+ * @details When a shared TXRX read finishes successfully, every shared read to the same slave (and mux channels)
+ *          with identical register bytes and lengths that is queued at that time gets a copy of the read data and
+ *          its callback is called right away, without a bus transfer of its own. No read is shared while a
+ *          transaction to the same slave other than a shared read, or a sequence, is queued in any queue, so it
+ *          never returns data older than what the bus order would give.
+ */
+#define DK_TWI_MNGR_FLAG_SHARED_READ (1UL << 3)
+
+/**
+ * @brief Transaction flag marking the @p deadline of a transaction as valid.
+ *
+ * @details The transaction with the earliest deadline is started first, ahead of the priority classes. Only a queue
+ *          that is starving (see @ref DK_TWI_MNGR_STARVATION_LIMIT) is served before it. A transaction never passes
+ *          an older transaction to the same slave address. If the deadline has already passed when the transaction
+ *          gets to the bus, it is dropped and its callback gets @ref DK_TWI_MNGR_ERROR_DEADLINE_MISSED. A transaction
+ *          that got to the bus in time but finished after its deadline is still reported with its transfer result,
+ *          as its data is valid. The callback can not tell such a late completion from one in time, it is only
+ *          counted in dk_twi_mngr_stats_t::deadline_late (if @ref DK_TWI_MNGR_STATS_ENABLED). Only the first
+ *          @ref DK_TWI_MNGR_EDF_WINDOW transactions of each queue are considered. The flag is ignored unless
+ *          @ref DK_TWI_MNGR_EDF_ENABLED is set.
+ *
+ * @note    Deadlines are absolute app_timer ticks (e.g. app_timer_cnt_get() + APP_TIMER_TICKS(ms)) and have to be
+ *          less than half of the counter period ahead.
+ */
+#define DK_TWI_MNGR_FLAG_DEADLINE (1UL << 4)
+
+/**
+ * @brief Transaction flag set by the manager on a queued transaction that was already completed outside of the
+ *        queue (shared read served by an identical read or cancelled by its owner).
+ */
+#define DK_TWI_MNGR_FLAG_COMPLETED (1UL << 5)
+
+/**
+ * @brief Transaction flag set by the manager on a queued transaction that was cancelled.
+ *
+ * @details A cancelled transaction does not reach the bus. Its callback (if any) is called with
+ *          @ref DK_TWI_MNGR_ERROR_ABORTED when it gets to the front of the queue.
+ */
+#define DK_TWI_MNGR_FLAG_CANCELLED (1UL << 6)
+
 typedef struct
 {
-    nrfx_twi_xfer_desc_t transfer_description; ///< Transfer description.
-    uint8_t              flags;                ///< Transfer flags (see @ref NRFX_TWI_FLAG_TX_NO_STOP).
+    dk_twi_mngr_xfer_desc_t transfer_description; ///< Transfer description.
+    uint8_t                 flags;                ///< Transfer flags (see @ref DK_TWI_MNGR_XFER_FLAG_TX_NO_STOP).
 } dk_twi_mngr_transfer_t;
 
 typedef void (*dk_twi_mngr_callback_t)(ret_code_t              result,
@@ -76,39 +308,355 @@ typedef void (*dk_twi_mngr_callback_t)(ret_code_t              result,
                                        dk_twi_mngr_transfer_t *p_transfer,
                                        void                   *p_user_data);
 
+/**
+ * @brief Ownership of the transaction buffer (primary buffer of the first transfer).
+ */
+typedef enum
+{
+    DK_TWI_MNGR_BUFF_POOL,     ///< Allocated from the manager buffer pool, released to it when the transaction ends.
+    DK_TWI_MNGR_BUFF_BORROWED, ///< Owned by the caller, untouched by the manager. Must stay valid until the end.
+    DK_TWI_MNGR_BUFF_OWNED,    ///< Handed over to the manager, released with the release callback at the end.
+} dk_twi_mngr_buff_ownership_t;
+
+/**
+ * @brief Function releasing a buffer of a finished transaction with @ref DK_TWI_MNGR_BUFF_OWNED ownership.
+ *
+ * @param[in] p_buffer      Primary buffer of the first transfer of the transaction.
+ * @param[in] p_user_data   User data of the transaction.
+ */
+typedef void (*dk_twi_mngr_release_t)(void *p_buffer, void *p_user_data);
+
+/**
+ * @brief Function called once all transactions of a group are finished.
+ *
+ * @param[in] result        NRF_SUCCESS if every transaction succeeded, otherwise the result of the first failed one.
+ * @param[in] p_user_data   User data passed to @ref dk_twi_mngr_group_open.
+ */
+typedef void (*dk_twi_mngr_group_callback_t)(ret_code_t result, void *p_user_data);
+
+/**
+ * @brief Transaction group, a fence over independently scheduled transactions.
+ *
+ * @details Memory of the group is provided by the user and has to stay valid until the group callback is called.
+ */
+typedef struct
+{
+    dk_twi_mngr_group_callback_t callback;    ///< Function to be called once the group is finished.
+    void                        *p_user_data; ///< Pointer to user data to be passed to the callback.
+    volatile uint32_t            pending;     ///< Unfinished transactions, plus one while the group is open.
+    volatile ret_code_t          result;      ///< Result of the first failed transaction.
+} dk_twi_mngr_group_t;
+
+/**
+ * @brief Transaction priority classes.
+ *
+ * @note  Queues are drained in order high, normal, low. Normal priority is the zero value so that transactions
+ *        which do not set a priority keep the default behaviour.
+ */
+typedef enum
+{
+    DK_TWI_MNGR_PRIORITY_NORMAL, ///< Default priority.
+    DK_TWI_MNGR_PRIORITY_HIGH,   ///< Time-critical transactions (ie sensor sampling).
+    DK_TWI_MNGR_PRIORITY_LOW,    ///< Background transactions (ie LED updates).
+    DK_TWI_MNGR_PRIORITY_COUNT   ///< Amount of priority classes.
+} dk_twi_mngr_priority_t;
+
+/**
+ * @brief TWI manager transaction.
+ *
+ * @details A transaction either performs a single @p transfer or, if @p p_transfers is set, a sequence of
+ *          @p number_of_transfers transfers that are chained back-to-back from the TWI interrupt without
+ *          returning to the queue. The callback is called once, after the last transfer of the sequence, and
+ *          receives the last performed transfer.
+ *
+ *          A transaction that occupies the bus longer than @p timeout_ms (or @ref DK_TWI_MNGR_TRANSACTION_TIMEOUT_MS)
+ *          is aborted, the bus is recovered and the callback gets NRF_ERROR_TIMEOUT.
+ *
+ *          A slave behind the bus mux (see @ref dk_twi_mngr_mux_set) is reached by setting @p mux_channels to the
+ *          channel mask written to the mux (e.g. TCA9548A_CHANNEL6). The manager writes the mask to the mux before
+ *          the transaction only if it differs from the active one, and may start queued transactions on the active
+ *          channels ahead of older transactions on other channels (see @ref DK_TWI_MNGR_MUX_BATCH_WINDOW).
+ *          Transactions of slaves that are not behind the mux (@p mux_channels is 0) are never reordered.
+ *
+ *          The transaction buffer is the primary buffer of the first transfer. By default it comes from the buffer
+ *          pool and the manager returns it to the pool when the transaction ends, so all pool buffers of a sequence
+ *          should be carved out of that single allocation. Static or driver owned buffers (ie frame buffers) are
+ *          submitted without a copy with @ref DK_TWI_MNGR_BUFF_BORROWED, or with @ref DK_TWI_MNGR_BUFF_OWNED and
+ *          a @p release function that is called after the callback. Supersede and coalesce only apply to pool
+ *          buffers.
+ *
+ * @note    The @p p_transfers array is not copied into the queue, it must stay valid until the transaction is
+ *          finished. So must every buffer that is not a pool buffer.
+ */
 typedef struct
 {
-    dk_twi_mngr_callback_t callback;    ///< User-specified function to be called after the transaction is finished.
-    void                  *p_user_data; ///< Pointer to user data to be passed to the callback.
-    uint8_t                event_type;  ///< This variable can be used to pass event type to the callback.
-    dk_twi_mngr_transfer_t transfer;    ///< Transfer that is performed in this transaction.
+    dk_twi_mngr_callback_t        callback;            ///< Function to be called after the transaction is finished.
+    void                         *p_user_data;         ///< Pointer to user data to be passed to the callback.
+    uint8_t                       event_type;          ///< Event type to be passed to the callback.
+    dk_twi_mngr_transfer_t        transfer;            ///< Transfer that is performed in this transaction.
+    dk_twi_mngr_transfer_t const *p_transfers;         ///< Transfers of this transaction (NULL to use @p transfer).
+    uint8_t                       number_of_transfers; ///< Amount of transfers in @p p_transfers.
+    dk_twi_mngr_priority_t        priority;            ///< Priority class of this transaction.
+    uint8_t                       flags;               ///< Transaction flags (DK_TWI_MNGR_FLAG_*).
+    uint8_t                       mux_channels;        ///< Mux channels the slave is behind, 0 if not behind the mux.
+    uint16_t                      timeout_ms;          ///< Bus watchdog timeout, 0 for the default timeout.
+    dk_twi_mngr_buff_ownership_t  buff_ownership;      ///< Ownership of the transaction buffer.
+    dk_twi_mngr_release_t         release;             ///< Releases an owned buffer (can be NULL).
+    uint32_t                      deadline;            ///< Absolute deadline in app_timer ticks (see FLAG_DEADLINE).
+    dk_twi_mngr_group_t          *p_group;             ///< Group of the transaction (set by the manager).
+#if DK_TWI_MNGR_STATS_ENABLED
+    uint32_t schedule_tick; ///< Tick the transaction was queued at (set by the manager).
+#endif
 } dk_twi_mngr_transaction_t;
 
+/**
+ * @brief Transaction buffer size classes.
+ */
+typedef enum
+{
+    DK_TWI_MNGR_BUFF_CLASS_SMALL, ///< Buffers of @ref DK_TWI_MNGR_SMALL_BUFF_SIZE bytes.
+    DK_TWI_MNGR_BUFF_CLASS_LARGE, ///< Buffers of @ref DK_TWI_MNGR_LARGE_BUFF_SIZE bytes.
+    DK_TWI_MNGR_BUFF_CLASS_COUNT  ///< Amount of buffer size classes.
+} dk_twi_mngr_buff_class_t;
+
+/**
+ * @brief Transaction buffer pool of a single size class.
+ */
+typedef struct
+{
+    uint8_t  *p_mem;       ///< Memory of the pool blocks.
+    uint16_t *p_next_free; ///< Index of the next free block for every free block.
+    uint16_t  block_size;  ///< Size of a single block in bytes (word aligned).
+    uint16_t  block_count; ///< Amount of blocks in the pool.
+} dk_twi_mngr_buff_pool_t;
+
+/**
+ * @brief Transaction buffer pool control block.
+ */
+typedef struct
+{
+    uint32_t free_head;       ///< First free block index in the low half-word, ABA tag in the high half-word.
+    uint16_t free_count;      ///< Amount of free blocks.
+    uint16_t max_utilization; ///< Maximum amount of blocks that were allocated at once.
+} dk_twi_mngr_buff_pool_cb_t;
+
+#if DK_TWI_MNGR_STATS_ENABLED
+/**
+ * @brief Transaction counters of a single slave address.
+ *
+ * @note  A transaction is counted under the address of its first transfer.
+ */
+typedef struct
+{
+    uint8_t  address;   ///< 7-bit slave address.
+    uint32_t scheduled; ///< Transactions added to a queue.
+    uint32_t completed; ///< Transactions finished successfully.
+    uint32_t failed;    ///< Transactions finished with an error, timed out or cancelled.
+} dk_twi_mngr_slave_stats_t;
+
+/**
+ * @brief Bus statistics.
+ *
+ * @details Times are measured in app_timer ticks. Bin 0 of a histogram counts times of 0 ticks, bin n counts times
+ *          of 2^(n-1) to 2^n - 1 ticks and the last bin also counts everything longer.
+ */
 typedef struct
 {
-    volatile dk_twi_mngr_transaction_t current_transaction; ///< Currently realized transaction.
-    volatile bool                      transaction_in_progress;
+    uint32_t                  scheduled;                                    ///< Transactions added to a queue.
+    uint32_t                  completed;                                    ///< Transactions finished successfully.
+    uint32_t                  failed;                                       ///< Transactions finished with an error.
+    uint32_t                  merged;                                       ///< Writes superseded or coalesced.
+    uint32_t                  deadline_missed;                              ///< Transactions dropped after deadline.
+    uint32_t                  deadline_late;                                ///< Transactions finished after deadline.
+    uint64_t                  bytes;                                        ///< Bytes of finished transfers.
+    uint32_t                  queue_max_depth[DK_TWI_MNGR_PRIORITY_COUNT];  ///< Queue high-water marks.
+    uint32_t                  queue_wait_hist[DK_TWI_MNGR_STATS_HIST_BINS]; ///< Time from queuing to the bus.
+    uint32_t                  on_wire_hist[DK_TWI_MNGR_STATS_HIST_BINS];    ///< Time a transaction held the bus.
+    uint8_t                   slave_count;                                  ///< Amount of used @p slaves entries.
+    dk_twi_mngr_slave_stats_t slaves[DK_TWI_MNGR_STATS_SLAVE_COUNT];        ///< Per-slave counters.
+} dk_twi_mngr_stats_t;
+#endif
+
+typedef struct
+{
+    volatile dk_twi_mngr_transaction_t  current_transaction;                        ///< Currently realized transaction.
+    volatile bool                       transaction_in_progress;                    ///< Transaction is in progress.
+    volatile uint8_t                    current_transfer_idx;                       ///< Index of transfer in progress.
+    volatile dk_twi_mngr_buff_pool_cb_t buff_pool_cb[DK_TWI_MNGR_BUFF_CLASS_COUNT]; ///< Buffer pool control blocks.
+    volatile uint8_t                    skip_count[DK_TWI_MNGR_PRIORITY_COUNT];     ///< Times a queue was passed over.
+    void volatile *volatile             p_perform_waiter;                           ///< Call owning the perform timer.
+    volatile bool                       aborting;                                   ///< Bus is recovered after abort.
+    volatile bool                       handling_event;                             ///< TWI interrupt owns transaction.
+    volatile bool                       watchdog_running;                           ///< Watchdog timer is started.
+    volatile uint32_t                   watchdog_start;                             ///< Tick the transaction started.
+    volatile uint32_t                   watchdog_ticks;                             ///< Transaction timeout, 0 if none.
+    dk_twi_mngr_config_t                twi_config;                                 ///< Config used to re-init TWI.
+    uint8_t                             mux_address;                                ///< Mux address, 0 if no mux.
+    uint8_t                             mux_channels;                               ///< Active channels (TX buffer).
+    volatile bool                       mux_valid;                                  ///< Active channels are known.
+    volatile bool                       mux_switching;                              ///< Channel select is on the bus.
+    uint8_t                             mux_batch_count;                            ///< Times the front was passed.
+#if DK_TWI_MNGR_USE_TWIM
+    volatile bool triggered; ///< Current transaction is an armed transfer started through PPI.
+#endif
+#if DK_TWI_MNGR_IDLE_TIMEOUT_MS
+    volatile bool     powered;       ///< Peripheral is initialized and enabled.
+    volatile uint32_t idle_start;    ///< Tick the bus became idle.
+    volatile uint32_t powered_start; ///< Tick the powered time was last accumulated.
+    volatile uint64_t powered_ticks; ///< Accumulated time the peripheral was powered.
+#endif
+#if DK_TWI_MNGR_STATS_ENABLED
+    dk_twi_mngr_stats_t stats;            ///< Bus statistics.
+    volatile bool       stats_on_wire;    ///< Current transaction was put on the bus.
+    volatile uint32_t   stats_wire_start; ///< Tick the current transaction was put on the bus.
+#endif
 } dk_twi_mngr_cb_t;
 
 typedef struct
 {
-    dk_twi_mngr_cb_t  *p_dk_twi_mngr_cb; ///< Control block of instance.
-    nrf_queue_t const *p_queue;          ///< Transaction queue.
-    nrfx_twi_t         twi;              ///< Pointer to TWI master driver instance.
+    dk_twi_mngr_cb_t       *p_dk_twi_mngr_cb;                        ///< Control block of instance.
+    dk_mpsc_queue_t const  *p_queues[DK_TWI_MNGR_PRIORITY_COUNT];    ///< Transaction queues, one per priority class.
+    dk_twi_mngr_drv_t       twi;                                     ///< Pointer to TWI master driver instance.
+    dk_twi_mngr_buff_pool_t buff_pool[DK_TWI_MNGR_BUFF_CLASS_COUNT]; ///< Transaction buffer pools.
+    app_timer_id_t const   *p_perform_timer_id;                      ///< Timer waking up a sleeping perform call.
+    app_timer_id_t const   *p_watchdog_timer_id;                     ///< Timer supervising the transaction on the bus.
+    app_timer_id_t const   *p_idle_timer_id;                         ///< Timer powering the peripheral down when idle.
 } dk_twi_mngr_t;
 
-#define DK_TWI_MNGR_DEF(_dk_twi_mngr_name, _queue_size, _twi_idx)                                                      \
-    NRF_QUEUE_DEF(dk_twi_mngr_transaction_t, _dk_twi_mngr_name##_queue, (_queue_size), NRF_QUEUE_MODE_NO_OVERFLOW);    \
+#if DK_TWI_MNGR_DEFERRED_CB_ENABLED
+/**
+ * @brief Callback of a finished transaction posted to app_scheduler.
+ */
+typedef struct
+{
+    dk_twi_mngr_t const         *p_dk_twi_mngr;  ///< Manager that owns @p p_buffer.
+    dk_twi_mngr_callback_t       callback;       ///< Function to be called.
+    void                        *p_user_data;    ///< User data of the transaction.
+    dk_twi_mngr_transfer_t       transfer;       ///< Last performed transfer.
+    void                        *p_buffer;       ///< Transaction buffer released after the callback.
+    dk_twi_mngr_buff_ownership_t buff_ownership; ///< Ownership of @p p_buffer.
+    dk_twi_mngr_release_t        release;        ///< Releases an owned @p p_buffer.
+    dk_twi_mngr_group_t         *p_group;        ///< Group of the transaction.
+    ret_code_t                   result;         ///< Transaction result.
+    uint8_t                      event_type;     ///< Event type of the transaction.
+} dk_twi_mngr_deferred_cb_t;
+
+/**
+ * @brief Size of the app_scheduler event data used by deferred callbacks.
+ */
+#define DK_TWI_MNGR_SCHED_EVENT_DATA_SIZE sizeof(dk_twi_mngr_deferred_cb_t)
+#endif
+
+/**
+ * @brief Macro for defining a transaction buffer pool.
+ *
+ * @param _name         Name of the pool.
+ * @param _block_size   Size of a single block in bytes.
+ * @param _block_count  Amount of blocks in the pool, 1 to UINT16_MAX.
+ */
+#define DK_TWI_MNGR_BUFF_POOL_DEF(_name, _block_size, _block_count)                                                    \
+    STATIC_ASSERT(((_block_count) > 0) && ((_block_count) <= UINT16_MAX));                                             \
+    static uint32_t CONCAT_2(_name, _mem)[(ALIGN_NUM(sizeof(uint32_t), (_block_size)) / sizeof(uint32_t)) *            \
+                                          (_block_count)];                                                             \
+    static uint16_t CONCAT_2(_name, _next_free)[(_block_count)]
+
+/**
+ * @brief Macro for initializing a transaction buffer pool structure.
+ *
+ * @param _name         Name of the pool (as passed to @ref DK_TWI_MNGR_BUFF_POOL_DEF).
+ * @param _block_size   Size of a single block in bytes.
+ * @param _block_count  Amount of blocks in the pool.
+ */
+#define DK_TWI_MNGR_BUFF_POOL(_name, _block_size, _block_count)                                                        \
+    {                                                                                                                  \
+        .p_mem = (uint8_t *)CONCAT_2(_name, _mem), .p_next_free = CONCAT_2(_name, _next_free),                         \
+        .block_size = ALIGN_NUM(sizeof(uint32_t), (_block_size)), .block_count = (_block_count)                        \
+    }
+
+/**
+ * @brief Macro for defining a TWI manager instance.
+ *
+ * @param _dk_twi_mngr_name     Name of the instance.
+ * @param _high_queue_size      Size of the high priority transaction queue, has to be a power of two.
+ * @param _normal_queue_size    Size of the normal priority transaction queue, has to be a power of two.
+ * @param _low_queue_size       Size of the low priority transaction queue, has to be a power of two.
+ * @param _twi_idx              Index of the TWI peripheral.
+ * @param _small_buff_count     Amount of @ref DK_TWI_MNGR_SMALL_BUFF_SIZE byte transaction buffers, 1 to UINT16_MAX.
+ * @param _large_buff_count     Amount of @ref DK_TWI_MNGR_LARGE_BUFF_SIZE byte transaction buffers, 1 to UINT16_MAX.
+ */
+#define DK_TWI_MNGR_DEF(_dk_twi_mngr_name,                                                                             \
+                        _high_queue_size,                                                                              \
+                        _normal_queue_size,                                                                            \
+                        _low_queue_size,                                                                               \
+                        _twi_idx,                                                                                      \
+                        _small_buff_count,                                                                             \
+                        _large_buff_count)                                                                             \
+    DK_MPSC_QUEUE_DEF(dk_twi_mngr_transaction_t, _dk_twi_mngr_name##_high_queue, (_high_queue_size));                  \
+    DK_MPSC_QUEUE_DEF(dk_twi_mngr_transaction_t, _dk_twi_mngr_name##_normal_queue, (_normal_queue_size));              \
+    DK_MPSC_QUEUE_DEF(dk_twi_mngr_transaction_t, _dk_twi_mngr_name##_low_queue, (_low_queue_size));                    \
+    DK_TWI_MNGR_BUFF_POOL_DEF(_dk_twi_mngr_name##_small_buff, DK_TWI_MNGR_SMALL_BUFF_SIZE, (_small_buff_count));       \
+    DK_TWI_MNGR_BUFF_POOL_DEF(_dk_twi_mngr_name##_large_buff, DK_TWI_MNGR_LARGE_BUFF_SIZE, (_large_buff_count));       \
+    APP_TIMER_DEF(_dk_twi_mngr_name##_perform_timer);                                                                  \
+    APP_TIMER_DEF(_dk_twi_mngr_name##_watchdog_timer);                                                                 \
+    APP_TIMER_DEF(_dk_twi_mngr_name##_idle_timer);                                                                     \
     static dk_twi_mngr_cb_t    CONCAT_2(_dk_twi_mngr_name, _cb);                                                       \
-    static const dk_twi_mngr_t _dk_twi_mngr_name = {.p_dk_twi_mngr_cb = &CONCAT_2(_dk_twi_mngr_name, _cb),             \
-                                                    .p_queue          = &_dk_twi_mngr_name##_queue,                    \
-                                                    .twi              = NRFX_TWI_INSTANCE(_twi_idx)}
+    static const dk_twi_mngr_t _dk_twi_mngr_name = {                                                                   \
+      .p_dk_twi_mngr_cb = &CONCAT_2(_dk_twi_mngr_name, _cb),                                                           \
+      .p_queues         = {[DK_TWI_MNGR_PRIORITY_NORMAL] = &_dk_twi_mngr_name##_normal_queue,                          \
+                           [DK_TWI_MNGR_PRIORITY_HIGH]   = &_dk_twi_mngr_name##_high_queue,                            \
+                           [DK_TWI_MNGR_PRIORITY_LOW]    = &_dk_twi_mngr_name##_low_queue},                            \
+      .twi              = DK_TWI_MNGR_DRV_INSTANCE(_twi_idx),                                                          \
+      .buff_pool        = {                                                                                            \
+        DK_TWI_MNGR_BUFF_POOL(_dk_twi_mngr_name##_small_buff, DK_TWI_MNGR_SMALL_BUFF_SIZE, (_small_buff_count)),       \
+        DK_TWI_MNGR_BUFF_POOL(_dk_twi_mngr_name##_large_buff, DK_TWI_MNGR_LARGE_BUFF_SIZE, (_large_buff_count))},      \
+      .p_perform_timer_id  = &_dk_twi_mngr_name##_perform_timer,                                                       \
+      .p_watchdog_timer_id = &_dk_twi_mngr_name##_watchdog_timer,                                                      \
+      .p_idle_timer_id     = &_dk_twi_mngr_name##_idle_timer}
 
-ret_code_t dk_twi_mngr_init(dk_twi_mngr_t const *p_dk_twi_mngr, nrfx_twi_config_t const *p_default_twi_config);
+ret_code_t dk_twi_mngr_init(dk_twi_mngr_t const *p_dk_twi_mngr, dk_twi_mngr_config_t const *p_default_twi_config);
 
 void dk_twi_mngr_deinit(dk_twi_mngr_t const *p_dk_twi_mngr);
 
-inline void *dk_twi_mngr_data_buffer_alloc(uint32_t size) { return nrf_malloc(size); }
+/**
+ * @brief       Allocate a transaction buffer from the instance buffer pool.
+ *
+ * @details     The smallest size class that fits the requested size and has a free block is used. Allocation and
+ *              release take constant time and are safe to call from both interrupt and main context.
+ *
+ * @param[in]   p_dk_twi_mngr   Pointer to TWI manager instance.
+ * @param[in]   size            Requested buffer size in bytes.
+ *
+ * @return      Pointer to allocated buffer or NULL if no block of sufficient size is available.
+ */
+void *dk_twi_mngr_data_buffer_alloc(dk_twi_mngr_t const *p_dk_twi_mngr, uint32_t size);
+
+/**
+ * @brief       Release a transaction buffer back to the instance buffer pool.
+ *
+ * @note        Pointers that do not belong to the instance buffer pool are ignored.
+ *
+ * @param[in]   p_dk_twi_mngr   Pointer to TWI manager instance.
+ * @param[in]   p_buffer        Pointer to buffer returned by @ref dk_twi_mngr_data_buffer_alloc.
+ */
+void dk_twi_mngr_data_buffer_free(dk_twi_mngr_t const *p_dk_twi_mngr, void *p_buffer);
+
+/**
+ * @brief       Get the maximum amount of buffers of a size class that were allocated at once.
+ *
+ * @param[in]   p_dk_twi_mngr   Pointer to TWI manager instance.
+ * @param[in]   buff_class      Buffer size class.
+ *
+ * @return      Buffer pool high-water mark.
+ */
+uint16_t dk_twi_mngr_buff_max_utilization_get(dk_twi_mngr_t const *p_dk_twi_mngr, dk_twi_mngr_buff_class_t buff_class);
+
+/**
+ * @brief       Reset the buffer pool high-water mark of a size class to the current utilization.
+ *
+ * @param[in]   p_dk_twi_mngr   Pointer to TWI manager instance.
+ * @param[in]   buff_class      Buffer size class.
+ */
+void dk_twi_mngr_buff_max_utilization_reset(dk_twi_mngr_t const *p_dk_twi_mngr, dk_twi_mngr_buff_class_t buff_class);
 
 ret_code_t dk_twi_mngr_schedule(dk_twi_mngr_t const *p_dk_twi_mngr, dk_twi_mngr_transaction_t const *p_transaction);
 
@@ -116,6 +664,233 @@ ret_code_t dk_twi_mngr_perform(dk_twi_mngr_t const          *p_dk_twi_mngr,
                                dk_twi_mngr_transfer_t const *p_transfer,
                                void (*user_function)(void));
 
+/**
+ * @brief       Perform a sequence of transfers in a blocking manner.
+ *
+ * @details     The transfers are scheduled as a single transaction, so no other transaction is interleaved between
+ *              them. The function returns when the whole sequence is finished or the first transfer fails.
+ *
+ * @param[in]   p_dk_twi_mngr       Pointer to TWI manager instance.
+ * @param[in]   p_transfers         Pointer to array of transfers.
+ * @param[in]   number_of_transfers Amount of transfers in the array.
+ * @param[in]   user_function       Function to be called while waiting for the sequence to finish (can be NULL).
+ *
+ * @retval      NRF_SUCCESS         If all transfers were performed successfully.
+ * @retval      Other               Error codes returned by @ref dk_twi_mngr_schedule or the failed transfer.
+ */
+ret_code_t dk_twi_mngr_perform_sequence(dk_twi_mngr_t const          *p_dk_twi_mngr,
+                                        dk_twi_mngr_transfer_t const *p_transfers,
+                                        uint8_t                       number_of_transfers,
+                                        void (*user_function)(void));
+
+/**
+ * @brief       Perform a transfer in a blocking manner, sleeping until it is finished.
+ *
+ * @details     Instead of polling, the CPU sleeps (sd_app_evt_wait when the SoftDevice is enabled, __WFE otherwise)
+ *              until the transfer is finished or the timeout expires. A transaction that timed out is removed from
+ *              the queue, or aborted if it is already on the bus, so the transfer buffers can be released when the
+ *              function returns. If the bus watchdog is aborting the transaction at the same time, the function waits
+ *              for the abort to finish and returns its result.
+ *
+ * @note        Requires app_timer to be initialized. Must not be called from an interrupt that has a higher
+ *              priority than the TWI or app_timer interrupts. A call made from an interrupt while another call is
+ *              sleeping polls for its timeout instead of sleeping.
+ *
+ * @param[in]   p_dk_twi_mngr       Pointer to TWI manager instance.
+ * @param[in]   p_transfer          Pointer to transfer.
+ * @param[in]   timeout_ms          Time in milliseconds to wait for the transfer, including time spent in the queue.
+ *
+ * @retval      NRF_SUCCESS         If the transfer was performed successfully.
+ * @retval      NRF_ERROR_TIMEOUT   If the transfer was not finished in time.
+ * @retval      Other               Error codes returned by @ref dk_twi_mngr_schedule, app_timer or the transfer.
+ */
+ret_code_t dk_twi_mngr_perform_timeout(dk_twi_mngr_t const          *p_dk_twi_mngr,
+                                       dk_twi_mngr_transfer_t const *p_transfer,
+                                       uint32_t                      timeout_ms);
+
+/**
+ * @brief       Perform a transfer to a slave behind the bus mux in a blocking manner, sleeping until it is finished.
+ *
+ * @details     Variant of @ref dk_twi_mngr_perform_timeout for slaves behind the mux set with
+ *              @ref dk_twi_mngr_mux_set. The manager selects @p mux_channels before the transfer when needed.
+ *
+ * @param[in]   p_dk_twi_mngr       Pointer to TWI manager instance.
+ * @param[in]   mux_channels        Mux channels the slave is behind, 0 if not behind the mux.
+ * @param[in]   p_transfer          Pointer to transfer.
+ * @param[in]   timeout_ms          Time in milliseconds to wait for the transfer, including time spent in the queue.
+ *
+ * @retval      NRF_SUCCESS         If the transfer was performed successfully.
+ * @retval      NRF_ERROR_TIMEOUT   If the transfer was not finished in time.
+ * @retval      Other               Error codes returned by @ref dk_twi_mngr_schedule, app_timer or the transfer.
+ */
+ret_code_t dk_twi_mngr_mux_perform_timeout(dk_twi_mngr_t const          *p_dk_twi_mngr,
+                                           uint8_t                       mux_channels,
+                                           dk_twi_mngr_transfer_t const *p_transfer,
+                                           uint32_t                      timeout_ms);
+
+/**
+ * @brief       Perform a sequence of transfers in a blocking manner, sleeping until it is finished.
+ *
+ * @details     Sequence variant of @ref dk_twi_mngr_perform_timeout.
+ *
+ * @param[in]   p_dk_twi_mngr       Pointer to TWI manager instance.
+ * @param[in]   p_transfers         Pointer to array of transfers.
+ * @param[in]   number_of_transfers Amount of transfers in the array.
+ * @param[in]   timeout_ms          Time in milliseconds to wait for the sequence, including time spent in the queue.
+ *
+ * @retval      NRF_SUCCESS         If all transfers were performed successfully.
+ * @retval      NRF_ERROR_TIMEOUT   If the sequence was not finished in time.
+ * @retval      Other               Error codes returned by @ref dk_twi_mngr_schedule, app_timer or the failed transfer.
+ */
+ret_code_t dk_twi_mngr_perform_sequence_timeout(dk_twi_mngr_t const          *p_dk_twi_mngr,
+                                                dk_twi_mngr_transfer_t const *p_transfers,
+                                                uint8_t                       number_of_transfers,
+                                                uint32_t                      timeout_ms);
+
+/**
+ * @brief       Cancel all queued transactions of an owner.
+ *
+ * @details     Transactions with matching @p p_user_data never reach the bus. Their buffers are released before this
+ *              function returns and, if @p notify is set, their callbacks are called with
+ *              @ref DK_TWI_MNGR_ERROR_ABORTED (from app_scheduler for transactions with
+ *              @ref DK_TWI_MNGR_FLAG_DEFERRED_CB). A transaction that is already on the bus is not aborted.
+ *
+ * @param[in]   p_dk_twi_mngr   Pointer to TWI manager instance.
+ * @param[in]   p_user_data     User data the transactions were scheduled with (ie driver instance).
+ * @param[in]   notify          Call the callbacks of cancelled transactions.
+ *
+ * @return      Amount of cancelled transactions.
+ */
+uint32_t dk_twi_mngr_cancel(dk_twi_mngr_t const *p_dk_twi_mngr, void const *p_user_data, bool notify);
+
+/**
+ * @brief       Open a transaction group.
+ *
+ * @details     Transactions are added to the group with @ref dk_twi_mngr_group_schedule, possibly on several managers.
+ *              Their own callbacks are called as usual. The group callback is called once, after the group was closed
+ *              with @ref dk_twi_mngr_group_close and all of its transactions are finished (including cancelled and
+ *              timed out ones). It runs in the context that finishes the last transaction, or in the context of
+ *              @ref dk_twi_mngr_group_close if that comes last.
+ *
+ * @param[out]  p_group     Pointer to group.
+ * @param[in]   callback    Function to be called once the group is finished.
+ * @param[in]   p_user_data Pointer to user data to be passed to the callback.
+ */
+void dk_twi_mngr_group_open(dk_twi_mngr_group_t *p_group, dk_twi_mngr_group_callback_t callback, void *p_user_data);
+
+/**
+ * @brief       Schedule a transaction as a member of an open group.
+ *
+ * @note        Members of a group are never superseded or coalesced.
+ *
+ * @param[in]   p_dk_twi_mngr   Pointer to TWI manager instance.
+ * @param[in]   p_group         Pointer to open group.
+ * @param[in]   p_transaction   Pointer to transaction.
+ *
+ * @retval      NRF_SUCCESS     If the transaction was scheduled.
+ * @retval      Other           Error codes returned by @ref dk_twi_mngr_schedule. The transaction is not part of the
+ *                              group then.
+ */
+ret_code_t dk_twi_mngr_group_schedule(dk_twi_mngr_t const             *p_dk_twi_mngr,
+                                      dk_twi_mngr_group_t             *p_group,
+                                      dk_twi_mngr_transaction_t const *p_transaction);
+
+/**
+ * @brief       Close a transaction group, no more transactions are added to it.
+ *
+ * @param[in]   p_group Pointer to open group.
+ */
+void dk_twi_mngr_group_close(dk_twi_mngr_group_t *p_group);
+
+/**
+ * @brief       Set the I2C switch (TCA9548A or compatible) that slaves with @p mux_channels are behind.
+ *
+ * @details     The active channels are unknown after this call, so the channels are written to the mux before the
+ *              next transaction that has @p mux_channels set. Transactions addressed to the mux itself make the
+ *              active channels unknown too.
+ *
+ * @note        Must be called while no transaction with @p mux_channels set is queued.
+ *
+ * @param[in]   p_dk_twi_mngr   Pointer to TWI manager instance.
+ * @param[in]   mux_address     I2C address of the mux, 0 if there is no mux on the bus.
+ */
+void dk_twi_mngr_mux_set(dk_twi_mngr_t const *p_dk_twi_mngr, uint8_t mux_address);
+
+#if DK_TWI_MNGR_USE_TWIM
+/**
+ * @brief       Arm a transfer that is started by hardware through PPI.
+ *
+ * @details     The transfer is prepared with NRFX_TWIM_FLAG_HOLD_XFER. Connecting the returned start task to a TIMER
+ *              or GPIOTE event through PPI starts the transfer without CPU involvement. The bus is reserved for the
+ *              armed transfer, queued transactions wait until it finishes or is disarmed, and the bus watchdog does
+ *              not supervise it.
+ *
+ *              With NRFX_TWIM_FLAG_REPEATED_XFER the transfer stays armed after every run and the callback is called
+ *              with NRF_SUCCESS for every run (unless NRFX_TWIM_FLAG_NO_XFER_EVT_HANDLER is set). Adding
+ *              NRFX_TWIM_FLAG_RX_POSTINC moves the RX pointer by the RX length after every run, so periodic samples
+ *              fill an ArrayList in the secondary buffer. The list has to hold all runs until the transfer is
+ *              disarmed (count them with a TIMER in counter mode on the STOPPED event). Without
+ *              NRFX_TWIM_FLAG_REPEATED_XFER the transaction ends after a single run like a queued one.
+ *
+ * @note        Only the single @p transfer of the transaction is supported. Buffers have to be in RAM.
+ *
+ * @param[in]   p_dk_twi_mngr           Pointer to TWI manager instance.
+ * @param[in]   p_transaction           Transaction with the transfer to be armed.
+ * @param[out]  p_start_task            Address of the task that starts the transfer.
+ *
+ * @retval      NRF_SUCCESS             If the transfer was armed.
+ * @retval      NRF_ERROR_INVALID_PARAM If the transaction is a sequence.
+ * @retval      NRF_ERROR_BUSY          If the manager has a transaction in progress.
+ * @retval      Other                   Error codes returned by nrfx_twim_xfer.
+ */
+ret_code_t dk_twi_mngr_triggered_xfer_arm(dk_twi_mngr_t const             *p_dk_twi_mngr,
+                                          dk_twi_mngr_transaction_t const *p_transaction,
+                                          uint32_t                        *p_start_task);
+
+/**
+ * @brief       Stop an armed transfer and release the bus to queued transactions.
+ *
+ * @details     The callback of the armed transaction is called with @ref DK_TWI_MNGR_ERROR_ABORTED. Disable the PPI
+ *              channel before disarming, so the transfer is not triggered again.
+ *
+ * @param[in]   p_dk_twi_mngr           Pointer to TWI manager instance.
+ *
+ * @retval      NRF_SUCCESS             If the transfer was disarmed.
+ * @retval      NRF_ERROR_INVALID_STATE If no transfer is armed.
+ */
+ret_code_t dk_twi_mngr_triggered_xfer_disarm(dk_twi_mngr_t const *p_dk_twi_mngr);
+#endif
+
+#if DK_TWI_MNGR_IDLE_TIMEOUT_MS
+/**
+ * @brief       Get the time the TWI peripheral has been powered since @ref dk_twi_mngr_init.
+ *
+ * @param[in]   p_dk_twi_mngr   Pointer to TWI manager instance.
+ *
+ * @return      Powered time in app_timer ticks.
+ */
+uint64_t dk_twi_mngr_powered_ticks_get(dk_twi_mngr_t const *p_dk_twi_mngr);
+#endif
+
+#if DK_TWI_MNGR_STATS_ENABLED
+/**
+ * @brief       Take a consistent snapshot of the bus statistics.
+ *
+ * @param[in]   p_dk_twi_mngr   Pointer to TWI manager instance.
+ * @param[out]  p_stats         Pointer to memory the statistics are copied to.
+ */
+void dk_twi_mngr_stats_get(dk_twi_mngr_t const *p_dk_twi_mngr, dk_twi_mngr_stats_t *p_stats);
+
+/**
+ * @brief       Clear the bus statistics.
+ *
+ * @details     Queue high-water marks are reset to the current queue depths.
+ *
+ * @param[in]   p_dk_twi_mngr   Pointer to TWI manager instance.
+ */
+void dk_twi_mngr_stats_reset(dk_twi_mngr_t const *p_dk_twi_mngr);
+#endif
+
 __STATIC_INLINE bool dk_twi_mngr_is_idle(dk_twi_mngr_t const *p_dk_twi_mngr);
 
 #ifndef SUPPRESS_INLINE_IMPLEMENTATION
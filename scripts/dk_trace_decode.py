@@ -0,0 +1,172 @@
+#!/usr/bin/env python
+"""Decode a dk_trace buffer dump into Chrome trace JSON.
+
+The dump is the raw dk_trace_buffer_t structure, for example taken with gdb:
+
+    dump binary value trace.bin m_dk_trace
+
+The output can be opened with chrome://tracing or https://ui.perfetto.dev.
+Event names are read from the dk_trace_evt_id_t enum of dk_trace.h.
+
+"""
+
+from __future__ import print_function
+
+import argparse
+import json
+import os
+import re
+import struct
+import sys
+
+DK_TRACE_MAGIC = 0x444B5452
+
+HEADER_FORMAT = '<6I'
+RECORD_FORMAT = '<IHHII'
+
+DEFAULT_HEADER = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', 'nordic', 'modules', 'dk_trace',
+                              'dk_trace.h')
+
+ENUM_PREFIX = 'DK_TRACE_EVT_'
+
+# The high byte of arg0 is the instance of the module, see DK_TRACE_INSTANCE_ARG of dk_trace.h.
+ARG0_INSTANCE_SHIFT = 24
+ARG0_VALUE_MASK = (1 << ARG0_INSTANCE_SHIFT) - 1
+
+
+def event_names_load(header_path):
+    """Map event IDs to names using the enumerators of dk_trace.h."""
+    names = {}
+    pattern = re.compile(r'^\s*' + ENUM_PREFIX + r'(\w+)\s*=\s*(0x[0-9A-Fa-f]+|\d+)\s*,')
+
+    with open(header_path) as header:
+        for line in header:
+            match = pattern.match(line)
+            if match:
+                names[int(match.group(2), 0)] = match.group(1)
+
+    return names
+
+
+def records_read(dump):
+    """Return the header fields and the written records ordered from the oldest to the newest."""
+    header_size = struct.calcsize(HEADER_FORMAT)
+    record_size = struct.calcsize(RECORD_FORMAT)
+
+    magic, size, timestamp_hz, timestamp_mask, write_pos, _ = struct.unpack_from(HEADER_FORMAT, dump)
+    if magic != DK_TRACE_MAGIC:
+        raise ValueError('not a dk_trace dump (magic 0x{:08X})'.format(magic))
+
+    if len(dump) < header_size + size * record_size:
+        raise ValueError('dump is truncated, {} records expected'.format(size))
+
+    records = []
+    skipped = 0
+
+    for pos in range(max(0, write_pos - size), write_pos):
+        timestamp, event_id, seq, arg0, arg1 = struct.unpack_from(RECORD_FORMAT, dump,
+                                                                  header_size + (pos % size) * record_size)
+
+        # A record that was still being written carries the sequence number of the previous lap.
+        if seq != (pos & 0xFFFF):
+            skipped += 1
+            continue
+
+        records.append((timestamp, event_id, arg0, arg1))
+
+    return timestamp_hz, timestamp_mask, records, skipped
+
+
+def trace_events_build(records, names, timestamp_hz, timestamp_mask):
+    """Convert the records to Chrome trace events with timestamps unwrapped from the counter period."""
+    events = []
+    open_spans = {}
+    time = 0
+    previous = None
+
+    for timestamp, event_id, arg0, arg1 in records:
+        if previous is None:
+            previous = timestamp
+
+        delta = (timestamp - previous) & timestamp_mask
+
+        # A writer preempted between taking its timestamp and claiming its record stores an older timestamp than
+        # the record before it. The wrapped difference of such a step back is above half of the period, it is
+        # clamped to 0 so it does not show up as a jump of almost a whole period.
+        if delta <= timestamp_mask // 2:
+            time += delta
+            previous = timestamp
+
+        name = names.get(event_id, '0x{:04X}'.format(event_id))
+        track = ((event_id >> 8) << 8) | (arg0 >> ARG0_INSTANCE_SHIFT)
+        event = {
+            'name': name,
+            'pid': 0,
+            'tid': track,
+            'ts': time * 1e6 / timestamp_hz,
+            'args': {'arg0': arg0 & ARG0_VALUE_MASK, 'arg1': arg1},
+        }
+
+        if name.endswith('_BEGIN'):
+            event['name'] = name[:-len('_BEGIN')]
+            event['ph'] = 'B'
+            open_spans[track] = open_spans.get(track, 0) + 1
+        elif name.endswith('_END'):
+            # An end without its begin (overwritten or never started) would close an unrelated span.
+            if open_spans.get(track, 0) == 0:
+                event['ph'] = 'i'
+                event['s'] = 't'
+            else:
+                event['name'] = name[:-len('_END')]
+                event['ph'] = 'E'
+                open_spans[track] -= 1
+        else:
+            event['ph'] = 'i'
+            event['s'] = 't'
+
+        events.append(event)
+
+    for track in sorted(set(event['tid'] for event in events)):
+        group = track >> 8
+        instance = track & 0xFF
+        track_names = [name for event_id, name in names.items() if (event_id >> 8) == group]
+        track_name = os.path.commonprefix(track_names).rstrip('_') or '0x{:02X}'.format(group)
+        if instance:
+            track_name += ' {}'.format(instance)
+        events.append({'name': 'thread_name', 'ph': 'M', 'pid': 0, 'tid': track, 'args': {'name': track_name}})
+
+    return events
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('dump', help='raw dump of the dk_trace buffer')
+    parser.add_argument('-o', '--output', help='output JSON file (default: stdout)')
+    parser.add_argument('--header', default=DEFAULT_HEADER, help='dk_trace.h with the event IDs')
+    args = parser.parse_args()
+
+    with open(args.dump, 'rb') as dump_file:
+        dump = dump_file.read()
+
+    try:
+        timestamp_hz, timestamp_mask, records, skipped = records_read(dump)
+    except ValueError as error:
+        print('{}: {}'.format(args.dump, error), file=sys.stderr)
+        return 1
+
+    events = trace_events_build(records, event_names_load(args.header), timestamp_hz, timestamp_mask)
+    output = json.dumps({'traceEvents': events, 'displayTimeUnit': 'ns'}, indent=1)
+
+    if args.output:
+        with open(args.output, 'w') as output_file:
+            output_file.write(output)
+    else:
+        print(output)
+
+    print('{} records decoded, {} incomplete skipped'.format(len(records), skipped), file=sys.stderr)
+
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())